@@ -0,0 +1,125 @@
+################################################################################
+# Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+import functools
+import multiprocessing
+
+from DistRDF import DataFrame
+from DistRDF import Node
+from DistRDF.Backends import Base
+
+# The mapper and the ranges of the current execution. They are module-level
+# variables, rather than arguments of the tasks, because the mapper is a
+# closure and cannot be pickled: the worker processes are forked after these
+# are set and inherit them, together with the state of the ROOT interpreter.
+_mapper = None
+_ranges = None
+
+
+def _run_mapper(range_index):
+    """Run the mapper of the current execution on one of its ranges."""
+    return _mapper(_ranges[range_index])
+
+
+class MultiProcessBackend(Base.BaseBackend):
+    """
+    Backend that executes the computational graph on worker processes on the
+    local machine, each of them processing a different range of entries.
+
+    The worker processes are forked from the current process, like the ones of
+    ROOT's TProcessExecutor, so they inherit all the code that was declared to
+    the ROOT interpreter, including headers and shared libraries: these do not
+    need to be distributed. The partial results are sent back to the current
+    process by pickling them, which uses ROOT I/O for C++ objects, and are
+    merged there.
+
+    This backend is useful to scale a computation beyond the limits of the
+    thread pool of a single process and to test distributed computation graphs
+    without a cluster. It requires an operating system that supports `fork`.
+    """
+
+    def __init__(self, nworkers=None):
+        """
+        Creates an instance of the multi-process backend class.
+
+        Args:
+            nworkers (int, optional): The number of worker processes. The
+                default value is the number of CPUs of the machine.
+        """
+        super().__init__()
+
+        if nworkers is None:
+            nworkers = multiprocessing.cpu_count()
+        if nworkers < 1:
+            raise ValueError(
+                "The number of worker processes must be at least 1, got {}."
+                .format(nworkers))
+        self.nworkers = nworkers
+
+    def optimize_npartitions(self, npartitions):
+        """
+        Use at least one partition per worker process, so that none of them
+        stays idle.
+        """
+        return max(npartitions, self.nworkers)
+
+    def ProcessAndMerge(self, ranges, mapper, reducer):
+        """
+        Performs map-reduce with a pool of local worker processes.
+
+        Args:
+            mapper (function): A function that runs the computational graph
+                and returns a list of values.
+
+            reducer (function): A function that merges two lists that were
+                returned by the mapper.
+
+        Returns:
+            list: A list representing the values of action nodes returned
+            after computation (Map-Reduce).
+        """
+        global _mapper, _ranges
+        _mapper = mapper
+        _ranges = ranges
+
+        try:
+            context = multiprocessing.get_context("fork")
+            nprocesses = min(self.nworkers, len(ranges))
+            pool = context.Pool(processes=nprocesses)
+            try:
+                # Partial results are merged, in the order of the ranges,
+                # while the workers are still processing the next ones
+                partial_results = pool.imap(_run_mapper, range(len(ranges)))
+                result = functools.reduce(reducer, partial_results)
+            finally:
+                pool.terminate()
+                pool.join()
+        finally:
+            _mapper = None
+            _ranges = None
+
+        return result
+
+    def distribute_unique_paths(self, paths):
+        """
+        Worker processes run on the local machine and are forked from the
+        current process, so they can access the same files and already know
+        about all declared headers and loaded libraries. Nothing to do.
+
+        Args:
+            paths (set): A set of paths to files that should be sent to the
+                distributed workers.
+        """
+        pass
+
+    def make_dataframe(self, *args, **kwargs):
+        """Creates an instance of a distributed RDataFrame"""
+        # By default, use one partition per worker process
+        kwargs.setdefault("npartitions", self.nworkers)
+        headnode = Node.HeadNode(*args)
+        return DataFrame.RDataFrame(headnode, self, **kwargs)
@@ -0,0 +1,19 @@
+################################################################################
+# Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+def RDataFrame(*args, **kwargs):
+    """
+    Create an RDataFrame object that can run computations on local worker
+    processes.
+    """
+
+    from DistRDF.Backends.MultiProcess import Backend
+    nworkers = kwargs.get("nworkers", None)
+    multiprocess = Backend.MultiProcessBackend(nworkers=nworkers)
+
+    return multiprocess.make_dataframe(*args, **kwargs)
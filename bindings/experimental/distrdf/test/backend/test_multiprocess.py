@@ -0,0 +1,120 @@
+import os
+import unittest
+
+import DistRDF
+import ROOT
+from DistRDF.Backends import MultiProcess
+from DistRDF.Backends.MultiProcess import Backend
+
+
+class MultiProcessBackendInitTest(unittest.TestCase):
+    """
+    Tests to ensure that the instance variables of the `MultiProcess` backend
+    are set according to the input arguments.
+    """
+
+    def test_default_nworkers(self):
+        """The default number of workers is the number of CPUs."""
+        backend = Backend.MultiProcessBackend()
+        self.assertGreaterEqual(backend.nworkers, 1)
+
+    def test_invalid_nworkers(self):
+        """Fewer than one worker is an error."""
+        with self.assertRaises(ValueError):
+            Backend.MultiProcessBackend(nworkers=0)
+
+    def test_optimize_npartitions(self):
+        """There is at least one partition per worker."""
+        backend = Backend.MultiProcessBackend(nworkers=4)
+        self.assertEqual(backend.optimize_npartitions(1), 4)
+        self.assertEqual(backend.optimize_npartitions(10), 10)
+
+    def test_default_npartitions(self):
+        """By default, a dataframe has one partition per worker."""
+        df = MultiProcess.RDataFrame(100, nworkers=3)
+        self.assertEqual(df._headnode.npartitions, 3)
+
+
+class ProcessAndMergeTest(unittest.TestCase):
+    """Check the map-reduce logic of the backend with plain Python values."""
+
+    def test_closures_and_order(self):
+        """
+        Mapper and reducer can be closures: they are not pickled. All ranges
+        are processed and the results are merged in order.
+        """
+        backend = Backend.MultiProcessBackend(nworkers=3)
+        offset = 10
+
+        def mapper(current_range):
+            return [current_range + offset]
+
+        def reducer(out, other):
+            return out + other
+
+        result = backend.ProcessAndMerge(list(range(7)), mapper, reducer)
+        self.assertEqual(result, list(range(10, 17)))
+
+    def test_workers_are_separate_processes(self):
+        """The mapper runs in processes other than the current one."""
+        backend = Backend.MultiProcessBackend(nworkers=2)
+
+        def mapper(current_range):
+            return {os.getpid()}
+
+        pids = backend.ProcessAndMerge([0, 1, 2, 3], mapper,
+                                       lambda out, other: out | other)
+        self.assertNotIn(os.getpid(), pids)
+
+    def test_mapper_error(self):
+        """Errors raised in a worker are raised in the current process."""
+        backend = Backend.MultiProcessBackend(nworkers=2)
+
+        def mapper(current_range):
+            raise RuntimeError("mapper failed")
+
+        with self.assertRaises(RuntimeError):
+            backend.ProcessAndMerge([0, 1], mapper, lambda out, other: out)
+
+
+class OperationsTest(unittest.TestCase):
+    """Run computation graphs on local worker processes."""
+
+    def test_empty_source(self):
+        """Results match the ones of a local RDataFrame."""
+        df = MultiProcess.RDataFrame(1000, nworkers=2, npartitions=4)
+        dfx = df.Define("x", "(int)rdfentry_")
+        count = dfx.Filter("x % 2 == 0").Count()
+        total = dfx.Sum("x")
+        histo = dfx.Histo1D(("h", "h", 10, 0, 1000), "x")
+        arrays = dfx.AsNumpy(["x"])
+
+        self.assertEqual(count.GetValue(), 500)
+        self.assertEqual(total.GetValue(), 499500)
+        self.assertEqual(histo.GetEntries(), 1000)
+        self.assertEqual(sorted(arrays["x"]), list(range(1000)))
+
+    def test_tree(self):
+        """Entries of a TTree are split among the workers by cluster."""
+        df = MultiProcess.RDataFrame("myTree", "4clusters.root", nworkers=2)
+        rdf = ROOT.RDataFrame("myTree", "4clusters.root")
+
+        self.assertEqual(df.Count().GetValue(), rdf.Count().GetValue())
+        self.assertEqual(df._headnode.npartitions, 2)
+
+    def test_initialization(self):
+        """The initialization function runs in every worker."""
+        def init(value):
+            import ROOT
+            ROOT.gInterpreter.Declare(
+                "int multiProcessUserValue = %s;" % value)
+
+        DistRDF.initialize(init, 123)
+        df = MultiProcess.RDataFrame(4, nworkers=2)
+        histo = df.Define("u", "multiProcessUserValue").Histo1D("u")
+        self.assertEqual(histo.GetMean(), 123)
+        DistRDF.initialize(lambda: None)
+
+
+if __name__ == "__main__":
+    unittest.main()
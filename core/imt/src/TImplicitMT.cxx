@@ -20,6 +20,7 @@
 
 #include "TError.h"
 #include "ROOT/RTaskArena.hxx"
+#include "ROOT/TThreadExecutor.hxx"
 #include <atomic>
 
 static std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> &R__GetTaskArena4IMT()
@@ -79,3 +80,11 @@ extern "C" bool ROOT_TImplicitMT_IsParBranchProcessingEnabled()
 {
    return GetParBranchProcessingCount() > 0;
 };
+
+/// Call func(arg, i) for each i in [0, n) in the task arena of the implicit multi-threading.
+/// Used by the libraries that cannot link libImt, e.g. libRIO.
+extern "C" void ROOT_TImplicitMT_ParallelFor(UInt_t n, void (*func)(void *, UInt_t), void *arg)
+{
+   ROOT::TThreadExecutor pool;
+   pool.Foreach([func, arg](UInt_t i) { func(arg, i); }, ROOT::TSeq<UInt_t>(n));
+};
@@ -0,0 +1,73 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBufferPool
+#define ROOT_RBufferPool
+
+#include "RtypesCore.h"
+
+class TBuffer;
+class TBufferFile;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RBufferPool RBufferPool.hxx
+ * \ingroup IO
+ *
+ * A process-wide pool of the memory blocks used as I/O buffers, e.g. by the
+ * baskets of a TTree (the buffers of TBasket and the unzipped baskets of
+ * TTreeCacheUnzip), to avoid allocating and freeing a block for every basket
+ * read.
+ *
+ * The blocks are sorted in size classes, four per power of two between 1 kB
+ * and 64 MB; larger requests are not pooled. A block released to the pool is
+ * first kept in a small cache of the releasing thread and, when that is full,
+ * in a shared list, up to GetMaxPooledBytes() bytes overall.
+ *
+ * The blocks are allocated with `new char[]`, so that a block which is not
+ * given back to the pool, e.g. because the TBuffer owning it is deleted or
+ * expanded, is simply freed with `delete[]`.
+ */
+class RBufferPool {
+public:
+   /// Counters of the pool activity since the last ResetStats.
+   struct RStats {
+      ULong64_t fHits = 0;     ///< Acquired blocks which were taken from the pool
+      ULong64_t fMisses = 0;   ///< Acquired blocks which had to be allocated
+      ULong64_t fReleased = 0; ///< Released blocks which were kept in the pool
+      ULong64_t fDropped = 0;  ///< Released blocks which were freed because the pool was full
+      Long64_t fPooledBytes = 0; ///< Bytes currently held by the pool
+
+      Double_t GetHitRate() const { return fHits + fMisses ? Double_t(fHits) / (fHits + fMisses) : 0.; }
+   };
+
+   static char *Acquire(Int_t size, Int_t &capacity);
+   static void Release(char *block, Int_t capacity);
+   static Int_t GetBlockSize(Int_t size);
+
+   static void AcquireBuffer(TBuffer &buffer, Int_t size);
+   static void ReleaseBuffer(TBuffer &buffer);
+   static TBufferFile *NewReadBuffer(Int_t size);
+
+   static void SetMaxPooledBytes(Long64_t maxbytes);
+   static Long64_t GetMaxPooledBytes();
+   static void Clear();
+
+   static RStats GetStats();
+   static void ResetStats();
+   static void Print();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -15,12 +15,19 @@
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <RConfigure.h> // for R__HAS_URING
+
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
+#ifdef R__HAS_URING
+class RIoUring;
+#endif
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
@@ -31,6 +38,11 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+#ifdef R__HAS_URING
+   /// Created on the first vector read and reused for the following ones, so that the ring setup cost
+   /// is not paid for every ReadV() call
+   std::unique_ptr<RIoUring> fIoUring;
+#endif
 
 protected:
    void OpenImpl() final;
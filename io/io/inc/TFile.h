@@ -22,7 +22,10 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Compression.h"
 #include "TDirectoryFile.h"
@@ -112,6 +115,10 @@ protected:
 
    TList           *fInfoCache{nullptr};      ///<!Cached list of the streamer infos in this file
    TList           *fOpenPhases{nullptr};     ///<!Time info about open phases
+   std::shared_ptr<void> fMapping;            ///<!Read-only memory mapping of the whole file, see GetMappedBuffer
+   Long64_t         fMapSize{0};              ///<!Size of fMapping in bytes
+   Bool_t           fMapFailed{kFALSE};       ///<!True if the file cannot be mapped
+   std::vector<std::pair<void *, void (*)(void *)>> fAsyncWriters; ///<!Objects still writing asynchronously to this file, see AddAsyncWriter
 
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
@@ -132,6 +139,7 @@ protected:
    static std::atomic<Int_t>     fgReadCalls;             ///<Number of bytes read from all TFile objects
    static Int_t     fgReadaheadSize;         ///<Readahead buffer size
    static Bool_t    fgReadInfo;              ///<if true (default) ReadStreamerInfo is called when opening a file
+   static Bool_t    fgMapReading;            ///<if true, local files opened for reading are read through a memory mapping
 
    virtual EAsyncOpenStatus GetAsyncOpenStatus() { return fAsyncOpenStatus; }
    virtual void        Init(Bool_t create);
@@ -197,6 +205,7 @@ public:
    TFile(const char *fname, Option_t *option="", const char *ftitle="", Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
    virtual ~TFile();
 
+           void        AddAsyncWriter(void *writer, void (*wait)(void *));
            void        Close(Option_t *option="") override; // *MENU*
            void        Copy(TObject &) const override { MayNotUse("Copy(TObject &)"); }
    virtual Bool_t      Cp(const char *dst, Bool_t progressbar = kTRUE,UInt_t buffersize = 1000000);
@@ -251,6 +260,7 @@ public:
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
            Bool_t      IsRaw() const { return !fIsRootFile; }
    virtual Bool_t      IsOpen() const;
+           Bool_t      IsReadMapped();
            void        ls(Option_t *option="") const override;
    virtual void        MakeFree(Long64_t first, Long64_t last);
    virtual void        MakeProject(const char *dirname, const char *classes="*",
@@ -265,7 +275,9 @@ public:
    virtual Bool_t      ReadBuffer(char *buf, Int_t len);
    virtual Bool_t      ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Bool_t      ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+           char       *GetMappedBuffer(Long64_t pos, Int_t len, std::shared_ptr<void> &mapping);
    virtual void        ReadFree();
+           void        RemoveAsyncWriter(void *writer);
    virtual TProcessID *ReadProcessID(UShort_t pidf);
    virtual void        ReadStreamerInfo();
    virtual Int_t       Recover();
@@ -317,6 +329,8 @@ public:
    static void         SetReadaheadSize(Int_t bufsize = 256000);
    static void         SetReadStreamerInfo(Bool_t readinfo=kTRUE);
    static Bool_t       GetReadStreamerInfo();
+   static void         SetMapReading(Bool_t map = kTRUE);
+   static Bool_t       GetMapReading();
 
    static Long64_t     GetFileCounter();
    static void         IncrementFileCounter();
@@ -0,0 +1,343 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RBufferPool.hxx"
+
+#include "TBufferFile.h"
+#include "TStorage.h"
+#include "TString.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// Same as the slack TBuffer keeps at the end of the blocks it allocates itself.
+constexpr Int_t kExtraSpace = 8;
+
+// Four size classes per power of two, from 2^kMinShift up to 2^kMaxShift bytes.
+constexpr Int_t kMinShift = 10;
+constexpr Int_t kMaxShift = 26;
+constexpr Int_t kNClasses = 4 * (kMaxShift - kMinShift) + 1;
+
+// Only the classes up to this size are cached per thread; bigger blocks go to the shared lists.
+constexpr Int_t kMaxThreadCacheSize = 4 * 1024 * 1024;
+constexpr Int_t kThreadCacheSlots = 2;
+
+constexpr Long64_t kDefaultMaxPooledBytes = 128 * 1024 * 1024;
+
+std::array<Int_t, kNClasses> MakeClassSizes()
+{
+   std::array<Int_t, kNClasses> sizes;
+   for (Int_t shift = kMinShift, cls = 0; shift < kMaxShift; ++shift) {
+      const Int_t base = 1 << shift;
+      for (Int_t quarter = 0; quarter < 4; ++quarter)
+         sizes[cls++] = base + quarter * (base / 4);
+   }
+   sizes[kNClasses - 1] = 1 << kMaxShift;
+   return sizes;
+}
+
+const std::array<Int_t, kNClasses> &GetClassSizes()
+{
+   static const std::array<Int_t, kNClasses> sizes = MakeClassSizes();
+   return sizes;
+}
+
+/// Smallest class holding at least `size` bytes, or -1 if `size` is too large to be pooled.
+Int_t GetClassAbove(Int_t size)
+{
+   const auto &sizes = GetClassSizes();
+   auto it = std::lower_bound(sizes.begin(), sizes.end(), size);
+   return it == sizes.end() ? -1 : Int_t(it - sizes.begin());
+}
+
+/// Largest class a block of `capacity` bytes can serve, or -1 if it is too small or too large to be pooled.
+Int_t GetClassBelow(Int_t capacity)
+{
+   const auto &sizes = GetClassSizes();
+   if (capacity > sizes.back())
+      return -1;
+   auto it = std::upper_bound(sizes.begin(), sizes.end(), capacity);
+   return it == sizes.begin() ? -1 : Int_t(it - sizes.begin()) - 1;
+}
+
+struct RSharedPool {
+   std::mutex fMutex;                         ///< Protects fBlocks
+   std::vector<char *> fBlocks[kNClasses];    ///< Blocks released by the threads whose cache was full
+   std::atomic<Long64_t> fPooledBytes{0};     ///< Bytes held in fBlocks and in the thread caches
+   std::atomic<Long64_t> fMaxPooledBytes{kDefaultMaxPooledBytes};
+   std::atomic<ULong64_t> fHits{0};
+   std::atomic<ULong64_t> fMisses{0};
+   std::atomic<ULong64_t> fReleased{0};
+   std::atomic<ULong64_t> fDropped{0};
+
+   char *Pop(Int_t cls)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fBlocks[cls].empty())
+         return nullptr;
+      char *block = fBlocks[cls].back();
+      fBlocks[cls].pop_back();
+      return block;
+   }
+
+   void Push(Int_t cls, char *block)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fBlocks[cls].push_back(block);
+   }
+
+   void Clear()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      const auto &sizes = GetClassSizes();
+      for (Int_t cls = 0; cls < kNClasses; ++cls) {
+         for (char *block : fBlocks[cls]) {
+            delete[] block;
+            fPooledBytes -= sizes[cls];
+         }
+         fBlocks[cls].clear();
+      }
+   }
+};
+
+// Never deleted: baskets and thread caches may give back blocks during the tear down.
+RSharedPool &GetSharedPool()
+{
+   static RSharedPool *pool = new RSharedPool;
+   return *pool;
+}
+
+// Trivially destructible, hence still usable after the thread cache is destroyed at thread exit.
+thread_local bool gThreadCacheDestroyed = false;
+
+struct RThreadCache {
+   char *fBlocks[kNClasses][kThreadCacheSlots] = {};
+   Int_t fNBlocks[kNClasses] = {};
+
+   ~RThreadCache()
+   {
+      gThreadCacheDestroyed = true;
+      Flush();
+   }
+
+   /// Move the cached blocks to the shared pool.
+   void Flush()
+   {
+      auto &pool = GetSharedPool();
+      for (Int_t cls = 0; cls < kNClasses; ++cls) {
+         while (fNBlocks[cls])
+            pool.Push(cls, fBlocks[cls][--fNBlocks[cls]]);
+      }
+   }
+};
+
+/// The cache of the calling thread, or nullptr if the thread is exiting.
+RThreadCache *GetThreadCache()
+{
+   if (gThreadCacheDestroyed)
+      return nullptr;
+   thread_local RThreadCache cache;
+   return &cache;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a block of at least `size` bytes, taken from the pool if possible.
+/// `capacity` is set to the usable size of the block, which is followed by
+/// a few bytes of slack as for the blocks allocated by TBuffer.
+/// The block must be given back with Release or freed with `delete[]`.
+
+char *ROOT::Internal::RBufferPool::Acquire(Int_t size, Int_t &capacity)
+{
+   auto &pool = GetSharedPool();
+   const Int_t cls = GetClassAbove(size);
+   if (cls < 0) {
+      ++pool.fMisses;
+      capacity = size;
+      return new char[(Long64_t)size + kExtraSpace];
+   }
+   capacity = GetClassSizes()[cls];
+
+   char *block = nullptr;
+   if (capacity <= kMaxThreadCacheSize) {
+      auto cache = GetThreadCache();
+      if (cache && cache->fNBlocks[cls])
+         block = cache->fBlocks[cls][--cache->fNBlocks[cls]];
+   }
+   if (!block)
+      block = pool.Pop(cls);
+   if (block) {
+      ++pool.fHits;
+      pool.fPooledBytes -= capacity;
+      return block;
+   }
+   ++pool.fMisses;
+   return new char[capacity + kExtraSpace];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back to the pool a block allocated with `new char[]`, of at least
+/// `capacity` bytes followed by the slack of TBuffer (e.g. one obtained from
+/// Acquire). The block is freed if it cannot be pooled.
+
+void ROOT::Internal::RBufferPool::Release(char *block, Int_t capacity)
+{
+   if (!block)
+      return;
+   auto &pool = GetSharedPool();
+   const Int_t cls = GetClassBelow(capacity);
+   if (cls < 0) {
+      delete[] block;
+      return;
+   }
+   const Int_t size = GetClassSizes()[cls];
+   if (pool.fPooledBytes.fetch_add(size) + size > pool.fMaxPooledBytes) {
+      pool.fPooledBytes -= size;
+      ++pool.fDropped;
+      delete[] block;
+      return;
+   }
+   ++pool.fReleased;
+   if (size <= kMaxThreadCacheSize) {
+      auto cache = GetThreadCache();
+      if (cache && cache->fNBlocks[cls] < kThreadCacheSlots) {
+         cache->fBlocks[cls][cache->fNBlocks[cls]++] = block;
+         return;
+      }
+   }
+   pool.Push(cls, block);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bytes allocated for a block acquired for `size` bytes,
+/// i.e. its capacity and the slack. A TBuffer in read mode given such a block
+/// should use this as size, so that ReleaseBuffer puts it back in its class.
+
+Int_t ROOT::Internal::RBufferPool::GetBlockSize(Int_t size)
+{
+   const Int_t cls = GetClassAbove(size);
+   return (cls < 0 ? size : GetClassSizes()[cls]) + kExtraSpace;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the memory of `buffer` by a block of at least `size` bytes from
+/// the pool, giving back the previous one (see ReleaseBuffer).
+/// The content of the buffer is not preserved.
+
+void ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer &buffer, Int_t size)
+{
+   ReleaseBuffer(buffer);
+   Int_t capacity;
+   char *block = Acquire(size, capacity);
+   // In write mode TBuffer::SetBuffer keeps the slack aside; in read mode, as
+   // TBuffer::Expand does, the whole block is usable.
+   buffer.SetBuffer(block, capacity + kExtraSpace, kTRUE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back the memory owned by `buffer` to the pool and detach it from the
+/// buffer, which must then be given a new memory block or be deleted.
+/// Buffers which do not own their memory, or which are not allocated with
+/// `new char[]`, are left untouched.
+
+void ROOT::Internal::RBufferPool::ReleaseBuffer(TBuffer &buffer)
+{
+   if (!buffer.Buffer() || !buffer.TestBit(TBuffer::kIsOwner) ||
+       buffer.GetReAllocFunc() != TStorage::ReAllocChar)
+      return;
+   // Only the blocks of the buffers in write mode are known to be followed by the slack.
+   Release(buffer.Buffer(), buffer.IsWriting() ? buffer.BufferSize() : buffer.BufferSize() - kExtraSpace);
+   buffer.DetachBuffer();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a TBufferFile in read mode owning a block of at least `size` bytes
+/// from the pool.
+
+TBufferFile *ROOT::Internal::RBufferPool::NewReadBuffer(Int_t size)
+{
+   Int_t capacity;
+   char *block = Acquire(size, capacity);
+   return new TBufferFile(TBuffer::kRead, capacity + kExtraSpace, block, kTRUE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of bytes kept in the pool, 128 MB by default.
+/// Setting it to 0 disables the pooling: released blocks are freed.
+
+void ROOT::Internal::RBufferPool::SetMaxPooledBytes(Long64_t maxbytes)
+{
+   auto &pool = GetSharedPool();
+   pool.fMaxPooledBytes = maxbytes;
+   if (pool.fPooledBytes > maxbytes)
+      Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of bytes kept in the pool.
+
+Long64_t ROOT::Internal::RBufferPool::GetMaxPooledBytes()
+{
+   return GetSharedPool().fMaxPooledBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Free the blocks held by the pool. The blocks cached by threads other than
+/// the calling one are only freed when these threads exit.
+
+void ROOT::Internal::RBufferPool::Clear()
+{
+   if (auto cache = GetThreadCache())
+      cache->Flush();
+   GetSharedPool().Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the counters of the pool.
+
+ROOT::Internal::RBufferPool::RStats ROOT::Internal::RBufferPool::GetStats()
+{
+   auto &pool = GetSharedPool();
+   RStats stats;
+   stats.fHits = pool.fHits;
+   stats.fMisses = pool.fMisses;
+   stats.fReleased = pool.fReleased;
+   stats.fDropped = pool.fDropped;
+   stats.fPooledBytes = pool.fPooledBytes;
+   return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset the counters of the pool, except the number of pooled bytes.
+
+void ROOT::Internal::RBufferPool::ResetStats()
+{
+   auto &pool = GetSharedPool();
+   pool.fHits = 0;
+   pool.fMisses = 0;
+   pool.fReleased = 0;
+   pool.fDropped = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the counters of the pool.
+
+void ROOT::Internal::RBufferPool::Print()
+{
+   const RStats stats = GetStats();
+   Printf("RBufferPool: %llu hits, %llu misses (hit rate %.1f%%), %llu blocks released, %llu dropped, %lld bytes pooled",
+          stats.fHits, stats.fMisses, 100. * stats.GetHitRate(), stats.fReleased, stats.fDropped, stats.fPooledBytes);
+}
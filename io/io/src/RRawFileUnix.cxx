@@ -52,6 +52,10 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   if (RIoUring::IsAvailable())
+      return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#endif
    return kFeatureHasSize | kFeatureHasMmap;
 }
 
@@ -116,7 +120,8 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
    if (RIoUring::IsAvailable()) {
-      RIoUring ring;
+      if (!fIoUring)
+         fIoUring = std::make_unique<RIoUring>();
       std::vector<RIoUring::RReadEvent> reads;
       reads.reserve(nReq);
       for (std::size_t i = 0; i < nReq; ++i) {
@@ -127,7 +132,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          ev.fFileDes = fFileDes;
          reads.push_back(ev);
       }
-      ring.SubmitReadsAndWait(reads.data(), nReq);
+      fIoUring->SubmitReadsAndWait(reads.data(), nReq);
       for (std::size_t i = 0; i < nReq; ++i) {
          ioVec[i].fOutBytes = reads.at(i).fOutBytes;
       }
@@ -84,6 +84,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include <sys/stat.h>
 #ifndef WIN32
 #   include <unistd.h>
+#   include <sys/mman.h>
 #else
 #   define ssize_t int
 #   include <io.h>
@@ -147,6 +148,7 @@ std::atomic<Long64_t> TFile::fgFileCounter{0};
 std::atomic<Int_t>    TFile::fgReadCalls{0};
 Int_t    TFile::fgReadaheadSize = 256000;
 Bool_t   TFile::fgReadInfo = kTRUE;
+Bool_t   TFile::fgMapReading = kFALSE;
 TList   *TFile::fgAsyncOpenRequests = nullptr;
 TString  TFile::fgCacheFileDir;
 Bool_t   TFile::fgCacheFileForce = kFALSE;
@@ -865,6 +867,37 @@ zombie:
    gDirectory = gROOT;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Register an object still writing data asynchronously to this file, e.g. a
+/// TTree writing its baskets from other threads (see TTree::SetAsyncWrite).
+/// Close calls `wait(writer)`, which must return once all the data of `writer`
+/// is written, before writing the streamer infos and the keys of the file.
+/// The writer is registered until RemoveAsyncWriter is called.
+
+void TFile::AddAsyncWriter(void *writer, void (*wait)(void *))
+{
+#ifdef R__USE_IMT
+   std::lock_guard<std::mutex> lock(fWriteMutex);
+#endif
+   fAsyncWriters.emplace_back(writer, wait);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unregister an object registered with AddAsyncWriter.
+
+void TFile::RemoveAsyncWriter(void *writer)
+{
+#ifdef R__USE_IMT
+   std::lock_guard<std::mutex> lock(fWriteMutex);
+#endif
+   for (auto it = fAsyncWriters.begin(); it != fAsyncWriters.end(); ++it) {
+      if (it->first == writer) {
+         fAsyncWriters.erase(it);
+         return;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Close a file.
 ///
@@ -896,6 +929,18 @@ void TFile::Close(Option_t *option)
       return;
    }
 
+   // Let the asynchronous writers finish writing to the file before the keys are saved. The
+   // waits run without the lock: they unregister their writer.
+   decltype(fAsyncWriters) asyncWriters;
+   {
+#ifdef R__USE_IMT
+      std::lock_guard<std::mutex> lock(fWriteMutex);
+#endif
+      asyncWriters = fAsyncWriters;
+   }
+   for (auto &writer : asyncWriters)
+      writer.second(writer.first);
+
    if (IsWritable()) {
       WriteStreamerInfo();
    }
@@ -941,6 +986,11 @@ void TFile::Close(Option_t *option)
       fFree->Delete();
    }
 
+   // The memory mapping lives on as long as the readers hold it (see GetMappedBuffer).
+   fMapping.reset();
+   fMapSize = 0;
+   fMapFailed = kFALSE;
+
    if (IsOpen()) {
       SysClose(fD);
       fD = -1;
@@ -1797,6 +1847,82 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the file is read through a memory mapping, see
+/// TFile::GetMappedBuffer. The file is mapped on the first call.
+
+Bool_t TFile::IsReadMapped()
+{
+#ifndef WIN32
+   if (!fgMapReading || fMapFailed)
+      return kFALSE;
+   if (fMapping)
+      return kTRUE;
+
+   struct stat st;
+   if (!IsOpen() || IsWritable() || fD < 0 || IsA() != TFile::Class() || fstat(fD, &st) != 0 || st.st_size <= 0) {
+      fMapFailed = kTRUE;
+      return kFALSE;
+   }
+   size_t size = st.st_size;
+   void *region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fD, 0);
+   if (region == MAP_FAILED) {
+      SysError("IsReadMapped", "cannot map file %s, reading it instead", GetName());
+      fMapFailed = kTRUE;
+      return kFALSE;
+   }
+   fMapping = std::shared_ptr<void>(region, [size](void *p) { munmap(p, size); });
+   fMapSize = size;
+   return kTRUE;
+#else
+   return kFALSE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the len bytes at position pos in the file, read
+/// through a memory mapping of the whole file instead of being copied, or
+/// nullptr if this is not possible.
+///
+/// The file is mapped on the first call, provided that mapped reading is
+/// enabled (see TFile::SetMapReading) and that this is a plain local file
+/// opened for reading. The pages are mapped copy-on-write: modifying the
+/// returned memory does not modify the file. mapping is set to a handle of
+/// the mapping: the returned memory stays valid as long as the handle is kept,
+/// even after the file is closed.
+
+char *TFile::GetMappedBuffer(Long64_t pos, Int_t len, std::shared_ptr<void> &mapping)
+{
+#ifndef WIN32
+   if (!IsReadMapped())
+      return nullptr;
+
+   pos += fArchiveOffset;
+   if (pos < 0 || len < 0 || pos + len > fMapSize)
+      return nullptr;
+
+   Double_t start = 0;
+   if (gPerfStats) start = TTimeStamp();
+   fBytesRead  += len;
+   fgBytesRead += len;
+   fReadCalls++;
+   fgReadCalls++;
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   if (gPerfStats) {
+      gPerfStats->FileReadEvent(this, len, start);
+   }
+
+   mapping = fMapping;
+   return static_cast<char *>(fMapping.get()) + pos;
+#else
+   (void)pos;
+   (void)len;
+   (void)mapping;
+   return nullptr;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read buffer via cache.
 ///
@@ -2091,6 +2217,10 @@ Int_t TFile::ReOpen(Option_t *mode)
    if (opt == fOption || (opt == "UPDATE" && fOption == "CREATE"))
       return 1;
 
+   fMapping.reset();
+   fMapSize = 0;
+   fMapFailed = kFALSE;
+
    if (opt == "READ") {
       // switch to READ mode
 
@@ -3659,6 +3789,33 @@ Bool_t TFile::GetReadStreamerInfo()
    return fgReadInfo;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Specify if local files opened for reading are read through a memory mapping.
+///
+/// When enabled, the baskets of the TTrees are read directly from the mapped
+/// pages of the file (see TFile::GetMappedBuffer): compressed baskets are
+/// uncompressed from the mapping, uncompressed ones are used in place, without
+/// any copy. This avoids copies and allocations when scanning files which are
+/// on a local disk or in the page cache. Baskets read through a TTreeCache
+/// still go through the cache: set its size to 0 (e.g. TTree::SetCacheSize(0))
+/// to read through the mapping.
+/// This is not supported on Windows.
+
+void TFile::SetMapReading(Bool_t map)
+{
+   fgMapReading = map;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// If local files opened for reading are read through a memory mapping.
+///
+/// See TFile::SetMapReading for more documentation.
+
+Bool_t TFile::GetMapReading()
+{
+   return fgMapReading;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Show the StreamerInfo of all classes written to this file.
 
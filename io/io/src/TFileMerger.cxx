@@ -20,6 +20,10 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+If implicit multi-threading is enabled (see ROOT::EnableImplicitMT), the input
+files are opened concurrently and, when histograms are merged in one go, the
+histograms of all the input files are read concurrently.
 */
 
 #include "TFileMerger.h"
@@ -48,7 +52,10 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
 #include <cstring>
+#include <type_traits>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -84,6 +91,57 @@ static Int_t R__GetSystemMaxOpenedFiles()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of input files that are opened and read at the same time:
+/// the size of the implicit multi-threading pool if it is enabled, 1 otherwise.
+
+static UInt_t R__GetMergeConcurrency()
+{
+   return ROOT::IsImplicitMTEnabled() ? std::max(ROOT::GetThreadPoolSize(), 1u) : 1u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(i) for each i in [0, n), as tasks of the implicit multi-threading
+/// pool if it is enabled, sequentially otherwise.
+///
+/// libRIO cannot depend on libImt, hence the tasks are submitted through a function
+/// of libImt looked up at run time, as TROOT does to enable implicit multi-threading.
+
+template <typename F>
+static void R__ParallelFor(std::size_t n, F &&func)
+{
+   using Func_t = typename std::decay<F>::type;
+   using ParallelFor_t = void (*)(UInt_t, void (*)(void *, UInt_t), void *);
+   if (R__GetMergeConcurrency() > 1 && n > 1) {
+      // libImt is loaded once implicit multi-threading is enabled
+      static const auto parallelFor =
+         reinterpret_cast<ParallelFor_t>(gSystem->DynFindSymbol(nullptr, "ROOT_TImplicitMT_ParallelFor"));
+      if (parallelFor) {
+         parallelFor(n, [](void *f, UInt_t i) { (*static_cast<Func_t *>(f))(i); }, &func);
+         return;
+      }
+   }
+   for (std::size_t i = 0; i < n; ++i)
+      func(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove from the list of excess files the TFiles that wait there behind files
+/// added by name (see AddFile(TFile*, Bool_t, Bool_t)): as the ones in fFileList,
+/// they are not deleted with the list.
+
+static void R__RemoveExcessTFiles(TList &excessFiles)
+{
+   std::vector<TObject *> files;
+   TIter next(&excessFiles);
+   while (TObject *obj = next()) {
+      if (obj->InheritsFrom(TFile::Class()))
+         files.push_back(obj);
+   }
+   for (TObject *file : files)
+      excessFiles.Remove(file);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create file merger object.
 
@@ -108,6 +166,7 @@ TFileMerger::~TFileMerger()
       gROOT->GetListOfCleanups()->Remove(this);
    }
    SafeDelete(fOutputFile);
+   R__RemoveExcessTFiles(fExcessFiles);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -117,12 +176,20 @@ void TFileMerger::Reset()
 {
    fFileList.Clear();
    fMergeList.Clear();
+   R__RemoveExcessTFiles(fExcessFiles);
    fExcessFiles.Clear();
    fObjectNames.Clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Add file to file merger.
+///
+/// If implicit multi-threading is enabled, or if the maximum number of opened
+/// files is reached, the file is only opened when merging (all the files that
+/// are waiting to be opened are then opened concurrently). With implicit
+/// multi-threading, kFALSE is nevertheless returned if the file cannot be read.
+/// In all cases, the files are merged in the order in which they are added,
+/// also by AddFile(TFile*) and AddAdoptFile.
 
 Bool_t TFileMerger::AddFile(const char *url, Bool_t cpProgress)
 {
@@ -133,7 +200,15 @@ Bool_t TFileMerger::AddFile(const char *url, Bool_t cpProgress)
    TFile *newfile = 0;
    TString localcopy;
 
-   if (fFileList.GetEntries() >= (fMaxOpenedFiles-1)) {
+   // With implicit multi-threading enabled, the files are opened concurrently when the merge starts.
+   const Bool_t concurrentOpen = R__GetMergeConcurrency() > 1;
+   if (fFileList.GetEntries() >= (fMaxOpenedFiles-1) || concurrentOpen) {
+
+      // Still report the files that cannot be read, as the callers (e.g. hadd) rely on it
+      if (concurrentOpen && gSystem->AccessPathName(url, kReadPermission)) {
+         Error("AddFile", "cannot open file %s", url);
+         return kFALSE;
+      }
 
       TObjString *urlObj = new TObjString(url);
       fMergeList.Add(urlObj);
@@ -220,7 +295,7 @@ Bool_t TFileMerger::AddFile(TFile *source, Bool_t own, Bool_t cpProgress)
    }
 
    if (fPrintLevel > 0) {
-      Printf("%s Source file %d: %s",fMsgPrefix.Data(),fFileList.GetEntries()+1,source->GetName());
+      Printf("%s Source file %d: %s",fMsgPrefix.Data(),fFileList.GetEntries()+fExcessFiles.GetEntries()+1,source->GetName());
    }
 
    TFile *newfile = 0;
@@ -260,7 +335,12 @@ Bool_t TFileMerger::AddFile(TFile *source, Bool_t own, Bool_t cpProgress)
       } else {
          newfile->ResetBit(kCanDelete);
       }
-      fFileList.Add(newfile);
+      // Files added by name before this one might not be opened yet (see AddFile(const char*, Bool_t)):
+      // keep the order in which the files were added, which is the order of the merged entries.
+      if (fExcessFiles.GetEntries() > 0)
+         fExcessFiles.Add(newfile);
+      else
+         fFileList.Add(newfile);
 
       TObjString *urlObj = new TObjString(source->GetName());
       fMergeList.Add(urlObj);
@@ -594,6 +674,46 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                   ROOT::MergeFunc_t func = cl->GetMerge();
                   func(obj, &inputs, &info);
                   info.fIsFirst = kFALSE;
+               } else if (oneGo && R__GetMergeConcurrency() > 1) {
+                  // Read (and decompress) the objects of all the other sources concurrently, one source per
+                  // task, then merge them in one go as usual.
+                  std::vector<TFile *> sources;
+                  for (; nextsource; nextsource = (TFile*)sourcelist->After(nextsource))
+                     sources.push_back(nextsource);
+                  std::vector<TObject *> hobjs(sources.size(), nullptr);
+                  std::vector<char> found(sources.size(), kFALSE);
+                  R__ParallelFor(sources.size(), [&](std::size_t i) {
+                     TDirectory::TContext ctxt;
+                     TDirectory *ndir = sources[i]->GetDirectory(path);
+                     if (!ndir)
+                        return;
+                     ndir->cd();
+                     TKey *key2 = (TKey*)ndir->GetListOfKeys()->FindObject(key->GetName());
+                     if (!key2)
+                        return;
+                     found[i] = kTRUE;
+                     hobjs[i] = key2->ReadObj();
+                  });
+                  for (std::size_t i = 0; i < sources.size(); ++i) {
+                     TObject *hobj = hobjs[i];
+                     if (!found[i])
+                        continue;
+                     if (!hobj) {
+                        Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+                             key->GetName(), key->GetTitle(), sources[i]->GetName());
+                        continue;
+                     }
+                     // Set ownership for collections
+                     if (hobj->InheritsFrom(TCollection::Class())) {
+                        ((TCollection*)hobj)->SetOwner();
+                     }
+                     hobj->ResetBit(kMustCleanup);
+                     inputs.Add(hobj);
+                  }
+                  ROOT::MergeFunc_t func = cl->GetMerge();
+                  func(obj, &inputs, &info);
+                  info.fIsFirst = kFALSE;
+                  inputs.Delete();
                } else {
                   do {
                      // make sure we are at the correct directory level by cd'ing to path
@@ -825,6 +945,14 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
       }
    }
 
+   // The input files added by name may not have been opened yet (see AddFile).
+   if (fFileList.GetEntries() == 0 && fExcessFiles.GetEntries() > 0) {
+      if (!OpenExcessFiles()) {
+         Error("PartialMerge", "could not open the input files");
+         return kFALSE;
+      }
+   }
+
    // Special treament for the single file case ...
    if ((fFileList.GetEntries() == 1) && !fExcessFiles.GetEntries() &&
       !(in_type & kIncremental) && !fCompressionChange && !fExplicitCompLevel) {
@@ -911,49 +1039,88 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Open up to fMaxOpenedFiles of the excess files.
+///
+/// If implicit multi-threading is enabled, the files are copied (see fLocal) and
+/// opened concurrently.
 
 Bool_t TFileMerger::OpenExcessFiles()
 {
    if (fPrintLevel > 0) {
       Printf("%s Opening the next %d files", fMsgPrefix.Data(), TMath::Min(fExcessFiles.GetEntries(), fMaxOpenedFiles - 1));
    }
-   Int_t nfiles = 0;
+   // The excess files are the TObjString of the files added by name and the TFiles added after them.
+   std::vector<TObject *> urls;
    TIter next(&fExcessFiles);
-   TObjString *url = 0;
-   TString localcopy;
-   // We want gDirectory untouched by anything going on here
-   TDirectory::TContext ctxt;
-   while( nfiles < (fMaxOpenedFiles-1) && ( url = (TObjString*)next() ) ) {
-      TFile *newfile = 0;
+   TObject *url = 0;
+   while ((Int_t)urls.size() < (fMaxOpenedFiles-1) && ( url = next() ) ) {
+      urls.push_back(url);
+   }
+
+   // Error messages are only printed for the first file that fails, as the files are then added in order.
+   std::vector<TFile *> newfiles(urls.size(), nullptr);
+   std::vector<char> added(urls.size(), kFALSE); // not std::vector<bool>, which cannot be written concurrently
+   for (std::size_t i = 0; i < urls.size(); ++i) {
+      if (urls[i]->InheritsFrom(TFile::Class())) {
+         newfiles[i] = static_cast<TFile *>(urls[i]);
+         added[i] = kTRUE;
+      }
+   }
+   std::vector<TString> localcopies(urls.size());
+   std::vector<char> copied(urls.size(), kTRUE);
+   R__ParallelFor(urls.size(), [&](std::size_t i) {
+      if (added[i])
+         return;
+      // We want gDirectory untouched by anything going on here
+      TDirectory::TContext ctxt;
       if (fLocal) {
          TUUID uuid;
-         localcopy.Form("file:%s/ROOTMERGE-%s.root", gSystem->TempDirectory(), uuid.AsString());
-         if (!TFile::Cp(url->GetName(), localcopy, url->TestBit(kCpProgress))) {
-            Error("OpenExcessFiles", "cannot get a local copy of file %s", url->GetName());
-            return kFALSE;
+         localcopies[i].Form("file:%s/ROOTMERGE-%s.root", gSystem->TempDirectory(), uuid.AsString());
+         if (!TFile::Cp(urls[i]->GetName(), localcopies[i], urls[i]->TestBit(kCpProgress))) {
+            copied[i] = kFALSE;
+            return;
          }
-         newfile = TFile::Open(localcopy, "READ");
+         newfiles[i] = TFile::Open(localcopies[i], "READ");
       } else {
-         newfile = TFile::Open(url->GetName(), "READ");
+         newfiles[i] = TFile::Open(urls[i]->GetName(), "READ");
       }
+      // Zombie files should also be skipped
+      if (newfiles[i] && newfiles[i]->IsZombie()) {
+         delete newfiles[i];
+         newfiles[i] = nullptr;
+      }
+   });
 
-      if (!newfile) {
+   Bool_t status = kTRUE;
+   for (std::size_t i = 0; i < urls.size(); ++i) {
+      TFile *newfile = newfiles[i];
+      if (!status) {
+         // A previous file could not be opened: the merge stops, drop the files opened in the meantime.
+         if (!added[i])
+            delete newfile;
+         continue;
+      }
+      if (!copied[i]) {
+         Error("OpenExcessFiles", "cannot get a local copy of file %s", urls[i]->GetName());
+         status = kFALSE;
+      } else if (!newfile) {
          if (fLocal)
             Error("OpenExcessFiles", "cannot open local copy %s of URL %s",
-                  localcopy.Data(), url->GetName());
+                  localcopies[i].Data(), urls[i]->GetName());
          else
-            Error("OpenExcessFiles", "cannot open file %s", url->GetName());
-         return kFALSE;
+            Error("OpenExcessFiles", "cannot open file %s", urls[i]->GetName());
+         status = kFALSE;
       } else {
          if (fOutputFile && fOutputFile->GetCompressionLevel() != newfile->GetCompressionLevel()) fCompressionChange = kTRUE;
 
-         newfile->SetBit(kCanDelete);
          fFileList.Add(newfile);
-         ++nfiles;
-         fExcessFiles.Remove(url);
+         fExcessFiles.Remove(urls[i]);
+         if (!added[i]) {
+            newfile->SetBit(kCanDelete);
+            delete urls[i];
+         }
       }
    }
-   return kTRUE;
+   return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,113 @@
+#include "ROOT/RBufferPool.hxx"
+
+#include "TBufferFile.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <thread>
+
+using ROOT::Internal::RBufferPool;
+
+class RBufferPoolTest : public ::testing::Test {
+protected:
+   void SetUp() override
+   {
+      RBufferPool::Clear();
+      RBufferPool::ResetStats();
+   }
+   void TearDown() override
+   {
+      RBufferPool::SetMaxPooledBytes(128 * 1024 * 1024);
+      RBufferPool::Clear();
+   }
+};
+
+TEST_F(RBufferPoolTest, AcquireRelease)
+{
+   Int_t capacity = 0;
+   char *block = RBufferPool::Acquire(5000, capacity);
+   ASSERT_NE(block, nullptr);
+   EXPECT_GE(capacity, 5000);
+   EXPECT_LE(capacity, 5000 * 5 / 4);
+   RBufferPool::Release(block, capacity);
+
+   // A request of the same size class gets the block back.
+   Int_t capacity2 = 0;
+   char *block2 = RBufferPool::Acquire(capacity - 10, capacity2);
+   EXPECT_EQ(block2, block);
+   EXPECT_EQ(capacity2, capacity);
+   RBufferPool::Release(block2, capacity2);
+
+   auto stats = RBufferPool::GetStats();
+   EXPECT_EQ(stats.fHits, 1u);
+   EXPECT_EQ(stats.fMisses, 1u);
+   EXPECT_EQ(stats.fReleased, 2u);
+   EXPECT_EQ(stats.fDropped, 0u);
+   EXPECT_EQ(stats.fPooledBytes, capacity);
+   EXPECT_DOUBLE_EQ(stats.GetHitRate(), 0.5);
+
+   // A larger request cannot be served by that block.
+   Int_t capacity3 = 0;
+   char *block3 = RBufferPool::Acquire(2 * capacity, capacity3);
+   EXPECT_NE(block3, block);
+   RBufferPool::Release(block3, capacity3);
+}
+
+TEST_F(RBufferPoolTest, ReleaseFromOtherThread)
+{
+   Int_t capacity = 0;
+   char *block = nullptr;
+   std::thread producer([&]() { block = RBufferPool::Acquire(100000, capacity); });
+   producer.join();
+   RBufferPool::Release(block, capacity);
+   std::thread consumer([&]() {
+      Int_t capacity2 = 0;
+      char *block2 = RBufferPool::Acquire(100000, capacity2);
+      RBufferPool::Release(block2, capacity2);
+   });
+   consumer.join();
+   // The block stays in the cache of the main thread.
+   EXPECT_EQ(RBufferPool::GetStats().fHits, 0u);
+   Int_t capacity3 = 0;
+   EXPECT_EQ(RBufferPool::Acquire(100000, capacity3), block);
+   RBufferPool::Release(block, capacity3);
+}
+
+TEST_F(RBufferPoolTest, MaxPooledBytes)
+{
+   RBufferPool::SetMaxPooledBytes(0);
+   Int_t capacity = 0;
+   char *block = RBufferPool::Acquire(5000, capacity);
+   RBufferPool::Release(block, capacity);
+   auto stats = RBufferPool::GetStats();
+   EXPECT_EQ(stats.fReleased, 0u);
+   EXPECT_EQ(stats.fDropped, 1u);
+   EXPECT_EQ(stats.fPooledBytes, 0);
+}
+
+TEST_F(RBufferPoolTest, Buffers)
+{
+   std::unique_ptr<TBufferFile> buffer(RBufferPool::NewReadBuffer(20000));
+   EXPECT_TRUE(buffer->IsReading());
+   EXPECT_EQ(buffer->BufferSize(), RBufferPool::GetBlockSize(20000));
+   char *block = buffer->Buffer();
+
+   // Growing the buffer gives back the previous block to the pool.
+   RBufferPool::AcquireBuffer(*buffer, 40000);
+   EXPECT_GE(buffer->BufferSize(), 40000);
+   EXPECT_EQ(RBufferPool::GetStats().fReleased, 1u);
+   std::unique_ptr<TBufferFile> buffer2(RBufferPool::NewReadBuffer(20000));
+   EXPECT_EQ(buffer2->Buffer(), block);
+
+   RBufferPool::ReleaseBuffer(*buffer);
+   EXPECT_EQ(buffer->Buffer(), nullptr);
+   EXPECT_EQ(RBufferPool::GetStats().fReleased, 2u);
+
+   // Buffers not owning their memory are left alone.
+   char external[2048];
+   TBufferFile view(TBuffer::kRead, sizeof(external), external, kFALSE);
+   RBufferPool::ReleaseBuffer(view);
+   EXPECT_EQ(view.Buffer(), external);
+   EXPECT_EQ(RBufferPool::GetStats().fReleased, 2u);
+}
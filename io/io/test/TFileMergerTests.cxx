@@ -2,9 +2,16 @@
 
 #include "TFileMerger.h"
 
+#include "TFile.h"
+#include "TH1F.h"
 #include "TMemFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <string>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +75,101 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+#ifdef R__USE_IMT
+TEST(TFileMerger, MergeHistogramsConcurrently)
+{
+   const int nFiles = 8;
+   std::vector<std::string> fileNames;
+   for (int i = 0; i < nFiles; ++i) {
+      fileNames.emplace_back("TFileMergerConcurrent" + std::to_string(i) + ".root");
+      TFile f(fileNames.back().c_str(), "RECREATE");
+      TH1F h("h", "h", 10, 0, 10);
+      h.SetDirectory(nullptr);
+      for (int j = 0; j <= i; ++j)
+         h.Fill(i);
+      f.WriteObject(&h, "h");
+      TH1F h2("h2", "h2", 10, 0, 10);
+      h2.SetDirectory(nullptr);
+      h2.Fill(1);
+      f.mkdir("dir")->WriteObject(&h2, "h2");
+      f.Close();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   {
+      TFileMerger merger(/*isLocal=*/false);
+      merger.SetMaxOpenedFiles(4); // the inputs are opened in two batches
+      for (const auto &fileName : fileNames)
+         ASSERT_TRUE(merger.AddFile(fileName.c_str(), /*cpProgress=*/false));
+      // The inputs are opened when merging, but the unreadable ones are still reported
+      ROOT_EXPECT_ERROR(EXPECT_FALSE(merger.AddFile("TFileMergerConcurrentMissing.root", /*cpProgress=*/false)),
+                        "TFileMerger::AddFile", "cannot open file TFileMergerConcurrentMissing.root");
+      ASSERT_TRUE(merger.OutputFile("TFileMergerConcurrentOut.root", "RECREATE"));
+      EXPECT_TRUE(merger.Merge());
+   }
+   ROOT::DisableImplicitMT();
+
+   TFile out("TFileMergerConcurrentOut.root");
+   auto h = out.Get<TH1F>("h");
+   ASSERT_TRUE(h != nullptr);
+   EXPECT_EQ(h->GetEntries(), nFiles * (nFiles + 1) / 2);
+   for (int i = 0; i < nFiles; ++i)
+      EXPECT_EQ(h->GetBinContent(i + 1), i + 1);
+   auto h2 = out.Get<TH1F>("dir/h2");
+   ASSERT_TRUE(h2 != nullptr);
+   EXPECT_EQ(h2->GetEntries(), nFiles);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+   gSystem->Unlink("TFileMergerConcurrentOut.root");
+}
+
+TEST(TFileMerger, KeepInputOrderWithConcurrentOpen)
+{
+   // Files added by name are opened when the merge starts: the TFiles added after them must be merged after them.
+   auto writeFile = [](const std::string &fileName, double value) {
+      TFile f(fileName.c_str(), "RECREATE");
+      auto t = new TTree("t", "t");
+      t->SetImplicitMT(false);
+      t->Branch("x", &value);
+      t->Fill();
+      f.Write();
+      f.Close();
+   };
+   const std::vector<std::string> fileNames{"TFileMergerOrder0.root", "TFileMergerOrder1.root",
+                                            "TFileMergerOrder2.root", "TFileMergerOrder3.root"};
+   for (std::size_t i = 0; i < fileNames.size(); ++i)
+      writeFile(fileNames[i], i);
+
+   ROOT::EnableImplicitMT(4);
+   {
+      TFileMerger merger(/*isLocal=*/false);
+      ASSERT_TRUE(merger.AddFile(fileNames[0].c_str(), /*cpProgress=*/false));
+      ASSERT_TRUE(merger.AddAdoptFile(TFile::Open(fileNames[1].c_str()), /*cpProgress=*/false));
+      ASSERT_TRUE(merger.AddFile(fileNames[2].c_str(), /*cpProgress=*/false));
+      ASSERT_TRUE(merger.AddAdoptFile(TFile::Open(fileNames[3].c_str()), /*cpProgress=*/false));
+      ASSERT_TRUE(merger.OutputFile("TFileMergerOrderOut.root", "RECREATE"));
+      EXPECT_TRUE(merger.Merge());
+   }
+   ROOT::DisableImplicitMT();
+
+   {
+      TFile out("TFileMergerOrderOut.root");
+      auto t = out.Get<TTree>("t");
+      ASSERT_TRUE(t != nullptr);
+      ASSERT_EQ(t->GetEntries(), 4);
+      double x = -1;
+      t->SetBranchAddress("x", &x);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         EXPECT_EQ(x, i);
+      }
+      t->ResetBranchAddresses();
+   }
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+   gSystem->Unlink("TFileMergerOrderOut.root");
+}
+#endif
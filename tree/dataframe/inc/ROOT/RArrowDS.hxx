@@ -5,10 +5,15 @@
 #include "ROOT/RDataSource.hxx"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace arrow {
 class Table;
+namespace ipc {
+class RecordBatchFileReader;
 }
+} // namespace arrow
 
 namespace ROOT {
 namespace Internal {
@@ -22,6 +27,11 @@ namespace RDF {
 class RArrowDS final : public RDataSource {
 private:
    std::shared_ptr<arrow::Table> fTable;
+   /// The reader of the Arrow IPC file whose record batches are read by GetEntryRanges, if the data source was
+   /// created from a file; fTable then only holds the schema of the file.
+   std::shared_ptr<arrow::ipc::RecordBatchFileReader> fFileReader;
+   int fNextBatch = 0;            ///< The next record batch of the file to read
+   ULong64_t fNextBatchEntry = 0; ///< The first entry of the next record batch of the file
    std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
    std::vector<std::string> fColumnNames;
    size_t fNSlots = 0U;
@@ -29,9 +39,11 @@ private:
    std::vector<std::pair<size_t, size_t>> fGetterIndex; // (columnId, visitorId)
    std::vector<std::unique_ptr<ROOT::Internal::RDF::TValueGetter>> fValueGetters; // Visitors to be used to track and get entries. One per column.
    std::vector<void *> GetColumnReadersImpl(std::string_view name, const std::type_info &type) override;
+   RArrowDS(std::shared_ptr<arrow::ipc::RecordBatchFileReader> fileReader, std::vector<std::string> const &columns);
 
 public:
    RArrowDS(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
+   RArrowDS(std::string_view fileName, std::vector<std::string> const &columns);
    ~RArrowDS();
    const std::vector<std::string> &GetColumnNames() const override;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() override;
@@ -49,6 +61,13 @@ public:
 /// \param[in] table an apache::arrow table to use as a source.
 RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
 
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Factory method to create a Apache Arrow RDataFrame from an Arrow IPC (Feather v2) file.
+/// \param[in] fileName the path of the file, which is memory-mapped. Its record batches are read, and decompressed if
+/// needed, during the event loop, as many at a time as there are processing slots.
+/// \param[in] columns the name of the columns to use, all columns if empty.
+RDataFrame MakeArrowDataFrame(std::string_view fileName, std::vector<std::string> const &columns = {});
+
 } // namespace RDF
 
 } // namespace ROOT
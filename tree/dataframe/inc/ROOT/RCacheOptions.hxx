@@ -0,0 +1,46 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <Compression.h>
+#include <ROOT/RSnapshotOptions.hxx>
+#include <RtypesCore.h>
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+
+/// Where Cache stores the cached columns
+enum class ECacheStorage {
+   kMemory,      ///< Keep all cached values in memory (the default)
+   kDiskSnapshot ///< Snapshot the cached values to a compressed scratch file and read them back from it
+};
+
+/// A collection of options to steer the behavior of Cache
+struct RCacheOptions {
+   using ECAlgo = ROOT::ECompressionAlgorithm;
+   ECacheStorage fStorage = ECacheStorage::kMemory; ///< Where the cached columns are stored
+   /// Directory in which the scratch file is created. If empty, the system's temporary directory is used.
+   std::string fScratchDir;
+   ECAlgo fCompressionAlgorithm = ROOT::kLZ4; ///< Compression algorithm of the scratch file
+   int fCompressionLevel = 1;                 ///< Compression level of the scratch file
+   /// Size in bytes of the read buffers of the scratch file: it is written in clusters of a quarter of this size, and
+   /// single-thread TTree readers use a TTreeCache of this size. 0 means that ROOT's default sizes are used.
+   /// Only these buffers are kept in memory, there is no in-memory tier of cached entries.
+   ULong64_t fReadBufferSize = 64ull * 1024 * 1024;
+   /// Data format of the scratch file. kRNTuple requires ROOT to be built with root7=ON.
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault;
+};
+
+} // ns RDF
+} // ns ROOT
+
+#endif
@@ -19,6 +19,8 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <TRegexp.h>
@@ -41,7 +43,17 @@ private:
    // Regular expressions for type inference
    static const TRegexp fgIntRegex, fgDoubleRegex1, fgDoubleRegex2, fgDoubleRegex3, fgTrueRegex, fgFalseRegex;
 
+   /// Maximum size of the blocks in which the file is read
+   static constexpr std::size_t fgReadBlockSize = 1 << 20;
+   /// Minimum size of the blocks in which the file is read if the chunks are given in lines
+   static constexpr std::size_t fgMinReadBlockSize = 1 << 12;
+   /// Maximum size of the lines read by one call to GetEntryRanges if no chunk size in lines is given
+   static constexpr std::size_t fgMaxChunkSize = 1 << 28;
+
    std::uint64_t fDataPos = 0;
+   std::uint64_t fNextPos = 0; ///< Offset in the file of the first line not read yet
+   std::string fReadAhead;     ///< Bytes already read from the file starting at fNextPos, i.e. past the last chunk
+   std::size_t fBytesPerLine = 0; ///< Average length of the lines read so far, to size the reads to the chunks
    bool fReadHeaders = false;
    unsigned int fNSlots = 0U;
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
@@ -49,11 +61,16 @@ private:
    const Long64_t fLinesChunkSize;
    ULong64_t fEntryRangesRequested = 0ULL;
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
+   ULong64_t fFirstEntry = 0ULL;     // the entry number of the first line in fChunk
+   /// The text of the lines read by the last call to GetEntryRanges. Lines are parsed by SetEntry, i.e. in parallel
+   /// on the processing slots of multi-thread event loops.
+   std::string fChunk;
+   std::vector<std::pair<std::size_t, std::size_t>> fLines; // offset in fChunk and length of each non-empty line
+   std::vector<std::string> fSlotFields;                      // one per slot, the field being parsed
    std::vector<std::string> fHeaders;
    std::map<std::string, ColType_t> fColTypes;
    std::list<ColType_t> fColTypesList;
    std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot]
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column]
    std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
    std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
    std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
@@ -62,13 +79,13 @@ private:
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void ReadChunk();
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &);
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
    std::vector<std::string> ParseColumns(const std::string &);
-   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   size_t ParseValue(const char *, size_t, size_t, std::string &) const;
    ColType_t GetType(std::string_view colName) const;
 
 protected:
@@ -25,6 +25,8 @@
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "ROOT/RDF/RNTupleSnapshotWriter.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RMakeUnique.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
@@ -45,15 +47,23 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <array>
+#include <cstring> // std::strchr in GetShardedFillHist
+#include <functional>
+#include <iterator> // std::begin
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 #include <iomanip>
 #include <numeric> // std::accumulate in MeanHelper
 
+class THnBase;
+
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
@@ -73,6 +83,19 @@ public:
    template <typename... Args>
    void CallFinalizeTask(unsigned int, Args...) {}
 
+   // call Helper::MakeNew if present, throw otherwise
+   template <typename T = Helper>
+   auto CallMakeNew(void *newResult) -> decltype(std::declval<T &>().MakeNew(newResult))
+   {
+      return static_cast<Helper *>(this)->MakeNew(newResult);
+   }
+
+   template <typename... Args>
+   Helper CallMakeNew(void *, Args...)
+   {
+      throw std::logic_error("`MakeNew` is not implemented for this type of action.");
+   }
+
    // Helper functions for RMergeableValue
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const
    {
@@ -137,6 +160,7 @@ public:
    CountHelper(const CountHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
    void Exec(unsigned int slot);
+   void ExecBulk(unsigned int slot, std::size_t n) { fCounts[slot] += n; }
    void Initialize() { /* noop */}
    void Finalize();
 
@@ -149,6 +173,14 @@ public:
    ULong64_t &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Count"; }
+
+   /// Create a helper of the same kind that writes its result to the given `std::shared_ptr<ULong64_t>`.
+   CountHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ULong64_t> *>(newResult);
+      *result = 0;
+      return CountHelper(result, fCounts.size());
+   }
 };
 
 template <typename ProxiedVal_t>
@@ -169,6 +201,7 @@ public:
    ReportHelper(const ReportHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
    void Exec(unsigned int /* slot */) {}
+   void ExecBulk(unsigned int /* slot */, std::size_t /* n */) {}
    void Initialize() { /* noop */}
    void Finalize()
    {
@@ -180,6 +213,26 @@ public:
    std::string GetActionName() { return "Report"; }
 };
 
+class ProfileHelper : public RActionImpl<ProfileHelper> {
+   const std::shared_ptr<ROOT::RDF::RProfileReport> fReport;
+   ROOT::Detail::RDF::RLoopManager *fLoopManager;
+
+public:
+   using ColumnTypes_t = TypeList<>;
+   ProfileHelper(const std::shared_ptr<ROOT::RDF::RProfileReport> &report, ROOT::Detail::RDF::RLoopManager *lm)
+      : fReport(report), fLoopManager(lm)
+   {
+   }
+   ProfileHelper(ProfileHelper &&) = default;
+   ProfileHelper(const ProfileHelper &) = delete;
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Exec(unsigned int /* slot */) {}
+   void Initialize() { /* noop */}
+   void Finalize();
+
+   std::string GetActionName() { return "Profile"; }
+};
+
 class FillHelper : public RActionImpl<FillHelper> {
    // this sets a total initial size of 16 MB for the buffers (can increase)
    static constexpr unsigned int fgTotalBufSize = 2097152;
@@ -257,6 +310,30 @@ public:
         "Cannot fill object if the type of the first column is a scalar and the one of the second a container.");
    }
 
+   template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const T *vs, std::size_t n)
+   {
+      double thisMin = fMin[slot];
+      double thisMax = fMax[slot];
+      for (std::size_t i = 0; i < n; ++i) {
+         thisMin = std::min(thisMin, static_cast<double>(vs[i]));
+         thisMax = std::max(thisMax, static_cast<double>(vs[i]));
+      }
+      fMin[slot] = thisMin;
+      fMax[slot] = thisMax;
+      auto &thisBuf = fBuffers[slot];
+      thisBuf.insert(thisBuf.end(), vs, vs + n);
+   }
+
+   template <typename T, typename W,
+             typename std::enable_if<std::is_arithmetic<T>::value && std::is_arithmetic<W>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const T *vs, const W *ws, std::size_t n)
+   {
+      ExecBulk(slot, vs, n);
+      auto &thisWBuf = fWBuffers[slot];
+      thisWBuf.insert(thisWBuf.end(), ws, ws + n);
+   }
+
    Hist_t &PartialUpdate(unsigned int);
 
    void Initialize() { /* noop */}
@@ -270,6 +347,15 @@ public:
    }
 
    std::string GetActionName() { return "Fill"; }
+
+   /// Create a helper of the same kind that fills the given `std::shared_ptr<Hist_t>`, which is reset first.
+   FillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<Hist_t> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return FillHelper(result, fNSlots);
+   }
 };
 
 extern template void FillHelper::Exec(unsigned int, const std::vector<float> &);
@@ -326,6 +412,46 @@ public:
       fObjects[slot]->Fill(x0, x1, x2, x3);
    }
 
+   template <typename X0, typename std::enable_if<std::is_arithmetic<X0>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const X0 *x0s, std::size_t n)
+   {
+      auto thisSlotH = fObjects[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         thisSlotH->Fill(static_cast<double>(x0s[i]));
+   }
+
+   template <typename X0, typename X1,
+             typename std::enable_if<std::is_arithmetic<X0>::value && std::is_arithmetic<X1>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const X0 *x0s, const X1 *x1s, std::size_t n)
+   {
+      auto thisSlotH = fObjects[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         thisSlotH->Fill(static_cast<double>(x0s[i]), static_cast<double>(x1s[i]));
+   }
+
+   template <typename X0, typename X1, typename X2,
+             typename std::enable_if<std::is_arithmetic<X0>::value && std::is_arithmetic<X1>::value &&
+                                        std::is_arithmetic<X2>::value,
+                                     int>::type = 0>
+   void ExecBulk(unsigned int slot, const X0 *x0s, const X1 *x1s, const X2 *x2s, std::size_t n)
+   {
+      auto thisSlotH = fObjects[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         thisSlotH->Fill(static_cast<double>(x0s[i]), static_cast<double>(x1s[i]), static_cast<double>(x2s[i]));
+   }
+
+   template <typename X0, typename X1, typename X2, typename X3,
+             typename std::enable_if<std::is_arithmetic<X0>::value && std::is_arithmetic<X1>::value &&
+                                        std::is_arithmetic<X2>::value && std::is_arithmetic<X3>::value,
+                                     int>::type = 0>
+   void ExecBulk(unsigned int slot, const X0 *x0s, const X1 *x1s, const X2 *x2s, const X3 *x3s, std::size_t n)
+   {
+      auto thisSlotH = fObjects[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         thisSlotH->Fill(static_cast<double>(x0s[i]), static_cast<double>(x1s[i]), static_cast<double>(x2s[i]),
+                         static_cast<double>(x3s[i]));
+   }
+
    template <typename X0, typename std::enable_if<IsDataContainer<X0>::value || std::is_same<X0, std::string>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s)
    {
@@ -468,6 +594,465 @@ public:
    }
 
    std::string GetActionName() { return "FillPar"; }
+
+   /// Create a helper of the same kind that fills the given `std::shared_ptr<HIST>`, which is reset first if it is a
+   /// histogram.
+   FillParHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      if (auto objAsHist = dynamic_cast<TH1 *>(result.get())) {
+         objAsHist->Reset();
+         objAsHist->SetDirectory(nullptr);
+      }
+      return FillParHelper(result, fObjects.size());
+   }
+};
+
+/// Number of values, per column, that a column contributes to one FillSharedHelper::Exec call: 0 for scalars
+template <typename T, typename std::enable_if<!IsDataContainer<T>::value, int>::type = 0>
+std::size_t GetNFillValues(const T &)
+{
+   return 0;
+}
+
+template <typename T, typename std::enable_if<IsDataContainer<T>::value, int>::type = 0>
+std::size_t GetNFillValues(const T &c)
+{
+   return c.size();
+}
+
+/// The type of the values a column contributes to a FillSharedHelper::Exec call: the elements of collections
+template <typename T, bool IsCollection = IsDataContainer<T>::value>
+struct FillValueType {
+   using type = T;
+};
+
+template <typename T>
+struct FillValueType<T, true> {
+   using type = typename std::decay<decltype(*std::begin(std::declval<const T &>()))>::type;
+};
+
+/// The i-th value a column contributes to a FillSharedHelper::Exec call: scalars contribute the same value every time
+template <typename T, typename std::enable_if<!IsDataContainer<T>::value, int>::type = 0>
+const T &GetFillValue(const T &x, std::size_t)
+{
+   return x;
+}
+
+template <typename T, typename std::enable_if<IsDataContainer<T>::value, int>::type = 0>
+typename FillValueType<T>::type GetFillValue(const T &c, std::size_t i)
+{
+   return *(std::begin(c) + i);
+}
+
+constexpr bool AllOf()
+{
+   return true;
+}
+
+template <typename... Bs>
+constexpr bool AllOf(bool b, Bs... bs)
+{
+   return b && AllOf(bs...);
+}
+
+/// Call the Fill method of an object, e.g. a histogram, with the values of one Fill call
+template <typename T, typename... Ts>
+typename std::enable_if<!std::is_base_of<THnBase, T>::value>::type FillObject(T &obj, const Ts &... values)
+{
+   obj.Fill(values...);
+}
+
+/// THnBase::Fill takes the coordinates as an array, followed by the weight if there is one value more than dimensions
+template <typename T, typename... Ts>
+typename std::enable_if<std::is_base_of<THnBase, T>::value>::type FillObject(T &obj, const Ts &... values)
+{
+   const Double_t x[] = {static_cast<Double_t>(values)...};
+   const auto nValues = static_cast<Int_t>(sizeof...(Ts));
+   const auto nDims = obj.GetNdimensions();
+   if (nValues == nDims) {
+      obj.Fill(x);
+   } else if (nValues == nDims + 1) {
+      obj.Fill(x, x[nDims]);
+   } else {
+      throw std::runtime_error("Cannot fill a " + std::to_string(nDims) + "-dimensional THn with " +
+                               std::to_string(nValues) + " values.");
+   }
+}
+
+/// Empty an object for FillSharedHelper::MakeNew; histograms are also detached from their directory
+template <typename T>
+typename std::enable_if<!std::is_base_of<THnBase, T>::value>::type ResetFillObject(T &obj)
+{
+   if (auto objAsHist = dynamic_cast<TH1 *>(&obj)) {
+      objAsHist->Reset();
+      objAsHist->SetDirectory(nullptr);
+   }
+}
+
+template <typename T>
+typename std::enable_if<std::is_base_of<THnBase, T>::value>::type ResetFillObject(T &obj)
+{
+   obj.Reset();
+}
+
+/// Whether the statistics of a histogram include the under- and overflow bins. The accessor of TH1 is protected.
+struct RStatOverflows : private TH1 {
+   static bool Get(const TH1 &h) { return (h.*&RStatOverflows::GetStatOverflowsBehaviour)(); }
+};
+
+/// The histogram whose bins FillSharedHelper fills without a global lock: a TH1, TH2 or TH3 with fixed axes and without
+/// a fill buffer, nullptr for other objects (e.g. profiles).
+template <typename T>
+typename std::enable_if<std::is_base_of<TH1, T>::value, TH1 *>::type GetShardedFillHist(T &obj)
+{
+   const TString className = obj.ClassName();
+   const bool isPlainHist = className.Length() == 4 && className.BeginsWith("TH") &&
+                            std::strchr("123", className[2]) && std::strchr("CSIFD", className[3]);
+   if (!isPlainHist || obj.GetBufferSize() > 0 || obj.GetXaxis()->CanExtend() || obj.GetYaxis()->CanExtend() ||
+       obj.GetZaxis()->CanExtend())
+      return nullptr;
+   return &obj;
+}
+
+template <typename T>
+typename std::enable_if<!std::is_base_of<TH1, T>::value, TH1 *>::type GetShardedFillHist(T &)
+{
+   return nullptr;
+}
+
+template <typename T>
+typename std::enable_if<std::is_copy_constructible<T>::value, std::unique_ptr<RMergeableValueBase>>::type
+MakeMergeableFill(const T &obj)
+{
+   return std::make_unique<RMergeableFill<T>>(obj);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_copy_constructible<T>::value, std::unique_ptr<RMergeableValueBase>>::type
+MakeMergeableFill(const T &)
+{
+   throw std::logic_error("`GetMergeableValue` is not implemented for objects that cannot be copied.");
+}
+
+/// Fill a single object, shared by all processing slots, with bounded memory usage.
+///
+/// FillParHelper fills a separate copy of the object in each slot and merges the copies at the end of the event loop:
+/// for large objects (e.g. THnSparse or finely binned TH3D) and many slots the copies can require more memory than
+/// available. Here instead each slot buffers the values it needs to fill the object with, with their original types,
+/// and fills the shared object with all of them at once.
+///
+/// TH1, TH2 and TH3 histograms with fixed axes are filled without a global lock. A slot finds the bins of its buffered
+/// values and accumulates their statistics on its own; the bins are split in shards, each with its own lock, and the
+/// slot adds the values to the bin contents one shard at a time, first skipping the shards that other slots are
+/// filling. The statistics of all slots are set on the histogram at the end of the event loop.
+/// Other objects (profiles, THn, THnSparse, histograms with extendable axes...) are filled while holding a single lock.
+/// A slot whose buffer is full only takes the lock if it is free and otherwise keeps buffering, up to a hard limit.
+///
+/// Either way slots rarely wait for each other, and the memory needed besides the result is a bounded buffer per slot,
+/// whatever the size of the object.
+template <typename HIST>
+class FillSharedHelper : public RActionImpl<FillSharedHelper<HIST>> {
+   /// Number of Fill calls buffered per slot before the slot fills the object, if no other slot is filling it
+   static constexpr std::size_t kBufferSize = 4096;
+   /// Number of Fill calls buffered per slot before the slot waits for the other slots to fill the object
+   static constexpr std::size_t kMaxBufferSize = 16 * kBufferSize;
+   /// Number of shards of the bins of the histograms filled without a global lock
+   static constexpr std::size_t kNShards = 64;
+
+   /// A value to add to the content of a bin
+   struct RBinFill {
+      Int_t fBin;
+      Double_t fWeight;
+   };
+
+   /// What a slot filled in a histogram filled without a global lock
+   struct RSlotHistFills {
+      std::array<Double_t, TH1::kNstat> fStats{}; ///< Statistics of the Fill calls, as in TH1::GetStats
+      Double_t fEntries = 0;                      ///< Number of Fill calls
+      /// The values not yet added to the bins, per shard
+      std::vector<std::vector<RBinFill>> fShardFills = std::vector<std::vector<RBinFill>>(kNShards);
+   };
+
+   /// The Fill calls buffered by a slot. The types of the values are only known by Exec.
+   class RBufferBase {
+   public:
+      std::size_t fFlushSize = kBufferSize; ///< Size at which the next attempt to fill the object is made
+      virtual ~RBufferBase() = default;
+      virtual std::size_t GetSize() const = 0;
+      /// Fill the object with the buffered values and empty the buffer
+      virtual void FillAndClear(HIST &h) = 0;
+      /// Whether the values of a Fill call are the coordinates in the histogram, possibly followed by a weight
+      virtual bool CanBin(const TH1 &h) const = 0;
+      /// Whether the values of a Fill call end with a weight
+      virtual bool IsWeighted(const TH1 &h) const = 0;
+      /// Find the bins of the buffered values and accumulate their statistics, as TH1::Fill, TH2::Fill and TH3::Fill
+      /// do, and empty the buffer
+      virtual void BinAndClear(const TH1 &h, RSlotHistFills &fills) = 0;
+   };
+
+   template <typename... Ts>
+   class RBuffer final : public RBufferBase {
+      static constexpr std::size_t kNValues = sizeof...(Ts);
+      /// Whether the values can be the coordinates and the weight of a Fill call of a TH1, TH2 or TH3
+      static constexpr bool kCanBin = kNValues <= 4 && AllOf(std::is_arithmetic<Ts>::value...);
+
+      std::vector<std::tuple<Ts...>> fValues;
+
+      template <std::size_t... S>
+      void FillAll(HIST &h, std::index_sequence<S...>)
+      {
+         for (const auto &values : fValues)
+            FillObject(h, std::get<S>(values)...);
+      }
+
+      template <std::size_t... S>
+      void BinAll(const TH1 &h, RSlotHistFills &fills, std::index_sequence<S...>, std::true_type /*canBin*/)
+      {
+         const auto nDims = h.GetDimension();
+         const bool statOverflows = RStatOverflows::Get(h);
+         const TAxis *axes[] = {h.GetXaxis(), h.GetYaxis(), h.GetZaxis()};
+         auto &s = fills.fStats;
+         for (const auto &values : fValues) {
+            const Double_t v[4] = {static_cast<Double_t>(std::get<S>(values))...};
+            const Double_t w = kNValues > static_cast<std::size_t>(nDims) ? v[nDims] : 1.;
+            Int_t bins[3] = {0, 0, 0};
+            bool inRange = true;
+            for (Int_t d = 0; d < nDims; ++d) {
+               bins[d] = axes[d]->FindFixBin(v[d]);
+               inRange = inRange && bins[d] > 0 && bins[d] <= axes[d]->GetNbins();
+            }
+            const auto bin = h.GetBin(bins[0], bins[1], bins[2]);
+            fills.fShardFills[bin % kNShards].push_back({bin, w});
+            fills.fEntries += 1;
+            if (!inRange && !statOverflows)
+               continue;
+            const Double_t x = v[0], y = v[1], z = v[2];
+            s[0] += w;
+            s[1] += w * w;
+            s[2] += w * x;
+            s[3] += w * x * x;
+            if (nDims > 1) {
+               s[4] += w * y;
+               s[5] += w * y * y;
+               s[6] += w * x * y;
+            }
+            if (nDims > 2) {
+               s[7] += w * z;
+               s[8] += w * z * z;
+               s[9] += w * x * z;
+               s[10] += w * y * z;
+            }
+         }
+         fValues.clear();
+      }
+
+      template <std::size_t... S>
+      void BinAll(const TH1 &, RSlotHistFills &, std::index_sequence<S...>, std::false_type /*canBin*/)
+      {
+      }
+
+   public:
+      RBuffer() { fValues.reserve(kBufferSize); }
+      void Push(const Ts &... values) { fValues.emplace_back(values...); }
+      std::size_t GetSize() const final { return fValues.size(); }
+      void FillAndClear(HIST &h) final
+      {
+         FillAll(h, std::index_sequence_for<Ts...>());
+         fValues.clear();
+      }
+      bool CanBin(const TH1 &h) const final
+      {
+         const auto nDims = static_cast<std::size_t>(h.GetDimension());
+         return kCanBin && (kNValues == nDims || kNValues == nDims + 1);
+      }
+      bool IsWeighted(const TH1 &h) const final { return kNValues > static_cast<std::size_t>(h.GetDimension()); }
+      void BinAndClear(const TH1 &h, RSlotHistFills &fills) final
+      {
+         BinAll(h, fills, std::index_sequence_for<Ts...>(), std::integral_constant<bool, kCanBin>());
+      }
+   };
+
+   HIST *fObject;
+   std::unique_ptr<std::mutex> fMutex; ///< Protects fObject, unless it is filled through fHist
+   std::vector<std::unique_ptr<RBufferBase>> fBuffers; ///< Per slot, created by the first Exec call of the slot
+   /// fObject if it is a histogram filled without a global lock, set by Initialize
+   TH1 *fHist = nullptr;
+   std::unique_ptr<std::mutex[]> fShardMutexes; ///< Protect the bins of fHist, the i-th those with bin % kNShards == i
+   std::unique_ptr<std::once_flag> fSumw2Once;  ///< Enables the sums of squared weights of fHist before weighted fills
+   Double_t *fSumw2 = nullptr;                  ///< The sums of squared weights of the bins of fHist, if it has them
+   std::vector<RSlotHistFills> fSlotHistFills;  ///< Per slot
+   std::array<Double_t, TH1::kNstat> fInitialStats{}; ///< Statistics of fHist before the event loop
+   Double_t fInitialEntries = 0;                      ///< Entries of fHist before the event loop
+
+   /// Fill the object with the values buffered by the slot. If `wait` is false, do nothing if the object is being
+   /// filled by another slot.
+   void Flush(unsigned int slot, bool wait)
+   {
+      auto &buffer = *fBuffers[slot];
+      if (fHist && buffer.CanBin(*fHist)) {
+         FlushToShards(slot, buffer);
+         return;
+      }
+      std::unique_lock<std::mutex> lock(*fMutex, std::defer_lock);
+      if (wait) {
+         lock.lock();
+      } else if (!lock.try_lock()) {
+         // try again after a quarter of the nominal buffer size
+         buffer.fFlushSize = buffer.GetSize() + kBufferSize / 4;
+         return;
+      }
+      buffer.FillAndClear(*fObject);
+      lock.unlock();
+      buffer.fFlushSize = kBufferSize;
+   }
+
+   /// Add the values buffered by the slot to the bins of fHist, holding the lock of one shard of the bins at a time
+   void FlushToShards(unsigned int slot, RBufferBase &buffer)
+   {
+      if (buffer.IsWeighted(*fHist)) {
+         // TH1::Fill does the same on the first weighted Fill call
+         std::call_once(*fSumw2Once, [this] {
+            if (fHist->GetSumw2N() == 0 && !fHist->TestBit(TH1::kIsNotW)) {
+               fHist->Sumw2();
+               fSumw2 = fHist->GetSumw2()->GetArray();
+            }
+         });
+      }
+      auto &fills = fSlotHistFills[slot];
+      buffer.BinAndClear(*fHist, fills);
+
+      std::size_t nPending = 0;
+      for (const auto &shardFills : fills.fShardFills)
+         nPending += !shardFills.empty();
+      // The first pass skips the shards that other slots are filling, the next ones wait for them
+      for (bool wait = false; nPending > 0; wait = true) {
+         for (std::size_t shard = 0; shard < kNShards; ++shard) {
+            auto &shardFills = fills.fShardFills[shard];
+            if (shardFills.empty())
+               continue;
+            std::unique_lock<std::mutex> lock(fShardMutexes[shard], std::defer_lock);
+            if (wait)
+               lock.lock();
+            else if (!lock.try_lock())
+               continue;
+            for (const auto &fill : shardFills) {
+               fHist->AddBinContent(fill.fBin, fill.fWeight);
+               if (fSumw2)
+                  fSumw2[fill.fBin] += fill.fWeight * fill.fWeight;
+            }
+            lock.unlock();
+            shardFills.clear();
+            --nPending;
+         }
+      }
+      buffer.fFlushSize = kBufferSize;
+   }
+
+   void FlushIfNeeded(unsigned int slot)
+   {
+      if (fBuffers[slot] && fBuffers[slot]->GetSize() > 0)
+         Flush(slot, /*wait=*/true);
+   }
+
+   /// Set the statistics of the Fill calls of all slots on fHist, whose bins were filled without them
+   void SetHistStats()
+   {
+      auto stats = fInitialStats;
+      auto entries = fInitialEntries;
+      bool filled = false;
+      for (const auto &fills : fSlotHistFills) {
+         if (fills.fEntries == 0)
+            continue;
+         filled = true;
+         for (std::size_t i = 0; i < stats.size(); ++i)
+            stats[i] += fills.fStats[i];
+         entries += fills.fEntries;
+      }
+      if (!filled)
+         return;
+      fHist->PutStats(stats.data());
+      fHist->SetEntries(entries);
+   }
+
+public:
+   FillSharedHelper(FillSharedHelper &&) = default;
+   FillSharedHelper(const FillSharedHelper &) = delete;
+
+   FillSharedHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObject(h.get()), fMutex(new std::mutex()), fBuffers(nSlots), fShardMutexes(new std::mutex[kNShards]),
+        fSumw2Once(new std::once_flag()), fSlotHistFills(nSlots)
+   {
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   /// Buffer the values of one entry. Collection columns fill the object once per element, all collections must have
+   /// the same size; scalar columns (e.g. weights) contribute the same value to each of these Fill calls.
+   template <typename... ColTypes>
+   void Exec(unsigned int slot, const ColTypes &... cols)
+   {
+      using Buffer_t = RBuffer<typename FillValueType<ColTypes>::type...>;
+      constexpr std::size_t nCols = sizeof...(ColTypes);
+      if (!fBuffers[slot])
+         fBuffers[slot].reset(new Buffer_t());
+
+      const std::size_t nValues[] = {GetNFillValues(cols)...};
+      const bool isCollection[] = {IsDataContainer<ColTypes>::value...};
+      std::size_t nFills = 1;
+      bool foundCollection = false;
+      for (std::size_t i = 0; i < nCols; ++i) {
+         if (!isCollection[i])
+            continue;
+         if (!foundCollection) {
+            nFills = nValues[i];
+            foundCollection = true;
+         } else if (nValues[i] != nFills) {
+            throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
+         }
+      }
+
+      auto &buffer = static_cast<Buffer_t &>(*fBuffers[slot]);
+      for (std::size_t i = 0; i < nFills; ++i)
+         buffer.Push(GetFillValue(cols, i)...);
+      const auto size = buffer.GetSize();
+      if (size >= buffer.fFlushSize)
+         Flush(slot, /*wait=*/size >= kMaxBufferSize);
+   }
+
+   void Initialize()
+   {
+      fHist = GetShardedFillHist(*fObject);
+      if (!fHist)
+         return;
+      fHist->GetStats(fInitialStats.data());
+      fInitialEntries = fHist->GetEntries();
+      if (fHist->GetSumw2N() > 0)
+         fSumw2 = fHist->GetSumw2()->GetArray();
+   }
+
+   void FinalizeTask(unsigned int slot) { FlushIfNeeded(slot); }
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fBuffers.size(); ++slot)
+         FlushIfNeeded(slot);
+      if (fHist)
+         SetHistStats();
+   }
+
+   // Helper functions for RMergeableValue
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final { return MakeMergeableFill(*fObject); }
+
+   std::string GetActionName() { return "FillShared"; }
+
+   /// Create a helper of the same kind that fills the given `std::shared_ptr<HIST>`, which is reset first.
+   FillSharedHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      ResetFillObject(*result);
+      return FillSharedHelper(result, fBuffers.size());
+   }
 };
 
 class FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
@@ -776,6 +1361,15 @@ public:
          fMins[slot] = std::min(static_cast<ResultType>(v), fMins[slot]);
    }
 
+   template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const T *vs, std::size_t n)
+   {
+      auto thisMin = fMins[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         thisMin = std::min(static_cast<ResultType>(vs[i]), thisMin);
+      fMins[slot] = thisMin;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -794,6 +1388,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fMins[slot]; }
 
    std::string GetActionName() { return "Min"; }
+
+   MinHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MinHelper(result, fMins.size());
+   }
 };
 
 // TODO
@@ -826,6 +1426,15 @@ public:
          fMaxs[slot] = std::max(static_cast<ResultType>(v), fMaxs[slot]);
    }
 
+   template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const T *vs, std::size_t n)
+   {
+      auto thisMax = fMaxs[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         thisMax = std::max(static_cast<ResultType>(vs[i]), thisMax);
+      fMaxs[slot] = thisMax;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -845,6 +1454,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fMaxs[slot]; }
 
    std::string GetActionName() { return "Max"; }
+
+   MaxHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MaxHelper(result, fMaxs.size());
+   }
 };
 
 // TODO
@@ -892,6 +1507,16 @@ public:
          fSums[slot] += static_cast<ResultType>(v);
    }
 
+   template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const T *vs, std::size_t n)
+   {
+      // accumulate in a local variable so that the compiler does not need to store to fSums in every iteration
+      ResultType sum = fSums[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         sum += static_cast<ResultType>(vs[i]);
+      fSums[slot] = sum;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -909,6 +1534,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fSums[slot]; }
 
    std::string GetActionName() { return "Sum"; }
+
+   SumHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return SumHelper(result, fSums.size());
+   }
 };
 
 class MeanHelper : public RActionImpl<MeanHelper> {
@@ -933,6 +1564,16 @@ public:
       }
    }
 
+   template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+   void ExecBulk(unsigned int slot, const T *vs, std::size_t n)
+   {
+      double sum = fSums[slot];
+      for (std::size_t i = 0; i < n; ++i)
+         sum += vs[i];
+      fSums[slot] = sum;
+      fCounts[slot] += n;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize();
@@ -947,6 +1588,12 @@ public:
    double &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Mean"; }
+
+   MeanHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return MeanHelper(result, fSums.size());
+   }
 };
 
 extern template void MeanHelper::Exec(unsigned int, const std::vector<float> &);
@@ -995,6 +1642,12 @@ public:
    }
 
    std::string GetActionName() { return "StdDev"; }
+
+   StdDevHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return StdDevHelper(result, fNSlots);
+   }
 };
 
 extern template void StdDevHelper::Exec(unsigned int, const std::vector<float> &);
@@ -1546,6 +2199,56 @@ public:
    std::string GetActionName() { return "Snapshot"; }
 };
 
+/// Helper object for a Snapshot action that writes an RNTuple instead of a TTree, in single- and multi-thread runs.
+/// Each slot fills its own page sink, see RNTupleSnapshotWriter.
+template <typename... ColTypes>
+class SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter; // must use a ptr because RNTupleSnapshotWriter is not movable
+   std::vector<std::vector<void *>> fValuePtrs;    // per-slot addresses of the column values of the current entry
+   std::function<void()> fOnOutputWritten;         // called once the output RNTuple is complete on disk
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         const std::function<void()> &onOutputWritten)
+      : fValuePtrs(nSlots, std::vector<void *>(sizeof...(ColTypes), nullptr)), fOnOutputWritten(onOutputWritten)
+   {
+      if (!dirname.empty())
+         throw std::invalid_argument("Snapshot: RNTuple outputs cannot be written in a TDirectory, but directory \"" +
+                                     std::string(dirname) + "\" was requested");
+      fWriter = std::make_unique<RNTupleSnapshotWriter>(nSlots, std::string(filename), std::string(ntuplename),
+                                                        ReplaceDotWithUnderscore(bnames),
+                                                        std::vector<std::string>{TypeID2TypeName(typeid(ColTypes))...},
+                                                        options);
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriter->InitSlot(slot); }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      auto &valuePtrs = fValuePtrs[slot];
+      std::size_t i = 0;
+      int expander[] = {(valuePtrs[i++] = &values, 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+      (void)i;
+      fWriter->Fill(slot, valuePtrs);
+   }
+
+   void Initialize() {}
+
+   void Finalize()
+   {
+      fWriter->Finalize();
+      if (fOnOutputWritten)
+         fOnOutputWritten();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class AggregateHelper : public RActionImpl<AggregateHelper<Acc, Merge, R, T, U, MustCopyAssign>> {
@@ -15,7 +15,11 @@
 #include "RDefineBase.hxx"
 #include "RDefineReader.hxx"
 #include "RDSColumnReader.hxx"
+#include "RNodeTimer.hxx"
 #include "RTreeColumnReader.hxx"
+#include "Utils.hxx" // IsStrInVec
+#include "RVariationBase.hxx"
+#include "RVariationReader.hxx"
 
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/TypeTraits.hxx>
@@ -36,6 +40,26 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFDetail = ROOT::Detail::RDF;
 
+/// A column reader that times the reads of another column reader, for profiled event loops
+template <typename T>
+class R__CLING_PTRCHECK(off) RTimedColumnReader final : public RDFDetail::RColumnReaderBase {
+   std::unique_ptr<RDFDetail::RColumnReaderBase> fReader;
+   RNodeTimer &fTimer;
+   const unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      RNodeTimer::RScope timerScope(fTimer, fSlot);
+      return &fReader->template Get<T>(entry);
+   }
+
+public:
+   RTimedColumnReader(std::unique_ptr<RDFDetail::RColumnReaderBase> reader, RNodeTimer &timer, unsigned int slot)
+      : fReader(std::move(reader)), fTimer(timer), fSlot(slot)
+   {
+   }
+};
+
 template <typename T>
 std::unique_ptr<RDFDetail::RColumnReaderBase>
 MakeColumnReader(unsigned int slot, RDFDetail::RDefineBase *define, TTreeReader *r, ROOT::RDF::RDataSource *ds,
@@ -61,18 +85,6 @@ MakeColumnReader(unsigned int slot, RDFDetail::RDefineBase *define, TTreeReader
    return Ret_t(new RTreeColumnReader<T>(*r, colName));
 }
 
-template <typename T>
-std::unique_ptr<RDFDetail::RColumnReaderBase>
-MakeColumnReadersHelper(unsigned int slot, RDFDetail::RDefineBase *define,
-                        const std::map<std::string, std::vector<void *>> &DSValuePtrsMap, TTreeReader *r,
-                        ROOT::RDF::RDataSource *ds, const std::string &colName)
-{
-   const auto DSValuePtrsIt = DSValuePtrsMap.find(colName);
-   const std::vector<void *> *DSValuePtrsPtr = DSValuePtrsIt != DSValuePtrsMap.end() ? &DSValuePtrsIt->second : nullptr;
-   R__ASSERT(define != nullptr || r != nullptr || DSValuePtrsPtr != nullptr || ds != nullptr);
-   return MakeColumnReader<T>(slot, define, r, ds, DSValuePtrsPtr, colName);
-}
-
 /// This type aggregates some of the arguments passed to InitColumnReaders.
 /// We need to pass a single RColumnReadersInfo object rather than each argument separately because with too many
 /// arguments passed, gcc 7.5.0 and cling disagree on the ABI, which leads to the last function argument being read
@@ -83,8 +95,43 @@ struct RColumnReadersInfo {
    const bool *fIsDefine;
    const std::map<std::string, std::vector<void *>> &fDSValuePtrsMap;
    ROOT::RDF::RDataSource *fDataSource;
+   const std::string &fVariation; ///< "nominal", or the name of the systematic variation the readers should provide
+   /// If not null, the reads of the columns that are not Defines are timed with these timers (profiled event loops)
+   RProfiler *fProfiler = nullptr;
 };
 
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeColumnReadersHelper(unsigned int slot, RDFDetail::RDefineBase *define, TTreeReader *r, const std::string &colName,
+                        const RColumnReadersInfo &colInfo)
+{
+   const auto &variationName = colInfo.fVariation;
+   if (variationName != "nominal") {
+      auto *variation = colInfo.fCustomCols.FindVariation(colName, variationName);
+      if (variation != nullptr) {
+         // this column is varied: read the values computed by the RVariation instead
+         variation->InitSlot(r, slot);
+         return std::unique_ptr<RDFDetail::RColumnReaderBase>(
+            new RVariationReader(slot, *variation, variationName, typeid(T)));
+      }
+      if (define != nullptr && IsStrInVec(variationName, define->GetVariations())) {
+         // the Define expression depends on a varied column: read from the clone that evaluates it on varied inputs
+         define = &define->GetVariedDefine(variationName);
+         define->InitSlot(r, slot);
+      }
+   }
+
+   const auto &DSValuePtrsMap = colInfo.fDSValuePtrsMap;
+   auto *ds = colInfo.fDataSource;
+   const auto DSValuePtrsIt = DSValuePtrsMap.find(colName);
+   const std::vector<void *> *DSValuePtrsPtr = DSValuePtrsIt != DSValuePtrsMap.end() ? &DSValuePtrsIt->second : nullptr;
+   R__ASSERT(define != nullptr || r != nullptr || DSValuePtrsPtr != nullptr || ds != nullptr);
+   auto reader = MakeColumnReader<T>(slot, define, r, ds, DSValuePtrsPtr, colName);
+   if (define == nullptr && colInfo.fProfiler != nullptr)
+      reader.reset(new RTimedColumnReader<T>(std::move(reader), colInfo.fProfiler->GetReadTimer(colName), slot));
+   return reader;
+}
+
 /// Create a group of column readers, one per type in the parameter pack.
 /// colInfo.fColNames and colInfo.fIsDefine are expected to have size equal to the parameter pack, and elements ordered
 /// accordingly, i.e. fIsDefine[0] refers to fColNames[0] which is of type "ColTypes[0]".
@@ -96,19 +143,16 @@ MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, cons
    const auto &colNames = colInfo.fColNames;
    const auto &customCols = colInfo.fCustomCols;
    const bool *isDefine = colInfo.fIsDefine;
-   const auto &DSValuePtrsMap = colInfo.fDSValuePtrsMap;
-   auto *ds = colInfo.fDataSource;
 
    const auto &customColMap = customCols.GetColumns();
 
    int i = -1;
    std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, sizeof...(ColTypes)> ret{
-      {{(++i, MakeColumnReadersHelper<ColTypes>(slot, isDefine[i] ? customColMap.at(colNames[i]).get() : nullptr,
-                                                DSValuePtrsMap, r, ds, colNames[i]))}...}};
+      {{(++i, MakeColumnReadersHelper<ColTypes>(slot, isDefine[i] ? customColMap.at(colNames[i]).get() : nullptr, r,
+                                                colNames[i], colInfo))}...}};
    return ret;
 
    // avoid bogus "unused variable" warnings
-   (void)ds;
    (void)slot;
    (void)r;
 }
@@ -11,6 +11,7 @@
 #ifndef ROOT_RDF_TINTERFACE_UTILS
 #define ROOT_RDF_TINTERFACE_UTILS
 
+#include <ROOT/RCacheOptions.hxx>
 #include <ROOT/RDF/RAction.hxx>
 #include <ROOT/RDF/ActionHelpers.hxx> // for BuildAction
 #include <ROOT/RDF/RBookedDefines.hxx>
@@ -33,6 +34,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
@@ -101,6 +103,7 @@ struct Max{};
 struct Sum{};
 struct Mean{};
 struct Fill{};
+struct FillShared{};
 struct StdDev{};
 struct Display{};
 struct Snapshot{};
@@ -123,6 +126,21 @@ struct HistoUtils<T, false> {
    static bool HasAxisLimits(T &) { return true; }
 };
 
+/// Make the object filled by Fill with EFillStrategy::kShared from the model: objects that cannot be copied, like
+/// THnSparse, are cloned
+template <typename T>
+typename std::enable_if<std::is_copy_constructible<T>::value, std::shared_ptr<T>>::type MakeSharedFillObject(T &&model)
+{
+   return std::make_shared<T>(std::move(model));
+}
+
+template <typename T>
+typename std::enable_if<!std::is_copy_constructible<T>::value, std::shared_ptr<T>>::type
+MakeSharedFillObject(T &&model)
+{
+   return std::shared_ptr<T>(static_cast<T *>(model.Clone()));
+}
+
 // Generic filling (covers Histo2D, Histo3D, Profile1D and Profile2D actions, with and without weights)
 template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -134,6 +152,17 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h,
    return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), defines);
 }
 
+// Filling of a single object shared by all slots (Fill with ROOT::RDF::EFillStrategy::kShared)
+template <typename... ColTypes, typename ActionResultType, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::FillShared, const RDFInternal::RBookedDefines &defines)
+{
+   using Helper_t = FillSharedHelper<ActionResultType>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), defines);
+}
+
 // Histo1D filling (must handle the special case of distinguishing FillParHelper and FillHelper
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase> BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h,
@@ -235,6 +264,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// Invoked when the output has been written; RNTuple snapshots use it to attach the returned RDataFrame to it
+   std::function<void()> fOnOutputWritten;
 };
 
 // Snapshot action
@@ -251,7 +282,14 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    const auto &options = snapHelperArgs->fOptions;
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // RNTuple snapshot, single- or multi-thread
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, options,
+                                            snapHelperArgs->fOnOutputWritten),
+                                   colNames, prevNode, defines));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -282,6 +320,17 @@ void CheckDefine(std::string_view definedCol, TTree *treePtr, const ColumnNames_
 
 std::string PrettyPrintAddr(const void *const addr);
 
+void DeclarePendingLambdas(RLoopManager &lm);
+
+std::set<RLoopManager *> DeclarePendingLambdas(const std::vector<RLoopManager *> &lms);
+
+/// Name of the TTree or RNTuple written to the scratch file of a disk Cache
+constexpr const char *kCacheDatasetName = "rdfcache";
+
+std::string MakeCacheScratchFileName(const std::string &scratchDir);
+
+ROOT::RDF::RSnapshotOptions MakeCacheSnapshotOptions(const ROOT::RDF::RCacheOptions &options);
+
 void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter, std::shared_ptr<RNodeBase> *prevNodeOnHeap,
                    std::string_view name, std::string_view expression,
                    const std::map<std::string, std::string> &aliasMap, const ColumnNames_t &branches,
@@ -14,14 +14,19 @@
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RColumnBlocks.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariedAction.hxx"
 
+#include <algorithm>
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -51,6 +56,8 @@ std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node,
 template <typename Helper, typename PrevDataFrame, typename ColumnTypes_t = typename Helper::ColumnTypes_t>
 class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ColumnBlocks_t = RColumnBlocks<ColumnTypes_t>;
+   using IsBulk_t = std::integral_constant<bool, HasExecBulk<Helper, ColumnTypes_t>::value>;
 
    Helper fHelper;
    const std::shared_ptr<PrevDataFrame> fPrevDataPtr;
@@ -61,10 +68,16 @@ class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// Bulk event loops: the blocks of values of the input columns
+   ColumnBlocks_t fColumnBlocks;
+   /// Bulk event loops: per slot, the values of the input columns for the selected entries of the current block
+   std::vector<typename ColumnBlocks_t::Blocks_t> fSelectedValues;
+
 public:
    RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines)
       : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines), fHelper(std::forward<Helper>(h)),
-        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine()
+        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine(),
+        fColumnBlocks(GetNSlots(), columns, GetDefines()), fSelectedValues(GetNSlots())
    {
       const auto nColumns = columns.size();
       const auto &customCols = GetDefines();
@@ -93,8 +106,10 @@ public:
    {
       for (auto &bookedBranch : GetDefines().GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      const std::string nominal = "nominal";
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
-                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource(), nominal,
+                                           fProfiler};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
       fHelper.InitTask(r, slot);
    }
@@ -109,8 +124,59 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevData.CheckFilters(slot, entry))
+      if (fPrevData.CheckFilters(slot, entry)) {
+         RDFInternal::RNodeTimer::RScope timerScope(fTimer, slot);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
+   bool SupportsBulk() const final
+   {
+      return IsBulk_t::value && fColumnBlocks.SupportsBulk() && fPrevData.SupportsBulk();
+   }
+
+   void StageEntry(unsigned int slot, std::size_t idx, Long64_t entry) final
+   {
+      fColumnBlocks.Stage(slot, idx, entry, fValues[slot]);
+      fPrevData.StageEntry(slot, idx, entry);
+   }
+
+   void RunBulk(unsigned int slot, const std::vector<Long64_t> &entries) final
+   {
+      const char *mask = fPrevData.CheckFiltersBulk(slot, entries);
+      CallExecBulk(slot, mask, entries, ColumnTypes_t{}, TypeInd_t{}, IsBulk_t{});
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries,
+                     TypeList<ColTypes...>, std::index_sequence<S...>, std::true_type)
+   {
+      auto inputs = std::forward_as_tuple(fColumnBlocks.template Get<S>(slot, mask, entries)...);
+      RDFInternal::RNodeTimer::RScope timerScope(fTimer, slot);
+      const auto n = entries.size();
+      const auto nSelected = static_cast<std::size_t>(std::count_if(mask, mask + n, [](char m) { return m != 0; }));
+      if (nSelected == n) {
+         fHelper.ExecBulk(slot, std::get<S>(inputs).data()..., n);
+      } else if (nSelected > 0) {
+         // pack the values of the selected entries in contiguous arrays
+         auto &selected = fSelectedValues[slot];
+         using expander = int[];
+         (void)expander{0, (std::get<S>(selected).resize(nSelected), 0)...};
+         for (std::size_t i = 0, j = 0; i < n; ++i) {
+            if (mask[i]) {
+               (void)expander{0, (std::get<S>(selected)[j] = std::get<S>(inputs)[i], 0)...};
+               ++j;
+            }
+         }
+         fHelper.ExecBulk(slot, std::get<S>(selected).data()..., nSelected);
+         (void)selected;
+      }
+      (void)inputs; // avoid "unused variable" warnings for actions without inputs
+   }
+
+   template <typename ColTypeList, typename Seq>
+   void CallExecBulk(unsigned int, const char *, const std::vector<Long64_t> &, ColTypeList, Seq, std::false_type)
+   {
    }
 
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
@@ -120,6 +186,9 @@ public:
    {
       for (auto &column : GetDefines().GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variations : GetDefines().GetVariations())
+         for (auto &variation : variations.second)
+            variation->FinaliseSlot(slot);
       for (auto &v : fValues[slot])
          v.reset();
       fHelper.CallFinalizeTask(slot);
@@ -139,7 +208,9 @@ public:
       auto prevColumns = prevNode->GetDefinedColumns();
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
-      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName());
+      const auto profile = fTimer.Summary();
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(
+         profile.empty() ? fHelper.GetActionName() : fHelper.GetActionName() + "\n" + profile);
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetDefines(), prevColumns);
 
@@ -149,10 +220,34 @@ public:
       return thisNode;
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      auto variations = fPrevData.GetVariations();
+      for (auto &variation : GetDefines().GetVariationDeps(GetColumnNames()))
+         if (!IsStrInVec(variation, variations))
+            variations.emplace_back(std::move(variation));
+      return variations;
+   }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final
+   {
+      const auto variations = GetVariations();
+      R__ASSERT(variations.size() == results.size());
+      std::vector<Helper> helpers;
+      helpers.reserve(results.size());
+      for (void *result : results)
+         helpers.emplace_back(fHelper.CallMakeNew(result));
+
+      return std::unique_ptr<RActionBase>(new RVariedAction<Helper, PrevDataFrame, ColumnTypes_t>(
+         std::move(helpers), GetColumnNames(), fPrevDataPtr, GetDefines(), variations));
+   }
+
 private:
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
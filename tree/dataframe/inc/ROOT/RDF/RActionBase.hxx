@@ -12,11 +12,14 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RNodeTimer.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -41,6 +44,10 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   /// The time spent in the helper of this action, if the event loop is profiled
+   RNodeTimer fTimer;
+   /// The timers of the reads of the input columns if the event loop is profiled, nullptr otherwise
+   RProfiler *fProfiler = nullptr;
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -57,6 +64,7 @@ public:
 
    const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
    RBookedDefines &GetDefines() { return fDefines; }
+   const RBookedDefines &GetDefines() const { return fDefines; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
@@ -75,11 +83,34 @@ public:
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
 
+   /// The name of the action, e.g. "Histo1D", as returned by the helper's GetActionName method.
+   virtual std::string GetActionName() = 0;
+   /// Enable profiling of this action and of its Defines for the next event loop, or disable it if profiler is null.
+   /// Not thread-safe.
+   virtual void EnableProfiling(RProfiler *profiler);
+   virtual const RNodeTimer &GetTimer() const { return fTimer; }
+
+   /// Whether this action can process entries block-wise in bulk event loops (see RLoopManager::SetBulkSize).
+   virtual bool SupportsBulk() const { return false; }
+   /// Bulk event loops: read the input columns of this action and of its upstream nodes for the entry at position idx
+   /// of the current block of the slot.
+   virtual void StageEntry(unsigned int /*slot*/, std::size_t /*idx*/, Long64_t /*entry*/) {}
+   /// Bulk event loops: process the entries of the current block of the slot that pass the upstream filters.
+   virtual void RunBulk(unsigned int /*slot*/, const std::vector<Long64_t> & /*entries*/) {}
+
    /**
       Retrieve a wrapper to the result of the action that knows how to merge
       with others of the same type.
    */
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const = 0;
+
+   /// Return the names of the systematic variations (e.g. "pt:up") that affect the inputs of this action.
+   virtual std::vector<std::string> GetVariations() const = 0;
+
+   /// Create an action that computes this action's result for each of its systematic variations in the same event
+   /// loop. The type-erased results must point to `std::shared_ptr<Result_t>`s, one per variation, in the same order
+   /// as the variations returned by GetVariations.
+   virtual std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) = 0;
 };
 } // namespace RDF
 } // namespace Internal
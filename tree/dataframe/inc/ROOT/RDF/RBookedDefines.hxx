@@ -30,6 +30,8 @@ namespace RDF {
 
 namespace RDFDetail = ROOT::Detail::RDF;
 
+class RVariationBase;
+
 /**
  * \class ROOT::Internal::RDF::RBookedDefines
  * \ingroup dataframe
@@ -39,14 +41,17 @@ namespace RDFDetail = ROOT::Detail::RDF;
 class RBookedDefines {
    using RDefineBasePtrMap_t = std::map<std::string, std::shared_ptr<RDFDetail::RDefineBase>>;
    using ColumnNames_t = std::vector<std::string>;
+   using RVariationsMap_t = std::map<std::string, std::vector<std::shared_ptr<RVariationBase>>>;
 
    // Since RBookedDefines is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RDefineBasePtrMapPtr_t = std::shared_ptr<const RDefineBasePtrMap_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
+   using RVariationsMapPtr_t = std::shared_ptr<const RVariationsMap_t>;
 
 private:
    RDefineBasePtrMapPtr_t fDefines;
    ColumnNamesPtr_t fDefinesNames;  // also abused to keep track of aliases for each branch of the computation graph
+   RVariationsMapPtr_t fVariations; // systematic variations registered for each column, keyed by column name
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -64,7 +69,7 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates the object starting from the provided maps
    RBookedDefines(RDefineBasePtrMapPtr_t defines, ColumnNamesPtr_t defineNames)
-      : fDefines(defines), fDefinesNames(defineNames)
+      : fDefines(defines), fDefinesNames(defineNames), fVariations(std::make_shared<RVariationsMap_t>())
    {
    }
 
@@ -72,7 +77,8 @@ public:
    /// \brief Creates a new wrapper with empty maps
    RBookedDefines()
       : fDefines(std::make_shared<RDefineBasePtrMap_t>()),
-        fDefinesNames(std::make_shared<ColumnNames_t>())
+        fDefinesNames(std::make_shared<ColumnNames_t>()),
+        fVariations(std::make_shared<RVariationsMap_t>())
    {
    }
 
@@ -100,6 +106,31 @@ public:
    /// in each branch of the computation graph.
    /// Internally it recreates the vector with the new name, and swaps it with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the systematic variations registered so far, keyed by the name of the varied column
+   const RVariationsMap_t &GetVariations() const { return *fVariations; }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register a new systematic variation of a column.
+   /// Internally it recreates the map with the new variation, and swaps it with the old one.
+   void AddVariation(const std::shared_ptr<RVariationBase> &variation);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the names of all the variations (e.g. "pt:up") that affect the value of the given column.
+   ///
+   /// These are the variations registered for the column itself plus, for defined columns, the variations
+   /// that affect any of the inputs of the Define expression.
+   std::vector<std::string> GetVariationDeps(const std::string &column) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the names of all the variations that affect the value of any of the given columns.
+   std::vector<std::string> GetVariationDeps(const ColumnNames_t &columns) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the variation of the given column that provides values for the given variation name
+   /// (e.g. "pt:up"), or nullptr if the column is not varied by it.
+   RVariationBase *FindVariation(const std::string &column, const std::string &variationName) const;
 };
 
 } // Namespace RDF
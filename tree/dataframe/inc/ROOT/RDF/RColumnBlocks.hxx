@@ -0,0 +1,173 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCOLUMNBLOCKS
+#define ROOT_RDF_RCOLUMNBLOCKS
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <cstddef> // std::size_t
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+using namespace ROOT::TypeTraits;
+
+/// Whether the values of a column of type T can be processed block-wise in bulk event loops (see
+/// RLoopManager::SetBulkSize): arithmetic types other than bool, which can be copied to contiguous arrays cheaply.
+template <typename T>
+using IsBulkColumnType_t = std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>;
+
+/// Whether all the given column types can be processed in bulk event loops.
+template <typename... ColTypes>
+struct AreBulkColumnTypes : std::true_type {
+};
+
+template <typename T, typename... ColTypes>
+struct AreBulkColumnTypes<T, ColTypes...>
+   : std::integral_constant<bool, IsBulkColumnType_t<T>::value && AreBulkColumnTypes<ColTypes...>::value> {
+};
+
+/// The values of one column for the entries of the current block of a processing slot, in bulk event loops.
+/// Columns whose type cannot be processed in bulk get a placeholder element type, so that the bulk code paths of the
+/// nodes compile (and are never taken) for any column type.
+template <typename T>
+using RColumnBlock_t = std::vector<typename std::conditional<IsBulkColumnType_t<T>::value, T, char>::type>;
+
+/// Check whether a helper implements `ExecBulk(slot, const ColTypes *values..., nEntries)` for the given column types.
+/// Such helpers process the selected entries of a block in one call in bulk event loops.
+template <typename Helper, typename ColumnTypes_t, typename = void>
+struct HasExecBulk : std::false_type {
+};
+
+template <typename Helper, typename... ColTypes>
+struct HasExecBulk<Helper, TypeList<ColTypes...>,
+                   decltype(std::declval<Helper &>().ExecBulk(0u, std::declval<const ColTypes *>()..., std::size_t(0)))>
+   : AreBulkColumnTypes<ColTypes...> {
+};
+
+template <typename ColumnTypes_t>
+class RColumnBlocks;
+
+// clang-format off
+/**
+\class ROOT::Internal::RDF::RColumnBlocks
+\ingroup dataframe
+\brief The input columns of a node in bulk event loops, one block of values per column and per processing slot.
+
+While the event loop moves from one entry of a block to the next, Stage reads the columns that do not come from a
+Define into the blocks; the Defines read their own inputs. Once the block is complete, Get returns the values of a
+column for all the entries of the block, asking Defines to compute their values for the selected entries first.
+*/
+// clang-format on
+template <typename... ColTypes>
+class RColumnBlocks<TypeList<ColTypes...>> {
+public:
+   using IsBulk_t = AreBulkColumnTypes<ColTypes...>;
+   /// One block of values per column
+   using Blocks_t = std::tuple<RColumnBlock_t<ColTypes>...>;
+
+private:
+   using Readers_t = std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, sizeof...(ColTypes)>;
+
+   /// The values of the columns that are not Defines, per slot
+   std::vector<Blocks_t> fBlocks;
+   /// The Define that produces each column, nullptr for the columns that are not Defines
+   std::array<RDFDetail::RDefineBase *, sizeof...(ColTypes)> fDefines;
+
+   template <std::size_t S, typename T>
+   void StageColumn(unsigned int slot, std::size_t idx, Long64_t entry, RDFDetail::RColumnReaderBase &reader,
+                    std::true_type)
+   {
+      if (fDefines[S] != nullptr) {
+         fDefines[S]->StageEntry(slot, idx, entry);
+         return;
+      }
+      auto &block = std::get<S>(fBlocks[slot]);
+      if (block.size() <= idx)
+         block.resize(idx + 1);
+      block[idx] = reader.template Get<T>(entry);
+   }
+
+   template <std::size_t S, typename T>
+   void StageColumn(unsigned int, std::size_t, Long64_t, RDFDetail::RColumnReaderBase &, std::false_type)
+   {
+   }
+
+   template <std::size_t... S>
+   void StageImpl(unsigned int slot, std::size_t idx, Long64_t entry, Readers_t &readers, std::index_sequence<S...>)
+   {
+      using expander = int[];
+      (void)expander{0, (StageColumn<S, ColTypes>(slot, idx, entry, *readers[S], IsBulkColumnType_t<ColTypes>{}),
+                         0)...};
+      // avoid "unused parameter" warnings
+      (void)slot;
+      (void)idx;
+      (void)entry;
+      (void)readers;
+   }
+
+public:
+   RColumnBlocks(unsigned int nSlots, const ColumnNames_t &columnNames, const RBookedDefines &defines)
+      : fBlocks(nSlots), fDefines()
+   {
+      const auto &defineMap = defines.GetColumns();
+      for (auto i = 0u; i < sizeof...(ColTypes); ++i) {
+         const auto it = defineMap.find(columnNames[i]);
+         fDefines[i] = it != defineMap.end() ? it->second.get() : nullptr;
+      }
+   }
+
+   /// Whether all the column types, and all the Defines among the columns, support bulk event loops.
+   bool SupportsBulk() const
+   {
+      if (!IsBulk_t::value)
+         return false;
+      for (auto *define : fDefines)
+         if (define != nullptr && !define->SupportsBulk())
+            return false;
+      return true;
+   }
+
+   /// Read the values of the entry at position idx of the current block of the slot.
+   void Stage(unsigned int slot, std::size_t idx, Long64_t entry, Readers_t &readers)
+   {
+      StageImpl(slot, idx, entry, readers, std::index_sequence_for<ColTypes...>{});
+   }
+
+   /// Return the values of the Sth column for the entries of the current block of the slot.
+   /// Only the values of the entries selected by mask are guaranteed to be valid.
+   template <std::size_t S>
+   typename std::tuple_element<S, Blocks_t>::type &
+   Get(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries)
+   {
+      using Block_t = typename std::tuple_element<S, Blocks_t>::type;
+      if (fDefines[S] != nullptr)
+         return *static_cast<Block_t *>(fDefines[S]->UpdateBulk(slot, mask, entries));
+      return std::get<S>(fBlocks[slot]);
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -12,6 +12,7 @@
 #define ROOT_RCUSTOMCOLUMN
 
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnBlocks.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/Utils.hxx"
@@ -21,7 +22,11 @@
 #include "RtypesCore.h"
 
 #include <array>
+#include <cstddef> // std::size_t
 #include <deque>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -58,6 +63,9 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
    using ValuesPerSlot_t =
       typename std::conditional<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>::type;
+   using ColumnBlocks_t = RDFInternal::RColumnBlocks<ColumnTypes_t>;
+   using IsBulk_t = std::integral_constant<bool, ColumnBlocks_t::IsBulk_t::value &&
+                                                    RDFInternal::IsBulkColumnType_t<ret_type>::value>;
 
    F fExpression;
    const ColumnNames_t fColumnNames;
@@ -69,6 +77,13 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// Bulk event loops: the blocks of values of the input columns
+   ColumnBlocks_t fColumnBlocks;
+   /// Bulk event loops: per slot, the values of this column for the entries of the current block
+   std::vector<RDFInternal::RColumnBlock_t<ret_type>> fBlockResults;
+   /// Bulk event loops: per slot, whether the value of each entry of the current block has been computed
+   std::vector<std::vector<char>> fBlockComputed;
+
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
@@ -97,12 +112,68 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
       (void)entry;
    }
 
+   template <typename... Args>
+   ret_type EvalBulk(unsigned int, Long64_t, NoneTag, Args &...args)
+   {
+      return fExpression(args...);
+   }
+
+   template <typename... Args>
+   ret_type EvalBulk(unsigned int slot, Long64_t, SlotTag, Args &...args)
+   {
+      return fExpression(slot, args...);
+   }
+
+   template <typename... Args>
+   ret_type EvalBulk(unsigned int slot, Long64_t entry, SlotAndEntryTag, Args &...args)
+   {
+      return fExpression(slot, entry, args...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries,
+                         TypeList<ColTypes...>, std::index_sequence<S...>, std::true_type)
+   {
+      // the inputs must provide the values of the entries selected by mask before the expression is evaluated
+      auto inputs = std::forward_as_tuple(fColumnBlocks.template Get<S>(slot, mask, entries)...);
+      RDFInternal::RNodeTimer::RScope timerScope(fTimer, slot);
+      auto &results = fBlockResults[slot];
+      auto &computed = fBlockComputed[slot];
+      const auto n = entries.size();
+      for (std::size_t i = 0; i < n; ++i) {
+         if (mask[i] && !computed[i]) {
+            results[i] = EvalBulk(slot, entries[i], ExtraArgsTag{}, std::get<S>(inputs)[i]...);
+            computed[i] = 1;
+         }
+      }
+      (void)inputs; // avoid "unused variable" warnings for defines without inputs
+   }
+
+   template <typename ColTypeList, typename Seq>
+   void UpdateBulkHelper(unsigned int, const char *, const std::vector<Long64_t> &, ColTypeList, Seq, std::false_type)
+   {
+   }
+
+   std::unique_ptr<RDefineBase> MakeVariedDefine(const std::string &variationName, std::true_type)
+   {
+      // the varied define evaluates a copy of the same expression: its column readers provide the varied inputs
+      return std::unique_ptr<RDefineBase>(new RDefine(fName, fType, fExpression, fColumnNames, fNSlots, fDefines,
+                                                      fDSValuePtrs, fDataSource, variationName));
+   }
+
+   std::unique_ptr<RDefineBase> MakeVariedDefine(const std::string &, std::false_type)
+   {
+      throw std::runtime_error("Define expressions that cannot be copied do not support systematic variations.");
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ColumnNames_t &columns,
                  unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
-                 const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
-      : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds), fExpression(std::move(expression)),
-        fColumnNames(columns), fLastResults(fNSlots), fValues(fNSlots), fIsDefine()
+                 const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds,
+                 const std::string &variationName = "nominal")
+      : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds, variationName), fExpression(std::move(expression)),
+        fColumnNames(columns), fLastResults(fNSlots), fValues(fNSlots), fIsDefine(),
+        fColumnBlocks(fNSlots, fColumnNames, fDefines), fBlockResults(fNSlots), fBlockComputed(fNSlots)
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -116,9 +187,12 @@ public:
    {
       if (!fIsInitialized[slot]) {
          fIsInitialized[slot] = true;
-         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource};
+         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource,
+                                              fVariation, fProfiler};
          fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
          fLastCheckedEntry[slot] = -1;
+         fLastStagedEntry[slot] = -1;
+         fLastBlockEntry[slot] = -1;
       }
    }
 
@@ -130,6 +204,7 @@ public:
    {
       if (entry != fLastCheckedEntry[slot]) {
          // evaluate this filter, cache the result
+         RDFInternal::RNodeTimer::RScope timerScope(fTimer, slot);
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot] = entry;
       }
@@ -137,6 +212,32 @@ public:
 
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
 
+   bool SupportsBulk() const final
+   {
+      return IsBulk_t::value && fVariation == "nominal" && fColumnBlocks.SupportsBulk();
+   }
+
+   void StageEntry(unsigned int slot, std::size_t idx, Long64_t entry) final
+   {
+      // several nodes might read this define
+      if (entry == fLastStagedEntry[slot])
+         return;
+      fColumnBlocks.Stage(slot, idx, entry, fValues[slot]);
+      fLastStagedEntry[slot] = entry;
+   }
+
+   void *UpdateBulk(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries) final
+   {
+      if (entries[0] != fLastBlockEntry[slot]) {
+         // a new block: no value has been computed yet
+         fBlockResults[slot].resize(entries.size());
+         fBlockComputed[slot].assign(entries.size(), 0);
+         fLastBlockEntry[slot] = entries[0];
+      }
+      UpdateBulkHelper(slot, mask, entries, ColumnTypes_t{}, TypeInd_t{}, IsBulk_t{});
+      return &fBlockResults[slot];
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinaliseSlot(unsigned int slot) final
    {
@@ -145,6 +246,24 @@ public:
             v.reset();
          fIsInitialized[slot] = false;
       }
+      for (auto &variedDefine : fVariedDefines)
+         variedDefine.second->FinaliseSlot(slot);
+   }
+
+   std::vector<std::string> GetVariations() const final { return fDefines.GetVariationDeps(fColumnNames); }
+
+   /// Return the clone of this define for the given variation, creating it if needed.
+   /// Clones must be created before the event loop starts, as this method is not thread-safe.
+   RDefineBase &GetVariedDefine(const std::string &variationName) final
+   {
+      auto it = fVariedDefines.find(variationName);
+      if (it != fVariedDefines.end())
+         return *it->second;
+
+      auto variedDefine = MakeVariedDefine(variationName, std::is_copy_constructible<F>{});
+      auto &ret = *variedDefine;
+      fVariedDefines[variationName] = std::move(variedDefine);
+      return ret;
    }
 };
 
@@ -13,11 +13,14 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RNodeTimer.hxx"
 
+#include <cstddef> // std::size_t
 #include <deque>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class TTreeReader;
@@ -39,6 +42,10 @@ protected:
    unsigned int fNStopsReceived{0}; ///< number of times that a children node signaled to stop processing entries.
    const unsigned int fNSlots;      ///< number of thread slots used by this node, inherited from parent node.
    std::vector<Long64_t> fLastCheckedEntry;
+   /// Bulk event loops: per slot, the last entry whose inputs were read, and the first entry of the last block for
+   /// which values were computed
+   std::vector<Long64_t> fLastStagedEntry;
+   std::vector<Long64_t> fLastBlockEntry;
    /// A unique ID that identifies this custom column.
    /// Used e.g. to distinguish custom columns with the same name in different branches of the computation graph.
    const unsigned int fID = GetNextID();
@@ -46,13 +53,22 @@ protected:
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
    const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
    ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+   /// The systematic variation for which this node computes values: "nominal" or e.g. "pt:up".
+   const std::string fVariation;
+   /// Clones of this define that compute values for the systematic variations it depends on, keyed by variation name.
+   std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
+   /// The time spent evaluating the expression of this define, if the event loop is profiled
+   RDFInternal::RNodeTimer fTimer;
+   /// The timers of the reads of the input columns if the event loop is profiled, nullptr otherwise
+   RDFInternal::RProfiler *fProfiler = nullptr;
 
    static unsigned int GetNextID();
 
 public:
    RDefineBase(std::string_view name, std::string_view type, unsigned int nSlots,
                const RDFInternal::RBookedDefines &defines,
-               const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+               const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds,
+               const std::string &variationName = "nominal");
 
    RDefineBase &operator=(const RDefineBase &) = delete;
    RDefineBase &operator=(RDefineBase &&) = delete;
@@ -62,13 +78,28 @@ public:
    virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
-   std::string GetTypeName() const;
+   virtual std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) = 0;
    /// Return the unique identifier of this RDefineBase.
    unsigned int GetID() const { return fID; }
+   /// Return the names of the systematic variations (e.g. "pt:up") that affect the values of this column.
+   virtual std::vector<std::string> GetVariations() const = 0;
+   /// Return a clone of this define that evaluates its expression on the inputs varied by the given variation.
+   virtual RDefineBase &GetVariedDefine(const std::string &variationName) = 0;
+   /// Enable profiling for the next event loop, or disable it if profiler is null. Not thread-safe.
+   /// Varied clones of this define are not profiled: their time is accounted to the nodes that read them.
+   virtual void EnableProfiling(RDFInternal::RProfiler *profiler);
+   virtual const RDFInternal::RNodeTimer &GetTimer() const { return fTimer; }
+   /// Whether this define can compute its values block-wise in bulk event loops (see RLoopManager::SetBulkSize).
+   virtual bool SupportsBulk() const { return false; }
+   /// Bulk event loops: read the inputs of this define for the entry at position idx of the current block of the slot.
+   virtual void StageEntry(unsigned int /*slot*/, std::size_t /*idx*/, Long64_t /*entry*/) {}
+   /// Bulk event loops: compute the values of the entries of the current block of the slot that are selected by mask,
+   /// if not done yet. Return the (type-erased) address of the block of values, an RColumnBlock_t of the column type.
+   virtual void *UpdateBulk(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries);
 };
 
 } // ns RDF
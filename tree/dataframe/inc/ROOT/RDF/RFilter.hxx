@@ -12,6 +12,7 @@
 #define ROOT_RFILTER
 
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnBlocks.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/Utils.hxx"
@@ -22,8 +23,12 @@
 #include "RtypesCore.h"
 
 #include <algorithm>
+#include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept> // std::runtime_error
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -49,26 +54,35 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 
+class RJittedFilter;
+
 template <typename FilterF, typename PrevDataFrame>
 class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    using ColumnTypes_t = typename CallableTraits<FilterF>::arg_types;
    using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   // varied clones of a filter downstream of a jitted filter hang from the (concrete) varied clone of the latter
+   using PrevNode_t = std::conditional_t<std::is_same<PrevDataFrame, RJittedFilter>::value, RFilterBase, PrevDataFrame>;
+   using ColumnBlocks_t = RDFInternal::RColumnBlocks<ColumnTypes_t>;
 
    FilterF fFilter;
    const ColumnNames_t fColumnNames;
-   const std::shared_ptr<PrevDataFrame> fPrevDataPtr;
-   PrevDataFrame &fPrevData;
+   const std::shared_ptr<PrevNode_t> fPrevDataPtr;
+   PrevNode_t &fPrevData;
    /// Column readers per slot and per input column
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+   /// Bulk event loops: the blocks of values of the input columns
+   ColumnBlocks_t fColumnBlocks;
 
 public:
-   RFilter(FilterF f, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd,
-           const RDFInternal::RBookedDefines &defines, std::string_view name = "")
-      : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), defines),
+   RFilter(FilterF f, const ColumnNames_t &columns, std::shared_ptr<PrevNode_t> pd,
+           const RDFInternal::RBookedDefines &defines, std::string_view name = "",
+           const std::string &variationName = "nominal")
+      : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), defines,
+                    variationName),
         fFilter(std::move(f)), fColumnNames(columns), fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr),
-        fValues(fNSlots), fIsDefine()
+        fValues(fNSlots), fIsDefine(), fColumnBlocks(fNSlots, fColumnNames, fDefines)
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -101,18 +115,77 @@ public:
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
+      RDFInternal::RNodeTimer::RScope timerScope(fTimer, slot);
       // silence "unused parameter" warnings in gcc
       (void)slot;
       (void)entry;
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   bool SupportsBulk() const final
+   {
+      return fVariation == "nominal" && fColumnBlocks.SupportsBulk() && fPrevData.SupportsBulk();
+   }
+
+   void StageEntry(unsigned int slot, std::size_t idx, Long64_t entry) final
+   {
+      // several nodes might hang from this filter
+      if (entry == fLastStagedEntry[slot])
+         return;
+      fColumnBlocks.Stage(slot, idx, entry, fValues[slot]);
+      fPrevData.StageEntry(slot, idx, entry);
+      fLastStagedEntry[slot] = entry;
+   }
+
+   const char *CheckFiltersBulk(unsigned int slot, const std::vector<Long64_t> &entries) final
+   {
+      if (entries[0] != fLastCheckedBlock[slot]) {
+         const char *prevMask = fPrevData.CheckFiltersBulk(slot, entries);
+         fBlockMasks[slot].resize(entries.size());
+         CheckFiltersBulkHelper(slot, prevMask, entries, ColumnTypes_t{}, TypeInd_t{},
+                                typename ColumnBlocks_t::IsBulk_t{});
+         fLastCheckedBlock[slot] = entries[0];
+      }
+      return fBlockMasks[slot].data();
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFiltersBulkHelper(unsigned int slot, const char *prevMask, const std::vector<Long64_t> &entries,
+                               TypeList<ColTypes...>, std::index_sequence<S...>, std::true_type)
+   {
+      // only the entries that pass the upstream filters are evaluated, as in entry-wise event loops
+      auto inputs = std::forward_as_tuple(fColumnBlocks.template Get<S>(slot, prevMask, entries)...);
+      RDFInternal::RNodeTimer::RScope timerScope(fTimer, slot);
+      auto *mask = fBlockMasks[slot].data();
+      ULong64_t accepted = 0;
+      ULong64_t rejected = 0;
+      const auto n = entries.size();
+      for (std::size_t i = 0; i < n; ++i) {
+         if (prevMask[i]) {
+            const bool passed = fFilter(std::get<S>(inputs)[i]...);
+            mask[i] = passed;
+            passed ? ++accepted : ++rejected;
+         } else {
+            mask[i] = 0;
+         }
+      }
+      fAccepted[slot] += accepted;
+      fRejected[slot] += rejected;
+      (void)inputs; // avoid "unused variable" warnings for filters without inputs
+   }
+
+   template <typename ColTypeList, typename Seq>
+   void CheckFiltersBulkHelper(unsigned int, const char *, const std::vector<Long64_t> &, ColTypeList, Seq,
+                               std::false_type)
+   {
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       for (auto &bookedBranch : fDefines.GetColumns())
          bookedBranch.second->InitSlot(r, slot);
       RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                                           fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDataSource(), fVariation, fProfiler};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
    }
 
@@ -135,8 +208,9 @@ public:
    void IncrChildrenCount() final
    {
       ++fNChildren;
-      // propagate "children activation" upstream. named filters do the propagation via `TriggerChildrenCount`.
-      if (fNChildren == 1 && fName.empty())
+      // propagate "children activation" upstream. named filters do the propagation via `TriggerChildrenCount`,
+      // except for varied clones, which are not registered as named filters in the loop manager.
+      if (fNChildren == 1 && (fName.empty() || fVariation != "nominal"))
          fPrevData.IncrChildrenCount();
    }
 
@@ -158,11 +232,52 @@ public:
    {
       for (auto &column : fDefines.GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variations : fDefines.GetVariations())
+         for (auto &variation : variations.second)
+            variation->FinaliseSlot(slot);
 
       for (auto &v : fValues[slot])
          v.reset();
    }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      auto variations = fPrevData.GetVariations();
+      for (auto &variation : fDefines.GetVariationDeps(fColumnNames))
+         if (!RDFInternal::IsStrInVec(variation, variations))
+            variations.emplace_back(std::move(variation));
+      return variations;
+   }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final
+   {
+      auto it = fVariedFilters.find(variationName);
+      if (it != fVariedFilters.end())
+         return it->second;
+
+      auto variedFilter = MakeVariedFilter(variationName, std::is_copy_constructible<FilterF>{});
+      fLoopManager->Book(variedFilter.get());
+      fVariedFilters[variationName] = variedFilter;
+      return variedFilter;
+   }
+
+private:
+   std::shared_ptr<RFilterBase> MakeVariedFilter(const std::string &variationName, std::true_type)
+   {
+      auto prevNode = fPrevDataPtr;
+      if (RDFInternal::IsStrInVec(variationName, fPrevData.GetVariations()))
+         prevNode = std::static_pointer_cast<PrevNode_t>(fPrevData.GetVariedFilter(variationName));
+
+      // the varied filter evaluates a copy of the same expression on the varied inputs
+      return std::make_shared<RFilter>(fFilter, fColumnNames, std::move(prevNode), fDefines, fName, variationName);
+   }
+
+   std::shared_ptr<RFilterBase> MakeVariedFilter(const std::string &, std::false_type)
+   {
+      throw std::runtime_error("Filter expressions that cannot be copied do not support systematic variations.");
+   }
+
+public:
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // Recursively call for the previous node.
@@ -13,10 +13,13 @@
 
 #include "ROOT/RDF/RBookedDefines.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeTimer.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R_ASSERT
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class TTreeReader;
@@ -39,14 +42,27 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Bulk event loops: per slot, the last entry whose inputs were read, the first entry of the last block whose
+   /// selection was computed, and the selection of that block
+   std::vector<Long64_t> fLastStagedEntry;
+   std::vector<Long64_t> fLastCheckedBlock;
+   std::vector<std::vector<char>> fBlockMasks;
    const std::string fName;
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedDefines fDefines;
+   /// The systematic variation for which this node performs its selection: "nominal" or e.g. "pt:up".
+   const std::string fVariation;
+   /// Clones of this filter that select entries for the systematic variations it depends on, keyed by variation name.
+   std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// The time spent evaluating this filter, if the event loop is profiled
+   RDFInternal::RNodeTimer fTimer;
+   /// The timers of the reads of the input columns if the event loop is profiled, nullptr otherwise
+   RDFInternal::RProfiler *fProfiler = nullptr;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
-               const RDFInternal::RBookedDefines &defines);
+               const RDFInternal::RBookedDefines &defines, const std::string &variationName = "nominal");
    RFilterBase &operator=(const RFilterBase &) = delete;
 
    virtual ~RFilterBase();
@@ -54,6 +70,7 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   const std::string &GetVariation() const { return fVariation; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -67,6 +84,12 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// The Defines available to this filter, i.e. all the Defines booked upstream of it.
+   virtual const RDFInternal::RBookedDefines &GetDefines() const { return fDefines; }
+   /// Enable profiling of this filter and of its Defines for the next event loop, or disable it if profiler is null.
+   /// Not thread-safe.
+   virtual void EnableProfiling(RDFInternal::RProfiler *profiler);
+   virtual const RDFInternal::RNodeTimer &GetTimer() const { return fTimer; }
 };
 
 } // ns RDF
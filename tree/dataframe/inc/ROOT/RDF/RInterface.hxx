@@ -17,10 +17,13 @@
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
+#include "ROOT/RResultMap.hxx"
 #include "ROOT/RResultPtr.hxx"
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/TypeTraits.hxx"
@@ -35,6 +38,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdio> // std::remove
 #include <initializer_list>
 #include <limits>
 #include <memory>
@@ -74,6 +78,12 @@ class RInterface;
 
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
 
+/// How Fill fills the object in multi-thread event loops
+enum class EFillStrategy {
+   kPerSlot, ///< Fill a copy of the object per processing slot, merge the copies at the end (the default)
+   kShared   ///< Fill a single object shared by all slots, buffering the values in each slot: bounded memory usage
+};
+
 // clang-format off
 /**
  * \class ROOT::RDF::RInterface
@@ -423,6 +433,109 @@ public:
       return newInterface;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column.
+   /// \param[in] colName The name of the column to vary.
+   /// \param[in] expression The callable that computes the varied values: it must return a RVec with one value per
+   /// variation tag, in the same order as the tags.
+   /// \param[in] inputColumns The names of the columns to be passed to the callable.
+   /// \param[in] variationTags The names of the variations, e.g. {"down", "up"}.
+   /// \param[in] variationName A name for this group of variations. If empty, the name of the varied column is used.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// Vary does not change the nominal value of the column. Instead, for every result of a downstream action, it
+   /// declares alternative values that the column takes in each systematic variation. The variations are named
+   /// "variationName:tag", e.g. "pt:up". Use ROOT::RDF::Experimental::VariationsFor to retrieve the varied results.
+   ///
+   /// All variations are produced in the same event loop as the nominal results. The downstream Filter and Define
+   /// nodes that depend on the varied column are evaluated once per variation, all other nodes are evaluated once per
+   /// entry as usual. The varied results of an action are only computed if VariationsFor is called on it.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto nominal_hx =
+   ///    df.Vary("pt", [] (double pt) { return RVecD{pt*0.9, pt*1.1}; }, {"pt"}, {"down", "up"})
+   ///      .Filter("pt > k")
+   ///      .Define("x", someFunc, {"pt"})
+   ///      .Histo1D("x");
+   ///
+   /// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+   /// hx["nominal"].Draw();
+   /// hx["pt:down"].Draw("SAME");
+   /// hx["pt:up"].Draw("SAME");
+   /// ~~~
+   ///
+   /// \note Variations are not supported downstream of Range, and only the Count, Sum, Mean, StdDev, Min, Max, Fill
+   /// and Histo/Profile actions can produce varied results.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using F_t = typename std::decay<F>::type;
+      using RetType = typename TTraits::CallableTraits<F_t>::ret_type;
+      static_assert(RDFInternal::IsRVec_t<RetType>::value,
+                    "Vary expressions must return a RVec with one value per variation tag.");
+      using VariedCol_t = typename RetType::value_type;
+      static_assert(!std::is_same<VariedCol_t, bool>::value,
+                    "Vary expressions cannot return RVec<bool>: varied values must be addressable.");
+      using ColTypes_t = typename TTraits::CallableTraits<F_t>::arg_types;
+      constexpr auto nColumns = ColTypes_t::list_size;
+
+      if (variationTags.empty())
+         throw std::runtime_error("Vary: at least one variation tag must be specified.");
+
+      const auto validColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, inputColumns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      const std::string theVariationName = variationName.empty() ? validColName : std::string(variationName);
+      auto variationsIt = fDefines.GetVariations().find(validColName);
+      if (variationsIt != fDefines.GetVariations().end()) {
+         for (const auto &variation : variationsIt->second)
+            if (variation->GetVariationName() == theVariationName)
+               throw std::runtime_error("Vary: column \"" + validColName + "\" already has a variation named \"" +
+                                        theVariationName + "\".");
+      }
+
+      auto retTypeName = RDFInternal::TypeID2TypeName(typeid(VariedCol_t));
+      if (retTypeName.empty())
+         retTypeName = "CLING_UNKNOWN_TYPE_" + RDFInternal::DemangleTypeIdName(typeid(VariedCol_t));
+
+      auto variation = std::make_shared<RDFInternal::RVariation<F_t>>(
+         validColName, theVariationName, variationTags, retTypeName, std::move(expression), validColumnNames,
+         fLoopManager->GetNSlots(), fDefines, fLoopManager->GetDSValuePtrs(), fDataSource);
+
+      RDFInternal::RBookedDefines newCols(fDefines);
+      newCols.AddVariation(variation);
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column, with tags "0", "1", ..., "nVariations-1".
+   /// \param[in] colName The name of the column to vary.
+   /// \param[in] expression The callable that computes the varied values: it must return a RVec with `nVariations`
+   /// elements.
+   /// \param[in] inputColumns The names of the columns to be passed to the callable.
+   /// \param[in] nVariations The number of variations.
+   /// \param[in] variationName A name for this group of variations. If empty, the name of the varied column is used.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// See the other Vary overload for more information.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      variationTags.reserve(nVariations);
+      for (std::size_t i = 0u; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+
+      return Vary(colName, std::move(expression), inputColumns, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns to disk, in a new TTree `treename` in file `filename`.
    /// \tparam ColumnTypes variadic list of branch/column types.
@@ -460,6 +573,17 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// The output can be written as an RNTuple instead of a TTree (experimental, requires ROOT to be built with
+   /// root7=ON); `treename` is then the name of the RNTuple and the returned RDataFrame reads it back:
+   /// ~~~{.cpp}
+   /// RSnapshotOptions opts;
+   /// opts.fOutputFormat = ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("outputNTuple", "outputFile.root", {"x"}, opts);
+   /// ~~~
+   /// In multi-thread runs every thread compresses its own clusters, which are appended to the output file one at a
+   /// time as they are completed. Only the "RECREATE" mode is supported, and the output cannot be placed in a
+   /// TDirectory.
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -495,7 +619,7 @@ public:
          std::string(filename), std::string(dirname), std::string(treename), columnList, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotOutputRDF(fullTreeName, filename, validCols, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          validCols, newRDF, snapHelperArgs, validCols.size());
@@ -647,6 +771,82 @@ public:
    /// The existing columns are matched against the regular expression. If the string provided
    /// is empty, all columns are selected. See the previous overloads for more information.
    RInterface<RLoopManager> Cache(std::string_view columnNameRegexp = "")
+   {
+      return Cache(columnNameRegexp, RCacheOptions());
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory
+   /// \param[in] columnList columns to be cached in memory.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overloads for more information.
+   RInterface<RLoopManager> Cache(std::initializer_list<std::string> columnList)
+   {
+      ColumnNames_t selectedColumns(columnList);
+      return Cache(selectedColumns);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory or in a scratch file on disk
+   /// \tparam ColumnTypes variadic list of branch/column types.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct that selects where and how the columns are cached.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// With `options.fStorage == ECacheStorage::kMemory` this is equivalent to the overloads without options.
+   ///
+   /// With `options.fStorage == ECacheStorage::kDiskSnapshot` this is a Snapshot of the selected columns to a
+   /// compressed scratch file in `options.fScratchDir` (the system's temporary directory by default), and the
+   /// returned `RDataFrame` reads the scratch file. This allows to cache datasets that do not fit in memory. No
+   /// cached entries are kept in memory: the file is written in clusters and read back one cluster at a time through
+   /// read buffers of about `options.fReadBufferSize` bytes per processing thread, and it is the operating system's
+   /// page cache that keeps the recently read parts of the file in RAM. The Snapshot event loop runs immediately.
+   /// The scratch file is removed when the returned `RDataFrame` and all of its nodes go out of scope.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts;
+   /// opts.fStorage = ROOT::RDF::ECacheStorage::kDiskSnapshot;
+   /// opts.fReadBufferSize = 128 * 1024 * 1024; // 128 MB
+   /// auto cached_df = df.Filter("x > 0").Cache<double, int>({"x", "y"}, opts);
+   /// ~~~
+   template <typename... ColumnTypes>
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (options.fStorage == ECacheStorage::kMemory || columnList.empty())
+         return Cache<ColumnTypes...>(columnList);
+
+      return CacheAsDiskSnapshot(options, [this, &columnList](const std::string &fileName, const RSnapshotOptions &snapOpts) {
+         return SnapshotImpl<ColumnTypes...>(RDFInternal::kCacheDatasetName, fileName, columnList, snapOpts);
+      });
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory or in a scratch file on disk
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct that selects where and how the columns are cached.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The types of the columns are inferred. See the previous overloads for more information.
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (options.fStorage == ECacheStorage::kMemory || columnList.empty())
+         return Cache(columnList);
+
+      return CacheAsDiskSnapshot(options, [this, &columnList](const std::string &fileName, const RSnapshotOptions &snapOpts) {
+         return Snapshot(RDFInternal::kCacheDatasetName, fileName, columnList, snapOpts);
+      });
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory or in a scratch file on disk
+   /// \param[in] columnNameRegexp The regular expression to match the column names to be selected. An empty string signals the selection of all columns.
+   /// \param[in] options RCacheOptions struct that selects where and how the columns are cached.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overloads for more information.
+   RInterface<RLoopManager> Cache(std::string_view columnNameRegexp, const RCacheOptions &options)
    {
       const auto definedColumns = fDefines.GetNames();
       auto *tree = fLoopManager->GetTree();
@@ -658,19 +858,20 @@ public:
       columnNames.insert(columnNames.end(), treeBranchNames.begin(), treeBranchNames.end());
       columnNames.insert(columnNames.end(), dsColumns.begin(), dsColumns.end());
       const auto selectedColumns = RDFInternal::ConvertRegexToColumns(columnNames, columnNameRegexp, "Cache");
-      return Cache(selectedColumns);
+      return Cache(selectedColumns, options);
    }
 
    ////////////////////////////////////////////////////////////////////////////
-   /// \brief Save selected columns in memory
-   /// \param[in] columnList columns to be cached in memory.
+   /// \brief Save selected columns in memory or in a scratch file on disk
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct that selects where and how the columns are cached.
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// See the previous overloads for more information.
-   RInterface<RLoopManager> Cache(std::initializer_list<std::string> columnList)
+   RInterface<RLoopManager> Cache(std::initializer_list<std::string> columnList, const RCacheOptions &options)
    {
       ColumnNames_t selectedColumns(columnList);
-      return Cache(selectedColumns);
+      return Cache(selectedColumns, options);
    }
 
    // clang-format off
@@ -682,7 +883,11 @@ public:
    /// \return the first node of the computation graph for which the event loop is limited to a certain range of entries.
    ///
    /// Note that in case of previous Ranges and Filters the selected range refers to the transformed dataset.
-   /// Ranges are only available if EnableImplicitMT has _not_ been called. Multi-thread ranges are not supported.
+   ///
+   /// If EnableImplicitMT has been called, Range can only be applied to the dataset itself (possibly after Defines),
+   /// not to Filters or to other Ranges. The range then selects entries by their global entry number, so results do
+   /// not depend on the number of threads, and entries outside of the selected interval are not read at all if every
+   /// branch of the computation graph starts with a Range.
    ///
    /// ### Example usage:
    /// ~~~{.cpp}
@@ -696,7 +901,9 @@ public:
       // check invariants
       if (stride == 0 || (end != 0 && end < begin))
          throw std::runtime_error("Range: stride must be strictly greater than 0 and end must be greater than begin.");
-      CheckIMTDisabled("Range");
+      if (ROOT::IsImplicitMTEnabled() && !std::is_same<Proxied, RLoopManager>::value)
+         throw std::runtime_error("Range was called with ImplicitMT enabled on a node other than the dataset itself, "
+                                  "e.g. after a Filter or another Range, which is not supported.");
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
@@ -1537,6 +1744,80 @@ public:
       return CreateAction<RDFInternal::ActionTags::Fill, RDFDetail::RInferredType>(columnList, h, h, columnList.size());
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return an object of type T on which `T::Fill` will be called once per event (*lazy action*)
+   ///
+   /// \tparam FirstColumn The first type of the column the values of which are used to fill the object.
+   /// \tparam OtherColumns A list of the other types of the columns the values of which are used to fill the object.
+   /// \tparam T The type of the object to fill. Automatically deduced.
+   /// \param[in] model The model to be considered to build the new return value.
+   /// \param[in] columnList A list containing the names of the columns that will be passed when calling `Fill`
+   /// \param[in] strategy How the object is filled in multi-thread event loops.
+   /// \return the filled object wrapped in a `RResultPtr`.
+   ///
+   /// With EFillStrategy::kPerSlot this is equivalent to the overload without the `strategy` parameter: each
+   /// processing slot fills its own copy of the object, and the copies are merged at the end of the event loop.
+   /// With EFillStrategy::kShared all slots fill the same object instead, so memory usage does not grow with the
+   /// number of threads. This matters for large objects such as finely binned TH3D or THnSparse. Each slot buffers the
+   /// values of a few thousand `Fill` calls and then performs them all at once:
+   /// - for TH1, TH2 and TH3 histograms with fixed axes, the slot finds the bins of the values on its own and adds them
+   ///   to the bin contents under per-shard locks, so slots filling different bins do not wait for each other;
+   /// - other objects (profiles, THn, THnSparse, ...) are filled while holding a single lock; if another slot holds it,
+   ///   the slot keeps buffering up to a fixed limit rather than waiting.
+   ///
+   /// In this mode collection columns fill the object once per element, while scalar columns (e.g. weights) contribute
+   /// the same value to each of these calls. THn and THnSparse objects, which cannot be copied, are cloned from the
+   /// model and can only be filled with this strategy.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto h = myDf.Fill<double, double, double>(TH3D("h", "h", 1000, 0, 1, 1000, 0, 1, 100, 0, 1), {"x", "y", "z"},
+   ///                                            ROOT::RDF::EFillStrategy::kShared);
+   /// ~~~
+   ///
+   template <typename FirstColumn, typename... OtherColumns, typename T>
+   RResultPtr<T> Fill(T &&model, const ColumnNames_t &columnList, EFillStrategy strategy)
+   {
+      if (strategy == EFillStrategy::kPerSlot)
+         return FillPerSlot<FirstColumn, OtherColumns...>(std::forward<T>(model), columnList,
+                                                          std::is_copy_constructible<T>());
+      auto h = RDFInternal::MakeSharedFillObject(std::forward<T>(model));
+      if (!RDFInternal::HistoUtils<T>::HasAxisLimits(*h)) {
+         throw std::runtime_error("The absence of axes limits is not supported yet.");
+      }
+      return CreateAction<RDFInternal::ActionTags::FillShared, FirstColumn, OtherColumns...>(columnList, h, h);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return an object of type T on which `T::Fill` will be called once per event (*lazy action*)
+   ///
+   /// This overload infers the types of the columns specified in columnList at runtime and just-in-time compiles the
+   /// method with these types. See previous overload for more information.
+   /// \tparam T The type of the object to fill. Automatically deduced.
+   /// \param[in] model The model to be considered to build the new return value.
+   /// \param[in] columnList The name of the columns read to fill the object.
+   /// \param[in] strategy How the object is filled in multi-thread event loops.
+   /// \return the filled object wrapped in a `RResultPtr`.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto h = myDf.Fill(TH3D("h", "h", 1000, 0, 1, 1000, 0, 1, 100, 0, 1), {"x", "y", "z"},
+   ///                    ROOT::RDF::EFillStrategy::kShared);
+   /// ~~~
+   ///
+   template <typename T>
+   RResultPtr<T> Fill(T &&model, const ColumnNames_t &columnList, EFillStrategy strategy)
+   {
+      if (strategy == EFillStrategy::kPerSlot)
+         return FillPerSlot(std::forward<T>(model), columnList, std::is_copy_constructible<T>());
+      auto h = RDFInternal::MakeSharedFillObject(std::forward<T>(model));
+      if (!RDFInternal::HistoUtils<T>::HasAxisLimits(*h)) {
+         throw std::runtime_error("The absence of axes limits is not supported yet.");
+      }
+      return CreateAction<RDFInternal::ActionTags::FillShared, RDFDetail::RInferredType>(columnList, h, h,
+                                                                                          columnList.size());
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Return a TStatistic object, filled once per event (*lazy action*)
    ///
@@ -1805,6 +2086,49 @@ public:
       return MakeResultPtr(rep, *fLoopManager, std::move(action));
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Measure the time spent in each node of the computation graph during the event loop
+   /// \return the resulting `RProfileReport` instance wrapped in a `RResultPtr`.
+   ///
+   /// Booking a `Profile` action enables timers in all Filters, Defines and actions booked for the same event loop,
+   /// as well as in the reading of each input column. The report lists, per node, the time spent in the node and the
+   /// number of entries it processed, summed over all processing slots (per-slot values are also available).
+   /// The time accounted to a node does not include the time spent in the nodes it depends on, e.g. a Filter's time
+   /// does not include the evaluation of the Defines it reads, which are reported separately: the most expensive
+   /// nodes of the graph can be read off `RProfileReport::Print` directly.
+   /// After the event loop, the nodes drawn by SaveGraph are also annotated with their time and number of entries.
+   ///
+   /// Profiling adds a small overhead per node and entry, so the total reported time is an upper bound for an
+   /// event loop run without profiling. Only the event loop that runs this action is profiled, independently of the
+   /// node of the graph `Profile` is called on.
+   ///
+   /// This action is *lazy*: upon invocation of
+   /// this method the calculation is booked but not executed. See RResultPtr
+   /// documentation.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto df = d.Define("pt", computePt, {"px", "py"}).Filter("pt > 10", "ptCut");
+   /// auto h = df.Histo1D("pt");
+   /// auto profile = df.Profile();
+   /// profile->Print();
+   /// std::cout << profile->At("Filter", "ptCut").GetTime() << std::endl;
+   /// ~~~
+   ///
+   RResultPtr<RProfileReport> Profile()
+   {
+      auto rep = std::make_shared<RProfileReport>();
+      using Helper_t = RDFInternal::ProfileHelper;
+      using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
+
+      auto action = std::make_unique<Action_t>(Helper_t(rep, fLoopManager), ColumnNames_t({}), fProxiedPtr,
+                                               RDFInternal::RBookedDefines(fDefines));
+
+      fLoopManager->Book(action.get());
+      fLoopManager->RequestProfiling();
+      return MakeResultPtr(rep, *fLoopManager, std::move(action));
+   }
+
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Returns the names of the available columns
    /// \return the container of column names.
@@ -1982,6 +2306,62 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   /// \brief Enable or disable batched jitting of the expressions of string-based Filters and Defines
+   /// \param[in] batched Whether the expressions of Filters and Defines booked from now on are compiled in batches
+   ///
+   /// By default, the expression of a string-based Filter or Define is compiled as soon as it is booked, in its own
+   /// interpreter transaction, so that errors in the expression are reported immediately. With batched jitting, the
+   /// expressions are instead compiled together in a single interpreter transaction right before the event loop
+   /// starts, or as soon as the type of a string-based Define is needed, e.g. to book a node that uses the column it
+   /// defines. This considerably reduces the time needed to set up large computation graphs, but errors in the
+   /// expressions are only reported at that point. Expressions that were already compiled, also by other RDataFrames,
+   /// are never compiled again; see ROOT::RDF::SetJitCacheDirectory to also reuse them across processes.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.SetBatchedJitting(true);
+   /// auto d = df.Define("z", "x + y");
+   /// auto f1 = d.Filter("x > 0");
+   /// auto f2 = f1.Filter("y < 4"); // the three expressions are compiled together when the event loop starts
+   /// ~~~
+   void SetBatchedJitting(bool batched) { fLoopManager->SetBatchedJitting(batched); }
+
+   /// \brief Return whether the expressions of string-based Filters and Defines are compiled in batches, see
+   /// SetBatchedJitting
+   bool GetBatchedJitting() const { return fLoopManager->GetBatchedJitting(); }
+
+   /// \brief Process the entries of the next event loops in blocks of the given size
+   /// \param[in] bulkSize The number of entries of a block. 1, the default, processes one entry at a time.
+   ///
+   /// In bulk event loops, the values of the input columns of all Filters, Defines and actions are copied into
+   /// contiguous blocks of bulkSize entries. Once a block is complete, each Filter computes which entries of the block
+   /// pass it, each Define computes its values for the entries that its readers select, and each action processes the
+   /// selected entries with a single call to the `ExecBulk` method of its helper. This avoids most of the per-entry
+   /// virtual calls of the computation graph and lets the compiler vectorize the loops of the helpers.
+   ///
+   /// Bulk processing is only used if all the nodes of the computation graph support it, otherwise the event loop
+   /// processes one entry at a time, which is logged on the RDataFrame log channel. Supported are:
+   /// - Filters and Defines whose input columns and, for Defines, whose values are of arithmetic type (except bool);
+   /// - Count, Sum, Mean, Min, Max and histograms with or without a model, on columns of arithmetic type (except bool);
+   /// - actions booked with Book whose helper implements `ExecBulk` (see Book).
+   /// Ranges, systematic variations, and all other actions are not supported.
+   ///
+   /// Results do not depend on the bulk size. Note however that all the input columns are read for every entry of a
+   /// block, also the ones that only nodes behind a Filter that rejects the entry use, and that callbacks registered
+   /// with RResultPtr::OnPartialResult see the results of all the entries of a block at once.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.SetBulkSize(256);
+   /// auto h = df.Filter([](float pt) { return pt > 20.f; }, {"pt"}).Histo1D({"h", "h", 100, 0., 200.}, "pt");
+   /// ~~~
+   void SetBulkSize(unsigned int bulkSize) { fLoopManager->SetBulkSize(bulkSize); }
+
+   /// \brief Return the number of entries that the event loops process together, see SetBulkSize
+   unsigned int GetBulkSize() const { return fLoopManager->GetBulkSize(); }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot
@@ -2103,6 +2483,10 @@ public:
    /// * Result_t &PartialUpdate(unsigned int slot): this method is optional, i.e. can be omitted. If present, it should
    ///   return the value of the partial result of this action for the given 'slot'. Different threads might call this
    ///   method concurrently, but will always pass different 'slot' numbers.
+   /// * void ExecBulk(unsigned int slot, const ColumnTypes *...columnValues, std::size_t n): this method is optional.
+   ///   If present and if all column types are arithmetic (but not bool), it is called instead of Exec in bulk event
+   ///   loops (see SetBulkSize). Each argument then points to the contiguous values of one column for the `n` entries
+   ///   of a block that pass the upstream Filters.
    /// * std::shared_ptr<Result_t> GetResultPtr() const: return a shared_ptr to the result of this action (of type
    ///   Result_t). The RResultPtr returned by Book will point to this object.
    ///
@@ -2377,6 +2761,28 @@ private:
       return *this; // never reached
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the RDataFrame returned by Snapshot.
+   /// An RNTuple can only be opened once it has been written, so for RNTuple outputs this returns an empty
+   /// placeholder that is replaced by an RDataFrame reading the output when the Snapshot action completes.
+   std::shared_ptr<ROOT::RDataFrame> MakeSnapshotOutputRDF(std::string_view fullTreeName, std::string_view filename,
+                                                           const ColumnNames_t &validCols,
+                                                           RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat != ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+         return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+
+      auto newRDF = std::make_shared<ROOT::RDataFrame>(0ull);
+      std::weak_ptr<ROOT::RDataFrame> weakRDF(newRDF);
+      const auto ntupleName = snapHelperArgs.fTreeName;
+      const auto fileName = snapHelperArgs.fFileName;
+      snapHelperArgs.fOnOutputWritten = [weakRDF, ntupleName, fileName, validCols]() {
+         if (auto rdf = weakRDF.lock())
+            *rdf = ROOT::RDataFrame(RDFInternal::MakeNTupleSnapshotDS(ntupleName, fileName), validCols);
+      };
+      return newRDF;
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -2394,7 +2800,7 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnList, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotOutputRDF(fullTreeName, filename, validCols, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs);
 
@@ -2423,6 +2829,42 @@ private:
       return cachedRDF;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Fill with EFillStrategy::kPerSlot, which copies the model in each processing slot
+   template <typename... ColumnTypes, typename T>
+   RResultPtr<T> FillPerSlot(T &&model, const ColumnNames_t &columnList, std::true_type /*isCopyable*/)
+   {
+      return Fill<ColumnTypes...>(std::forward<T>(model), columnList);
+   }
+
+   template <typename... ColumnTypes, typename T>
+   RResultPtr<T> FillPerSlot(T &&, const ColumnNames_t &, std::false_type /*isCopyable*/)
+   {
+      throw std::runtime_error("Fill: objects that cannot be copied can only be filled with EFillStrategy::kShared.");
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of Cache as a Snapshot to a scratch file
+   /// `snapshot` writes the cached columns to the given file and returns the result of the Snapshot action.
+   template <typename SnapshotFn>
+   RInterface<RLoopManager> CacheAsDiskSnapshot(const RCacheOptions &options, SnapshotFn &&snapshot)
+   {
+      const auto fileName = RDFInternal::MakeCacheScratchFileName(options.fScratchDir);
+      RInterface<RLoopManager> cachedRDF(std::make_shared<RLoopManager>(0));
+      try {
+         cachedRDF = *snapshot(fileName, RDFInternal::MakeCacheSnapshotOptions(options));
+      } catch (...) {
+         std::remove(fileName.c_str());
+         throw;
+      }
+      cachedRDF.fLoopManager->AdoptScratchFile(fileName);
+      // Single-thread TTree readers read ahead through a TTreeCache, size it to the read buffer size
+      auto *tree = cachedRDF.fLoopManager->GetTree();
+      if (tree != nullptr && options.fReadBufferSize > 0)
+         tree->SetCacheSize(std::min<ULong64_t>(options.fReadBufferSize, std::numeric_limits<Long64_t>::max()));
+      return cachedRDF;
+   }
+
 protected:
    RInterface(const std::shared_ptr<Proxied> &proxied, RLoopManager &lm,
               const RDFInternal::RBookedDefines &columns, RDataSource *ds)
@@ -15,7 +15,10 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
+#include <string>
+#include <vector>
 
 class TTreeReader;
 
@@ -57,9 +60,18 @@ public:
    void SetHasRun() final;
 
    std::shared_ptr<GraphDrawing::GraphNode> GetGraph();
+   std::string GetActionName() final;
+   void EnableProfiling(RProfiler *profiler) final;
+   const RNodeTimer &GetTimer() const final;
+   bool SupportsBulk() const final;
+   void StageEntry(unsigned int slot, std::size_t idx, Long64_t entry) final;
+   void RunBulk(unsigned int slot, const std::vector<Long64_t> &entries) final;
 
    // Helper for RMergeableValue
    std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> GetMergeableValue() const final;
+
+   std::vector<std::string> GetVariations() const final;
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final;
 };
 
 } // ns RDF
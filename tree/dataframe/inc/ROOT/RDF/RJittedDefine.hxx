@@ -15,6 +15,8 @@
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -30,11 +32,17 @@ namespace RDF {
 /// before the event-loop starts.
 class RJittedDefine : public RDefineBase {
    std::unique_ptr<RDefineBase> fConcreteDefine = nullptr;
+   /// Compile the expression of the column and return its type, if it was not known at construction time. This
+   /// happens when the expression is compiled in a batch with the others (see RInterface::SetBatchedJitting).
+   std::function<std::string()> fTypeResolver;
+   mutable std::string fResolvedType; ///< The type returned by fTypeResolver, once it has been called
 
 public:
    RJittedDefine(std::string_view name, std::string_view type, unsigned int nSlots,
-                       const std::map<std::string, std::vector<void *>> &DSValuePtrs)
-      : RDefineBase(name, type, nSlots, RDFInternal::RBookedDefines(), DSValuePtrs, nullptr)
+                       const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+                       std::function<std::string()> typeResolver = {})
+      : RDefineBase(name, type, nSlots, RDFInternal::RBookedDefines(), DSValuePtrs, nullptr),
+        fTypeResolver(std::move(typeResolver))
    {
    }
 
@@ -43,8 +51,16 @@ public:
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
+   std::string GetTypeName() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void FinaliseSlot(unsigned int slot) final;
+   std::vector<std::string> GetVariations() const final;
+   RDefineBase &GetVariedDefine(const std::string &variationName) final;
+   void EnableProfiling(RDFInternal::RProfiler *profiler) final;
+   const RDFInternal::RNodeTimer &GetTimer() const final;
+   bool SupportsBulk() const final;
+   void StageEntry(unsigned int slot, std::size_t idx, Long64_t entry) final;
+   void *UpdateBulk(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries) final;
 };
 
 } // ns RDF
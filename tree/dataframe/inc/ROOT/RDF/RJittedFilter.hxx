@@ -17,6 +17,7 @@
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 #include <vector>
@@ -50,6 +51,9 @@ public:
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
+   const RDFInternal::RBookedDefines &GetDefines() const final;
+   void EnableProfiling(RDFInternal::RProfiler *profiler) final;
+   const RDFInternal::RNodeTimer &GetTimer() const final;
    void IncrChildrenCount() final;
    void StopProcessing() final;
    void ResetChildrenCount() final;
@@ -59,6 +63,11 @@ public:
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinaliseSlot(unsigned int slot) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
+   std::vector<std::string> GetVariations() const final;
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
+   bool SupportsBulk() const final;
+   void StageEntry(unsigned int slot, std::size_t idx, Long64_t entry) final;
+   const char *CheckFiltersBulk(unsigned int slot, const std::vector<Long64_t> &entries) final;
 };
 
 } // ns RDF
@@ -12,6 +12,7 @@
 #define ROOT_RLOOPMANAGER
 
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeTimer.hxx"
 
 #include <functional>
 #include <map>
@@ -28,6 +29,7 @@ namespace ROOT {
 namespace RDF {
 class RCutFlowReport;
 class RDataSource;
+class RProfileReport;
 } // ns RDF
 
 namespace Internal {
@@ -101,6 +103,14 @@ class RLoopManager : public RNodeBase {
    std::vector<RFilterBase *> fBookedNamedFilters; ///< Contains a subset of fBookedFilters, i.e. only the named filters
    std::vector<RRangeBase *> fBookedRanges;
 
+   /// Files removed from disk when destroyed. It is a data member declared before the input TTree and data source, so
+   /// the files are only removed after they have been closed.
+   struct RScratchFiles {
+      std::vector<std::string> fFileNames;
+      ~RScratchFiles();
+   };
+   RScratchFiles fScratchFiles; ///< Files owned by this RLoopManager, e.g. the scratch file of a disk Cache
+
    /// Shared pointer to the input TTree. It does not delete the pointee if the TTree/TChain was passed directly as an
    /// argument to RDataFrame's ctor (in which case we let users retain ownership).
    std::shared_ptr<TTree> fTree{nullptr};
@@ -114,6 +124,21 @@ class RLoopManager : public RNodeBase {
    std::vector<TCallback> fCallbacks;                      ///< Registered callbacks
    std::vector<TOneTimeCallback> fCallbacksOnce; ///< Registered callbacks to invoke just once before running the loop
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Whether the lambdas of jitted Filters are declared to the interpreter in batches rather than when booked
+   bool fBatchedJitting{false};
+   /// Keys of the jitted lambdas used by this computation graph whose declaration might be pending
+   std::vector<std::string> fPendingLambdas;
+   /// Timers of the column reads and Defines of the last profiled event loop
+   RDFInternal::RProfiler fProfiler;
+   bool fProfileNextRun{false};   ///< Whether a Profile action was booked for the next event loop
+   bool fProfilingEnabled{false}; ///< Whether the timers of the nodes are currently enabled
+   double fLoopRealTime{0.};      ///< Wall-clock duration of the last event loop, in seconds
+   /// Number of entries processed together in bulk event loops, 1 for entry-wise event loops (see SetBulkSize)
+   unsigned int fBulkSize{1};
+   bool fRunInBulk{false}; ///< Whether the current event loop processes entries block-wise
+   /// Bulk event loops: per slot, the entries of the current block and the selection of this node (all entries)
+   std::vector<std::vector<Long64_t>> fBlockEntries;
+   std::vector<std::vector<char>> fBlockMasks;
 
    /// Registry of per-slot value pointers for booked data-source columns
    std::map<std::string, std::vector<void *>> fDSValuePtrMap;
@@ -129,11 +154,17 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   bool CanRunInBulk() const;
+   void AddEntryToBlock(unsigned int slot, Long64_t entry);
+   void RunBlock(unsigned int slot);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
+   void SetUpProfiling();
    void CleanUpNodes();
    void CleanUpTask(unsigned int slot);
    void EvalChildrenCounts();
+   bool HasActiveGlobalRanges() const;
+   std::pair<ULong64_t, ULong64_t> GetGlobalEntryRange() const;
 
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
@@ -141,8 +172,8 @@ public:
    RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches);
    RLoopManager(const RLoopManager &) = delete;
    RLoopManager &operator=(const RLoopManager &) = delete;
+   ~RLoopManager();
 
-   void JitDeclarations();
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run();
@@ -158,6 +189,8 @@ public:
    void Book(RRangeBase *rangePtr);
    void Deregister(RRangeBase *rangePtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   bool SupportsBulk() const final { return true; }
+   const char *CheckFiltersBulk(unsigned int slot, const std::vector<Long64_t> &entries) final;
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -165,14 +198,30 @@ public:
    void SetTree(const std::shared_ptr<TTree> &tree) { fTree = tree; }
    void IncrChildrenCount() final { ++fNChildren; }
    void StopProcessing() final { ++fNStopsReceived; }
-   void ToJitExec(const std::string &) const;
+   void ToJitExec(const std::string &);
    void AddColumnAlias(const std::string &alias, const std::string &colName) { fAliasColumnNameMap[alias] = colName; }
    const std::map<std::string, std::string> &GetAliasMap() const { return fAliasColumnNameMap; }
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void SetBatchedJitting(bool batched) { fBatchedJitting = batched; }
+   bool GetBatchedJitting() const { return fBatchedJitting; }
+   void SetBulkSize(unsigned int bulkSize);
+   unsigned int GetBulkSize() const { return fBulkSize; }
+   void AddPendingLambda(const std::string &expr) { fPendingLambdas.emplace_back(expr); }
+   std::vector<std::string> TakePendingLambdas()
+   {
+      std::vector<std::string> pending;
+      pending.swap(fPendingLambdas);
+      return pending;
+   }
    bool HasDSValuePtrs(const std::string &col) const;
    const std::map<std::string, std::vector<void *>> &GetDSValuePtrs() const { return fDSValuePtrMap; }
    void AddDSValuePtrs(const std::string &col, const std::vector<void *> ptrs);
+   /// Time the nodes of the computation graph during the next event loop, see RInterface::Profile
+   void RequestProfiling() { fProfileNextRun = true; }
+   void FillProfileReport(ROOT::RDF::RProfileReport &rep) const;
+   /// Take ownership of a file on disk: it is removed when this RLoopManager is destroyed.
+   void AdoptScratchFile(const std::string &fileName) { fScratchFiles.fFileNames.emplace_back(fileName); }
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
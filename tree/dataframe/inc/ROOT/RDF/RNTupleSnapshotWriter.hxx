@@ -0,0 +1,63 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNTUPLESNAPSHOTWRITER
+#define ROOT_RDF_RNTUPLESNAPSHOTWRITER
+
+#include "ROOT/RSnapshotOptions.hxx"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+}
+namespace Internal {
+namespace RDF {
+
+/// Type-erased RNTuple writer used by Snapshot when RSnapshotOptions::fOutputFormat is kRNTuple.
+///
+/// Every processing slot owns a separate RNTupleWriter with its own page sink, so that pages are packed and
+/// compressed by the worker threads in parallel. With more than one slot, the page sink of a slot keeps the sealed
+/// pages of its open cluster in memory and, when the cluster is committed, appends them to the page sink of the
+/// output file, which is shared by all slots and locked for the duration of the append.
+/// Entries of different slots end up in different clusters, in an undefined order.
+///
+/// The RNTuple-specific parts are implemented in the ROOTDataFrame library so that this header does not depend on
+/// ROOTNTuple; if ROOT was built without root7 the constructor throws.
+class RNTupleSnapshotWriter {
+   struct RImpl;
+   std::unique_ptr<RImpl> fImpl;
+
+public:
+   /// `typeNames` are the names of the types of the columns as returned by TypeID2TypeName.
+   RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                         const std::vector<std::string> &fieldNames, const std::vector<std::string> &typeNames,
+                         const ROOT::RDF::RSnapshotOptions &options);
+   RNTupleSnapshotWriter(const RNTupleSnapshotWriter &) = delete;
+   RNTupleSnapshotWriter &operator=(const RNTupleSnapshotWriter &) = delete;
+   ~RNTupleSnapshotWriter();
+
+   /// Create the writer of the slot if this is the first time the slot is used.
+   void InitSlot(unsigned int slot);
+   /// Write one entry; `values` holds the addresses of the values of the columns, in the order of the field names.
+   void Fill(unsigned int slot, const std::vector<void *> &values);
+   /// Commit the last cluster of all slots and write the footer of the output file.
+   void Finalize();
+};
+
+/// Create a data source that reads the given RNTuple, e.g. the output of an RNTuple Snapshot.
+std::unique_ptr<ROOT::RDF::RDataSource> MakeNTupleSnapshotDS(const std::string &ntupleName, const std::string &fileName);
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -13,7 +13,9 @@
 
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept> // std::logic_error
 #include <string>
 #include <vector>
 
@@ -63,6 +65,29 @@ public:
    }
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
+
+   /// Return the names of the systematic variations (e.g. "pt:up") that affect the selection of this node.
+   virtual std::vector<std::string> GetVariations() const { return {}; }
+
+   /// Return a clone of this node that performs its selection on the inputs varied by the given variation.
+   virtual std::shared_ptr<RNodeBase> GetVariedFilter(const std::string & /*variationName*/)
+   {
+      throw std::logic_error("This node does not support systematic variations.");
+   }
+
+   /// Whether this node can process entries block-wise in bulk event loops (see RLoopManager::SetBulkSize).
+   virtual bool SupportsBulk() const { return false; }
+
+   /// Bulk event loops: read the input columns of this node and of the nodes upstream for the entry at position idx
+   /// of the current block of the slot.
+   virtual void StageEntry(unsigned int /*slot*/, std::size_t /*idx*/, Long64_t /*entry*/) {}
+
+   /// Bulk event loops: return the selection of this node for the entries of the current block of the slot, one
+   /// char per entry, non-zero if the entry passes this node and all the nodes upstream.
+   virtual const char *CheckFiltersBulk(unsigned int /*slot*/, const std::vector<Long64_t> & /*entries*/)
+   {
+      throw std::logic_error("This node does not support bulk event loops.");
+   }
 };
 } // ns RDF
 } // ns Detail
@@ -0,0 +1,111 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODETIMER
+#define ROOT_RDF_RNODETIMER
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Accumulate, per processing slot, the time spent in a node of the computation graph and the number of times the
+/// node was evaluated.
+///
+/// The time accounted to a node does not include the time spent in other timed scopes that are opened while its own
+/// scope is open, e.g. the evaluation of the Defines a Filter reads or the reading of TTree branches: summing the
+/// times of all nodes does not count anything twice.
+/// Timers are disabled by default, in which case timing a scope only costs a branch.
+class RNodeTimer {
+   static constexpr std::size_t kCacheLineSize = 64;
+
+   /// The counters of a processing slot. They are padded so that the counters of two slots are never on the same
+   /// cache line, whatever the alignment of the vector storage: the slots update them concurrently at every entry.
+   struct RSlotCounters {
+      ULong64_t fNanoseconds = 0ull; ///< The time spent in the node
+      ULong64_t fCalls = 0ull;       ///< The number of times the node was evaluated
+      char fPadding[2 * kCacheLineSize - 2 * sizeof(ULong64_t)];
+   };
+
+   std::vector<RSlotCounters> fCounters;
+   bool fEnabled = false;
+
+public:
+   /// Add the time spent in the enclosing C++ scope to the given timer, if the timer is enabled
+   class RScope {
+      RNodeTimer *fTimer;
+      unsigned int fSlot;
+      ULong64_t fStart = 0ull;
+      ULong64_t fOuterNestedTime = 0ull; ///< Time spent in nested scopes by the scope that encloses this one
+
+      void Start();
+      void Stop();
+
+   public:
+      RScope(RNodeTimer &timer, unsigned int slot) : fTimer(timer.fEnabled ? &timer : nullptr), fSlot(slot)
+      {
+         if (fTimer)
+            Start();
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (fTimer)
+            Stop();
+      }
+   };
+
+   explicit RNodeTimer(unsigned int nSlots) : fCounters(nSlots) {}
+
+   /// Zero the counters and enable or disable the timer. Must not be called during the event loop.
+   void Reset(bool enable);
+   bool IsEnabled() const { return fEnabled; }
+   unsigned int GetNSlots() const { return fCounters.size(); }
+   ULong64_t GetNanoseconds(unsigned int slot) const { return fCounters[slot].fNanoseconds; }
+   ULong64_t GetCalls(unsigned int slot) const { return fCounters[slot].fCalls; }
+   /// The total time and number of evaluations in human-readable form, e.g. "0.123 s, 1000 entries", or an empty
+   /// string if the timer is disabled. Used to annotate the nodes drawn by SaveGraph.
+   std::string Summary() const;
+};
+
+/// The state of a profiled event loop that is shared by the nodes of the computation graph: the timers of the reads
+/// of the input columns, one per column, and the timers of the Defines, which are not known to RLoopManager.
+class RProfiler {
+   const unsigned int fNSlots;
+   std::mutex fMutex; ///< Protects fReadTimers, as column readers are created concurrently by the processing slots
+   std::map<std::string, std::unique_ptr<RNodeTimer>> fReadTimers;
+   std::vector<std::pair<std::string, const RNodeTimer *>> fDefineTimers;
+
+public:
+   explicit RProfiler(unsigned int nSlots) : fNSlots(nSlots) {}
+
+   /// Return the (enabled) timer of the reads of the given column, creating it if needed. Thread-safe.
+   RNodeTimer &GetReadTimer(const std::string &colName);
+   /// Register the timer of a Define with the given name, unless it was already registered. Not thread-safe.
+   void AddDefineTimer(const std::string &name, const RNodeTimer &timer);
+   /// Remove all timers. Must not be called during the event loop.
+   void Clear();
+   const std::map<std::string, std::unique_ptr<RNodeTimer>> &GetReadTimers() const { return fReadTimers; }
+   const std::vector<std::pair<std::string, const RNodeTimer *>> &GetDefineTimers() const { return fDefineTimers; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,82 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPROFILEREPORT
+#define ROOT_RPROFILEREPORT
+
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h"
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+} // End NS RDF
+} // End NS Detail
+
+namespace Internal {
+namespace RDF {
+class RNodeTimer;
+} // End NS RDF
+} // End NS Internal
+
+namespace RDF {
+
+/// Time spent in and entries processed by one node of the computation graph during a profiled event loop.
+class RNodeProfile {
+   friend class RProfileReport;
+
+   std::string fKind; ///< "Read" (reading of an input column), "Define", "Filter" or "Action"
+   std::string fName;
+   std::vector<double> fTimes;      ///< Per slot, in seconds
+   std::vector<ULong64_t> fEntries; ///< Per slot
+
+   RNodeProfile(const std::string &kind, const std::string &name, const ROOT::Internal::RDF::RNodeTimer &timer);
+
+public:
+   const std::string &GetKind() const { return fKind; }
+   const std::string &GetName() const { return fName; }
+   /// Time spent in this node, summed over all processing slots, in seconds. It does not include the time spent in
+   /// other nodes, e.g. in the Defines a Filter depends on or in reading its input columns.
+   double GetTime() const;
+   /// Number of entries processed by this node, summed over all processing slots.
+   ULong64_t GetEntries() const;
+   double GetTime(unsigned int slot) const { return fTimes.at(slot); }
+   ULong64_t GetEntries(unsigned int slot) const { return fEntries.at(slot); }
+   unsigned int GetNSlots() const { return fTimes.size(); }
+};
+
+/// The time spent in each node of the computation graph during an event loop, as returned by RInterface::Profile.
+class RProfileReport {
+   friend class ROOT::Detail::RDF::RLoopManager;
+
+   std::vector<RNodeProfile> fNodes;
+   double fRealTime = 0.; ///< Wall-clock duration of the event loop, in seconds
+
+   void AddNode(const std::string &kind, const std::string &name, const ROOT::Internal::RDF::RNodeTimer &timer);
+
+public:
+   using const_iterator = typename std::vector<RNodeProfile>::const_iterator;
+   /// Print the nodes sorted by decreasing time spent in them.
+   void Print() const;
+   /// Return the profile of the node of the given kind ("Read", "Define", "Filter" or "Action") and name.
+   /// Throws if there is no such node or if the name is ambiguous.
+   const RNodeProfile &At(std::string_view kind, std::string_view name) const;
+   double GetRealTime() const { return fRealTime; }
+   const_iterator begin() const { return fNodes.begin(); }
+   const_iterator end() const { return fNodes.end(); }
+};
+
+} // End NS RDF
+} // End NS ROOT
+
+#endif
@@ -14,8 +14,13 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "RtypesCore.h"
+#include "TROOT.h" // IsImplicitMTEnabled
 
 #include <memory>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace ROOT {
 
@@ -39,7 +44,8 @@ class RRange final : public RRangeBase {
 
 public:
    RRange(unsigned int start, unsigned int stop, unsigned int stride, std::shared_ptr<PrevData> pd)
-      : RRangeBase(pd->GetLoopManagerUnchecked(), start, stop, stride, pd->GetLoopManagerUnchecked()->GetNSlots()),
+      : RRangeBase(pd->GetLoopManagerUnchecked(), start, stop, stride, pd->GetLoopManagerUnchecked()->GetNSlots(),
+                   std::is_same<PrevData, RLoopManager>::value && ROOT::IsImplicitMTEnabled()),
         fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr) {}
 
    RRange(const RRange &) = delete;
@@ -51,6 +57,10 @@ public:
    /// Ranges act as filters when it comes to selecting entries that downstream nodes should process
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      // global ranges are stateless, so they can be checked concurrently by all slots
+      if (fIsGlobal)
+         return fPrevData.CheckFilters(slot, entry) && IsSelectedGlobalEntry(entry);
+
       if (entry != fLastCheckedEntry) {
          if (fHasStopped)
             return false;
@@ -98,6 +108,16 @@ public:
 
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+
+   std::vector<std::string> GetVariations() const final { return fPrevData.GetVariations(); }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final
+   {
+      // a varied Range would need its own entry counter per variation, which is not implemented
+      throw std::runtime_error("Systematic variation \"" + variationName +
+                               "\" affects a selection upstream of a Range, which is not supported.");
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
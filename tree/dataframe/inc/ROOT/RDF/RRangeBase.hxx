@@ -14,6 +14,8 @@
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "RtypesCore.h"
 
+#include <utility> // std::pair
+
 namespace ROOT {
 
 // fwd decl
@@ -39,17 +41,34 @@ protected:
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
+   /// If true, entries are selected based on their global entry number in the dataset instead of by counting the
+   /// entries that reach this node. This is the case for ranges booked directly on the dataset with IMT enabled:
+   /// their selection does not depend on the order in which entries are processed, nor on the number of threads.
+   const bool fIsGlobal;
 
    void ResetCounters();
 
 public:
    RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
-              const unsigned int nSlots);
+              const unsigned int nSlots, bool isGlobal);
 
    RRangeBase &operator=(const RRangeBase &) = delete;
    virtual ~RRangeBase();
 
    void InitNode() { ResetCounters(); }
+   bool IsGlobal() const { return fIsGlobal; }
+   /// Whether this range is part of the computation graph of the next event loop.
+   bool HasChildren() const { return fNChildren > 0; }
+   /// The smallest interval [begin, end) of global entry numbers that contains all the entries this range selects.
+   std::pair<ULong64_t, ULong64_t> GetGlobalEntryBounds() const;
+   /// Selection logic of global ranges. It mirrors the counting logic of RRange::CheckFilters, with the global
+   /// entry number playing the role of the number of entries processed so far, so that results are the same with
+   /// and without IMT.
+   bool IsSelectedGlobalEntry(Long64_t entry) const
+   {
+      const ULong64_t nProcessed = entry + 1;
+      return nProcessed > fStart && (fStop == 0 || nProcessed <= fStop) && (fStride == 1 || nProcessed % fStride == 0);
+   }
    virtual std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph() = 0;
 };
 
@@ -0,0 +1,94 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RTREEBULKREADER
+#define ROOT_RDF_RTREEBULKREADER
+
+#include <Rtypes.h> // Long64_t, Int_t
+#include <TBufferFile.h>
+
+#include <cstddef> // std::size_t
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TBranch;
+class TClass;
+class TTree;
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RTreeBulkReader
+\ingroup dataframe
+\brief Read the values of a TTree column one basket at a time.
+
+RTreeColumnReader uses this class to deserialize a whole basket of a simple branch with TBranch::GetBulkEntries
+(scalars of fundamental type) or TBranch::GetBulkEntriesJagged (variable-size arrays and std::vectors of fundamental
+type) instead of streaming each entry through a TTreeReaderValue or TTreeReaderArray.
+
+The entry to read is taken from the TTreeReader, so the same object works for TTrees, TChains and the entry ranges
+of multi-thread event loops. Eligibility is re-evaluated every time the reader moves to a new tree: branches that
+are not supported (friend trees, several leaves, type mismatches, split objects...) make Seek return -1, and the
+caller must fall back to its TTreeReaderValue or TTreeReaderArray.
+**/
+class RTreeBulkReader {
+   TTreeReader *fReader;
+   std::string fBranchName;
+   /// Name of the fundamental type of the values, as returned by TLeaf::GetTypeName (e.g. "Float_t").
+   std::string fTypeName;
+   /// For variable-size arrays: the std::vector class whose (unsplit) branches can be read in bulk, if any.
+   TClass *fVectorClass = nullptr;
+   /// Size in bytes of one value.
+   Int_t fValueSize = 0;
+   /// Whether the column is a variable-size array (true) or a scalar (false).
+   bool fJagged;
+
+   TTree *fTree = nullptr; ///< The tree for which fBranch was looked up.
+   Int_t fTreeNumber = -1; ///< The tree number of fTree in the TTreeReader's TChain, if any.
+   TBranch *fBranch = nullptr; ///< The branch to read in bulk, nullptr if bulk reading is not possible for fTree.
+
+   TBufferFile fBuffer{TBuffer::kWrite, 32 * 1024};
+   std::vector<Int_t> fOffsets; ///< Element offsets of each entry in fBuffer, for variable-size arrays.
+   Long64_t fFirst = 0; ///< First local entry of the basket in fBuffer.
+   Long64_t fEnd = 0;   ///< One past the last local entry of the basket in fBuffer.
+
+   void SetTree(TTree &tree);
+   bool LoadBasket(Long64_t entry);
+
+public:
+   /// \param[in] r The TTreeReader of the event loop.
+   /// \param[in] colName The name of the column, i.e. of the branch.
+   /// \param[in] valueType The fundamental type of the values (of the array elements for variable-size arrays).
+   /// \param[in] vectorType For variable-size arrays, the type of std::vector of valueType. nullptr for scalars.
+   RTreeBulkReader(TTreeReader &r, const std::string &colName, const std::type_info &valueType,
+                   const std::type_info *vectorType);
+
+   /// Make sure that the current entry of the TTreeReader is in the loaded basket, loading it if needed.
+   /// \param[out] loaded Set to true if a new basket was loaded.
+   /// \return The index of the current entry in the basket, or -1 if the entry must be read without bulk reading.
+   Long64_t Seek(bool &loaded);
+
+   /// The values of the loaded basket. The address is not necessarily aligned for the value type.
+   const char *GetData() const { return fBuffer.GetCurrent(); }
+
+   /// The number of values in the loaded basket.
+   std::size_t GetNValues() const { return fJagged ? fOffsets.back() : fEnd - fFirst; }
+
+   /// For variable-size arrays, the element offsets of each entry of the loaded basket (one more than the entries).
+   const std::vector<Int_t> &GetOffsets() const { return fOffsets; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -12,6 +12,7 @@
 #define ROOT_RDF_RTREECOLUMNREADER
 
 #include "RColumnReaderBase.hxx"
+#include "RTreeBulkReader.hxx"
 #include <ROOT/RMakeUnique.hxx>
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
@@ -19,23 +20,63 @@
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstring> // std::memcpy
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+/// Whether values (or array elements) of type T can be read one basket at a time with RTreeBulkReader.
+template <typename T>
+struct IsBulkReadable
+   : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {
+};
+
+/// The type RTreeColumnReader uses to store the values read by RTreeBulkReader: T itself if it can be read in bulk,
+/// a placeholder otherwise, so that the bulk code path compiles (and is never taken) for any T.
+template <typename T>
+using BulkValue_t = typename std::conditional<IsBulkReadable<T>::value, T, char>::type;
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderValues
+///
+/// Scalars of fundamental type stored in simple branches are read one basket at a time via an RTreeBulkReader;
+/// the TTreeReaderValue is used for all other branches.
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+   /// nullptr if T cannot be read in bulk.
+   std::unique_ptr<RTreeBulkReader> fBulkReader;
+   /// Aligned copy of the values of the basket loaded by fBulkReader.
+   std::vector<BulkValue_t<T>> fBulkValues;
+
+   void *GetImpl(Long64_t) final
+   {
+      if (fBulkReader) {
+         bool loaded = false;
+         const auto idx = fBulkReader->Seek(loaded);
+         if (idx >= 0) {
+            if (loaded) {
+               fBulkValues.resize(fBulkReader->GetNValues());
+               std::memcpy(fBulkValues.data(), fBulkReader->GetData(),
+                           fBulkValues.size() * sizeof(BulkValue_t<T>));
+            }
+            return &fBulkValues[idx];
+         }
+      }
+      return fTreeValue->Get();
+   }
 
-   void *GetImpl(Long64_t) final { return fTreeValue->Get(); }
 public:
    /// Construct the RTreeColumnReader. Actual initialization is performed lazily by the Init method.
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
-      : fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str()))
+      : fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str())),
+        fBulkReader(IsBulkReadable<T>::value
+                       ? std::make_unique<RTreeBulkReader>(r, colName, typeid(BulkValue_t<T>), nullptr)
+                       : nullptr)
    {
    }
 
@@ -52,10 +93,15 @@ public:
 
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderArrays.
 ///
-/// TTreeReaderArrays are used whenever the RDF column type is RVec<T>.
+/// TTreeReaderArrays are used whenever the RDF column type is RVec<T>. Variable-size arrays and std::vectors of
+/// fundamental type stored in simple branches are instead read one basket at a time via an RTreeBulkReader.
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<TTreeReaderArray<T>> fTreeArray;
+   /// nullptr if T cannot be read in bulk.
+   std::unique_ptr<RTreeBulkReader> fBulkReader;
+   /// Aligned copy of the elements of the basket loaded by fBulkReader.
+   std::vector<BulkValue_t<T>> fBulkValues;
 
    /// Enumerator for the memory layout of the branch
    enum class EStorageType : char { kContiguous, kUnknown, kSparse };
@@ -70,8 +116,35 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
    /// Whether we already printed a warning about performing a copy of the TTreeReaderArray contents
    bool fCopyWarningPrinted = false;
 
+   /// Point fRVec to the elements of the current entry in the basket loaded by fBulkReader, if possible.
+   bool GetFromBulkReader()
+   {
+      bool loaded = false;
+      const auto idx = fBulkReader->Seek(loaded);
+      if (idx < 0)
+         return false;
+      if (loaded) {
+         fBulkValues.resize(fBulkReader->GetNValues());
+         if (!fBulkValues.empty())
+            std::memcpy(fBulkValues.data(), fBulkReader->GetData(), fBulkValues.size() * sizeof(BulkValue_t<T>));
+      }
+      const auto &offsets = fBulkReader->GetOffsets();
+      const auto size = offsets[idx + 1] - offsets[idx];
+      if (size > 0) {
+         RVec<T> rvec(reinterpret_cast<T *>(fBulkValues.data()) + offsets[idx], size);
+         std::swap(fRVec, rvec);
+      } else {
+         RVec<T> emptyVec{};
+         std::swap(fRVec, emptyVec);
+      }
+      return true;
+   }
+
    void *GetImpl(Long64_t) final
    {
+      if (fBulkReader && GetFromBulkReader())
+         return &fRVec;
+
       auto &readerArray = *fTreeArray;
       // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
       // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
@@ -129,7 +202,11 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
 
 public:
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
-      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str()))
+      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str())),
+        fBulkReader(IsBulkReadable<T>::value
+                       ? std::make_unique<RTreeBulkReader>(r, colName, typeid(BulkValue_t<T>),
+                                                           &typeid(std::vector<BulkValue_t<T>>))
+                       : nullptr)
    {
    }
 
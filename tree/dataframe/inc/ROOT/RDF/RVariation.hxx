@@ -0,0 +1,125 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIATION
+#define ROOT_RVARIATION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+/// A node that evaluates, for each entry, all the systematic variations of a column at once.
+/// The expression returns a RVec with one varied value per variation tag.
+template <typename F>
+class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
+   using ColumnTypes_t = typename CallableTraits<F>::arg_types;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename CallableTraits<F>::ret_type;
+   using VariedCol_t = typename ret_type::value_type;
+
+   F fExpression;
+   const RDFDetail::ColumnNames_t fColumnNames;
+   /// The varied values computed for the last entry processed in each slot
+   std::vector<ret_type> fLastResults;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      fLastResults[slot] = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      // silence "unused parameter" warnings in gcc
+      (void)slot;
+      (void)entry;
+   }
+
+public:
+   RVariation(std::string_view colName, std::string_view variationName, const std::vector<std::string> &tags,
+              std::string_view type, F expression, const RDFDetail::ColumnNames_t &inputColumns, unsigned int nSlots,
+              const RBookedDefines &defines, const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+              ROOT::RDF::RDataSource *ds)
+      : RVariationBase(colName, variationName, tags, type, nSlots, defines, DSValuePtrs, ds),
+        fExpression(std::move(expression)), fColumnNames(inputColumns), fLastResults(fNSlots), fValues(fNSlots),
+        fIsDefine()
+   {
+      const auto nColumns = fColumnNames.size();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = fDefines.HasName(fColumnNames[i]);
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         // the inputs of a variation are always the nominal values
+         const std::string nominal = "nominal";
+         RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource, nominal};
+         fValues[slot] = MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fLastCheckedEntry[slot] = -1;
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot, std::size_t varIdx) final
+   {
+      return static_cast<void *>(&fLastResults[slot][varIdx]);
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(VariedCol_t); }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot]) {
+         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         if (fLastResults[slot].size() != fVariationNames.size()) {
+            throw std::runtime_error("The expression of variation \"" + fVariationName + "\" of column \"" +
+                                     fColumnName + "\" returned " + std::to_string(fLastResults[slot].size()) +
+                                     " values, but " + std::to_string(fVariationNames.size()) +
+                                     " variation tags were specified.");
+         }
+         fLastCheckedEntry[slot] = entry;
+      }
+   }
+
+   void FinaliseSlot(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         for (auto &v : fValues[slot])
+            v.reset();
+         fIsInitialized[slot] = false;
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIATION
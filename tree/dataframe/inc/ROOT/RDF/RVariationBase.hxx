@@ -0,0 +1,77 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIATIONBASE
+#define ROOT_RVARIATIONBASE
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h" // Long64_t
+
+#include <deque>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+}
+namespace Internal {
+namespace RDF {
+
+/// This type includes all parts of RVariation that do not depend on the callable signature.
+class RVariationBase {
+protected:
+   const std::string fColumnName;    ///< The name of the varied column.
+   const std::string fVariationName; ///< The name of the systematic variation, e.g. "pt".
+   /// The full names of the variations, one per tag, e.g. {"pt:down", "pt:up"}.
+   const std::vector<std::string> fVariationNames;
+   const std::string fType; ///< The type of the varied column as a text string.
+   const unsigned int fNSlots;
+   std::vector<Long64_t> fLastCheckedEntry;
+   RBookedDefines fDefines;
+   std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+
+public:
+   RVariationBase(std::string_view colName, std::string_view variationName, const std::vector<std::string> &tags,
+                  std::string_view type, unsigned int nSlots, const RBookedDefines &defines,
+                  const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+
+   RVariationBase(const RVariationBase &) = delete;
+   RVariationBase &operator=(const RVariationBase &) = delete;
+   virtual ~RVariationBase();
+
+   virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Return the (type-erased) address of the varied value for the given processing slot and variation index.
+   /// The address is only valid until the next call to Update.
+   virtual void *GetValuePtr(unsigned int slot, std::size_t varIdx) = 0;
+   virtual const std::type_info &GetTypeId() const = 0;
+   /// Compute the varied values for the given entry, if not done already.
+   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Clean-up operations to be performed at the end of a task.
+   virtual void FinaliseSlot(unsigned int slot) = 0;
+
+   const std::string &GetColumnName() const { return fColumnName; }
+   const std::string &GetVariationName() const { return fVariationName; }
+   const std::vector<std::string> &GetVariationNames() const { return fVariationNames; }
+   std::string GetTypeName() const { return fType; }
+   /// Return the position of the given variation (e.g. "pt:up") among the ones provided by this node.
+   std::size_t GetVariationIndex(const std::string &variationName) const;
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIATIONBASE
@@ -0,0 +1,57 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONREADER
+#define ROOT_RDF_RVARIATIONREADER
+
+#include "RColumnReaderBase.hxx"
+#include "RVariationBase.hxx"
+#include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
+
+#include <limits>
+#include <string>
+#include <typeinfo>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+void CheckVariationType(RVariationBase &variation, const std::type_info &tid);
+
+/// Column reader that provides the values of a varied column for one of its systematic variations.
+class R__CLING_PTRCHECK(off) RVariationReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Non-owning reference to the node responsible for the variations.
+   RVariationBase &fVariation;
+
+   /// The index of the variation this reader provides, among the ones computed by fVariation.
+   std::size_t fVariationIdx;
+
+   /// The slot this value belongs to.
+   unsigned int fSlot = std::numeric_limits<unsigned int>::max();
+
+   void *GetImpl(Long64_t entry) final
+   {
+      fVariation.Update(fSlot, entry);
+      // the varied values are recomputed for each entry, so the address must be retrieved after the update
+      return fVariation.GetValuePtr(fSlot, fVariationIdx);
+   }
+
+public:
+   RVariationReader(unsigned int slot, RVariationBase &variation, const std::string &variationName,
+                    const std::type_info &tid)
+      : fVariation(variation), fVariationIdx(variation.GetVariationIndex(variationName)), fSlot(slot)
+   {
+      CheckVariationType(variation, tid);
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,223 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIEDACTION
+#define ROOT_RVARIEDACTION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+
+#include <array>
+#include <memory>
+#include <stdexcept> // std::logic_error, std::runtime_error
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RJittedFilter;
+}
+} // namespace Detail
+
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
+
+// clang-format off
+/**
+ * \class ROOT::Internal::RDF::RVariedAction
+ * \ingroup dataframe
+ * \brief A RDataFrame node that produces the results of an action for each of its systematic variations
+ * \tparam Helper The action helper type, one instance of which is used per variation
+ * \tparam PrevNode The type of the parent node of the nominal action in the computation graph
+ * \tparam ColumnTypes_t A TypeList with the types of the input columns
+ *
+ * All variations are computed in the same event loop as the nominal action. For each variation, the action runs
+ * downstream of the varied clones of the filters and reads the varied values of the input columns: only the nodes
+ * that depend on a varied column are evaluated more than once per entry.
+ */
+// clang-format on
+template <typename Helper, typename PrevNode, typename ColumnTypes_t = typename Helper::ColumnTypes_t>
+class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   // varied filters downstream of a jitted filter hang from the (concrete) varied clone of the latter
+   using PrevNodeType =
+      std::conditional_t<std::is_same<PrevNode, RDFDetail::RJittedFilter>::value, RDFDetail::RFilterBase, PrevNode>;
+
+   /// Action helpers, one per variation.
+   std::vector<Helper> fHelpers;
+   /// Owning pointers to the upstream nodes of each variation: the varied clones of the filters upstream, or the
+   /// nominal upstream node if the selection does not depend on the variation.
+   std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
+   /// The names of the variations, in the same order as fHelpers.
+   const std::vector<std::string> fVariationNames;
+   /// Column readers per slot (outer dimension), per variation and per input column (inner dimension).
+   std::vector<std::vector<std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, ColumnTypes_t::list_size>>>
+      fInputValues;
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   static std::vector<std::shared_ptr<PrevNodeType>>
+   MakePrevNodes(const std::shared_ptr<PrevNodeType> &nominal, const std::vector<std::string> &variations)
+   {
+      const auto prevVariations = nominal->GetVariations();
+      std::vector<std::shared_ptr<PrevNodeType>> prevNodes;
+      prevNodes.reserve(variations.size());
+      for (const auto &variation : variations) {
+         if (IsStrInVec(variation, prevVariations))
+            prevNodes.emplace_back(std::static_pointer_cast<PrevNodeType>(nominal->GetVariedFilter(variation)));
+         else
+            prevNodes.emplace_back(nominal);
+      }
+      return prevNodes;
+   }
+
+public:
+   RVariedAction(std::vector<Helper> &&helpers, const ColumnNames_t &columns, std::shared_ptr<PrevNodeType> prevNode,
+                 const RBookedDefines &defines, const std::vector<std::string> &variations)
+      : RActionBase(prevNode->GetLoopManagerUnchecked(), columns, defines), fHelpers(std::move(helpers)),
+        fPrevNodes(MakePrevNodes(prevNode, variations)), fVariationNames(variations), fInputValues(GetNSlots()),
+        fIsDefine()
+   {
+      const auto nColumns = columns.size();
+      const auto &customCols = GetDefines();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = customCols.HasName(columns[i]);
+   }
+
+   RVariedAction(const RVariedAction &) = delete;
+   RVariedAction &operator=(const RVariedAction &) = delete;
+   // must call Deregister here, before fPrevNodes are destroyed,
+   // otherwise if one of them is fLoopManager we get a use after delete
+   ~RVariedAction() { fLoopManager->Deregister(this); }
+
+   void Initialize() final
+   {
+      // create the varied clones of the defines this action depends on now: during the event loop they are only
+      // looked up, possibly concurrently from several slots
+      for (auto &column : GetDefines().GetColumns()) {
+         auto &define = *column.second;
+         for (const auto &variation : define.GetVariations())
+            if (IsStrInVec(variation, fVariationNames))
+               define.GetVariedDefine(variation);
+      }
+
+      for (auto &h : fHelpers)
+         h.Initialize();
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      for (auto &bookedBranch : GetDefines().GetColumns())
+         bookedBranch.second->InitSlot(r, slot);
+
+      const auto nVariations = fVariationNames.size();
+      fInputValues[slot].resize(nVariations);
+      for (auto varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         RColumnReadersInfo info{GetColumnNames(), GetDefines(), fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
+                                 fLoopManager->GetDataSource(), fVariationNames[varIdx], fProfiler};
+         fInputValues[slot][varIdx] = MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fHelpers[varIdx].InitTask(r, slot);
+      }
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void
+   CallExec(unsigned int slot, unsigned int varIdx, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      fHelpers[varIdx].Exec(slot, fInputValues[slot][varIdx][S]->template Get<ColTypes>(entry)...);
+      (void)entry; // avoid "unused parameter" warnings
+   }
+
+   void Run(unsigned int slot, Long64_t entry) final
+   {
+      const auto nVariations = fVariationNames.size();
+      for (auto varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         if (fPrevNodes[varIdx]->CheckFilters(slot, entry)) {
+            RNodeTimer::RScope timerScope(fTimer, slot);
+            CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
+   }
+
+   void TriggerChildrenCount() final
+   {
+      for (auto &prev : fPrevNodes)
+         prev->IncrChildrenCount();
+   }
+
+   /// Clean-up operations to be performed at the end of a task.
+   void FinalizeSlot(unsigned int slot) final
+   {
+      for (auto &column : GetDefines().GetColumns())
+         column.second->FinaliseSlot(slot);
+      for (auto &variations : GetDefines().GetVariations())
+         for (auto &variation : variations.second)
+            variation->FinaliseSlot(slot);
+
+      fInputValues[slot].clear();
+      for (auto &h : fHelpers)
+         h.CallFinalizeTask(slot);
+   }
+
+   /// Clean-up and finalize the action results (e.g. merging slot-local results).
+   /// It invokes the helpers' Finalize methods.
+   void Finalize() final
+   {
+      for (auto &h : fHelpers)
+         h.Finalize();
+      SetHasRun();
+   }
+
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
+   std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph() final
+   {
+      // the varied action is drawn as a single node hanging from the nominal upstream node
+      auto prevNode = fPrevNodes[0]->GetGraph();
+      const auto profile = fTimer.Summary();
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(
+         profile.empty() ? GetActionName() : GetActionName() + "\n" + profile);
+      thisNode->AddDefinedColumns(prevNode->GetDefinedColumns());
+      thisNode->SetAction(HasRun());
+      thisNode->SetPrevNode(prevNode);
+      return thisNode;
+   }
+
+   void *PartialUpdate(unsigned int) final
+   {
+      throw std::runtime_error("Registering callbacks on varied results is not supported.");
+   }
+
+   std::unique_ptr<RDFDetail::RMergeableValueBase> GetMergeableValue() const final
+   {
+      throw std::logic_error("Varied actions do not provide mergeable values.");
+   }
+
+   std::vector<std::string> GetVariations() const final { return fVariationNames; }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&) final
+   {
+      throw std::logic_error("Cannot produce a varied action from a varied action.");
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIEDACTION
@@ -200,6 +200,9 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context = "
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
+/// Whether `str` is one of the elements of `vec`
+bool IsStrInVec(const std::string &str, const std::vector<std::string> &vec);
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
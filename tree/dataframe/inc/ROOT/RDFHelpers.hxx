@@ -112,6 +112,9 @@ auto PassAsVec(F &&f) -> RDFInternal::PassAsVecHelper<std::make_index_sequence<N
 /// Note that "hanging" Defines, i.e. Defines without downstream nodes, will not be displayed by SaveGraph as they are
 /// effectively optimized away from the computation graph.
 ///
+/// After an event loop that ran a Profile action, Filters, Defines and actions are annotated with the time spent in
+/// them and the number of entries they processed.
+///
 /// Note that SaveGraph is not thread-safe and must not be called concurrently from different threads.
 // clang-format on
 template <typename NodeType>
@@ -131,6 +134,9 @@ std::string SaveGraph(NodeType node)
 /// Note that "hanging" Defines, i.e. Defines without downstream nodes, will not be displayed by SaveGraph as they are
 /// effectively optimized away from the computation graph.
 ///
+/// After an event loop that ran a Profile action, Filters, Defines and actions are annotated with the time spent in
+/// them and the number of entries they processed.
+///
 /// Note that SaveGraph is not thread-safe and must not be called concurrently from different threads.
 // clang-format on
 template <typename NodeType>
@@ -181,6 +187,30 @@ RNode AsRNode(NodeType node)
 // clang-format on
 void RunGraphs(std::vector<RResultHandle> handles);
 
+// clang-format off
+/// Set the directory of the persistent cache of the expressions of string-based Filters and Defines
+/// \param[in] dir The cache directory, created if needed. An empty string disables the cache, which is the default.
+///
+/// When the cache is enabled, the expressions that are compiled together (see RInterface::SetBatchedJitting) are
+/// compiled with ACLiC, with optimizations, into a library in the cache directory named after the checksum of their
+/// code. Later processes that compile the same expressions load that library instead of compiling them again.
+/// Expressions that ACLiC cannot compile, e.g. because they use types for which only the interpreter knows the
+/// headers, are compiled by the interpreter as usual. The cache directory should not be shared by processes that
+/// might populate it concurrently.
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::SetJitCacheDirectory("rdfjitcache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// df.SetBatchedJitting(true);
+/// auto h = df.Define("pt2", "pt * pt").Filter("pt2 > 4").Histo1D<double>("pt2");
+/// ~~~
+// clang-format on
+void SetJitCacheDirectory(std::string_view dir);
+
+/// Return the directory of the persistent cache of jitted expressions, or an empty string if it is disabled, see
+/// SetJitCacheDirectory.
+std::string GetJitCacheDirectory();
+
 } // namespace RDF
 } // namespace ROOT
 #endif
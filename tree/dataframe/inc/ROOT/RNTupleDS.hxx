@@ -40,6 +40,18 @@ class RPageSource;
 } // namespace Detail
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
+public:
+   /// A closed interval [fMin, fMax] of values of a field.  Clusters whose column statistics show that no value of
+   /// the field is in the interval are skipped.  For collection fields, the interval refers to the collection size.
+   /// The cluster filter does not remove individual entries, so it complements a corresponding Filter() in the
+   /// computation graph.
+   struct RClusterFilter {
+      std::string fFieldName;
+      double fMin;
+      double fMax;
+   };
+
+private:
    /// Clones of the first source, one for each slot
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
 
@@ -49,8 +61,12 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
 
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
+   std::vector<RClusterFilter> fClusterFilters;
 
    void AddFields(const RNTupleDescriptor &desc, DescriptorId_t parentId);
+   /// The entry ranges of the clusters that pass the cluster filters; adjacent clusters are merged into ranges of
+   /// at most 1/fNSlots of the selected entries, so that all the slots get work
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetFilteredClusterRanges() const;
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
@@ -63,6 +79,11 @@ public:
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Clusters are only skipped if the ntuple was written with column statistics
+   /// (see RNTupleWriteOptions::SetUseColumnStatistics()).  Only top-level fields and fields of (nested) records
+   /// can be used to skip clusters, filters on fields inside collections have no effect.
+   void AddClusterFilter(const RClusterFilter &filter) { fClusterFilters.emplace_back(filter); }
+
    void Initialise() final;
    void Finalise() final;
 
@@ -74,6 +95,8 @@ protected:
 };
 
 RDataFrame MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName);
+RDataFrame MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName,
+                               const std::vector<RNTupleDS::RClusterFilter> &clusterFilters);
 
 } // ns Experimental
 } // ns ROOT
@@ -0,0 +1,141 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RESULTMAP
+#define ROOT_RDF_RESULTMAP
+
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RResultPtr.hxx"
+#include "TError.h" // R__ASSERT
+
+#include <memory>
+#include <stdexcept> // std::logic_error, std::runtime_error
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief A map from systematic variation names to the corresponding results of a RDataFrame action.
+\tparam T Type of the action result
+
+RResultMap objects are returned by VariationsFor(). The key "nominal" corresponds to the nominal result, the other
+keys to the systematic variations that affect the action, e.g. "pt:down" and "pt:up".
+Like RResultPtr, accessing a result triggers the event loop if the results have not been produced yet. All
+variations are computed in the same event loop as the nominal result.
+*/
+template <typename T>
+class RResultMap {
+   /// The keys of the map: "nominal" followed by the names of the variations, in booking order.
+   std::vector<std::string> fKeys;
+   std::unordered_map<std::string, std::shared_ptr<T>> fMap;
+   /// Non-owning pointer to the RLoopManager at the root of this computation graph.
+   /// The RLoopManager is guaranteed to be in scope: both actions have shared ownership of their upstream nodes.
+   ROOT::Detail::RDF::RLoopManager *fLoopManager;
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> fNominalAction;
+   /// The action that produces the varied results, if there are any.
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> fVariedAction;
+
+   friend RResultMap VariationsFor<T>(RResultPtr<T> resPtr);
+
+   RResultMap(std::shared_ptr<T> nominalResult, const std::vector<std::string> &variations,
+              std::vector<std::shared_ptr<T>> &&variedResults, ROOT::Detail::RDF::RLoopManager &lm,
+              std::shared_ptr<ROOT::Internal::RDF::RActionBase> nominalAction,
+              std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction)
+      : fKeys{"nominal"}, fLoopManager(&lm), fNominalAction(std::move(nominalAction)),
+        fVariedAction(std::move(variedAction))
+   {
+      R__ASSERT(variations.size() == variedResults.size());
+      fMap.emplace("nominal", std::move(nominalResult));
+      for (auto i = 0u; i < variations.size(); ++i) {
+         fKeys.emplace_back(variations[i]);
+         fMap.emplace(variations[i], std::move(variedResults[i]));
+      }
+   }
+
+public:
+   /// Return the result for the given key, running the event loop if needed.
+   T &operator[](const std::string &key)
+   {
+      auto it = fMap.find(key);
+      if (it == fMap.end())
+         throw std::runtime_error("RResultMap: no result with key \"" + key + "\".");
+
+      if (!fNominalAction->HasRun() || (fVariedAction != nullptr && !fVariedAction->HasRun()))
+         fLoopManager->Run();
+      return *it->second;
+   }
+
+   /// Return the keys of the map: "nominal" followed by the names of the variations.
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Produce all required systematic variations for the given result.
+/// \param[in] resPtr The nominal result.
+/// \return A RResultMap with the nominal result and one result per systematic variation affecting the action.
+///
+/// The varied results are computed in the same event loop as the nominal one. Only the Filter and Define nodes that
+/// depend on a varied column are evaluated once per variation: all other nodes are evaluated once per entry.
+/// This function must be called before the event loop that produces the nominal result runs.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// auto nominal_hx = df.Vary("pt", [] (double pt) { return RVecD{pt*0.9, pt*1.1}; }, {"pt"}, {"down", "up"})
+///                     .Filter("pt > k")
+///                     .Define("x", someFunc, {"pt"})
+///                     .Histo1D("x");
+///
+/// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+/// hx["nominal"].Draw();
+/// hx["pt:down"].Draw("SAME");
+/// ~~~
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   R__ASSERT(resPtr != nullptr && "Calling VariationsFor on an empty RResultPtr");
+   if (resPtr.fActionPtr->HasRun())
+      throw std::logic_error("VariationsFor must be called before the event loop that produces the result has run.");
+
+   // the variations that affect jitted nodes are only known after jitting
+   resPtr.fLoopManager->Jit();
+   const auto variations = resPtr.fActionPtr->GetVariations();
+   if (variations.empty())
+      return RResultMap<T>(resPtr.fObjPtr, {}, {}, *resPtr.fLoopManager, resPtr.fActionPtr, nullptr);
+
+   // the varied results start as copies of the nominal one, which has not been filled yet:
+   // each action helper resets them as needed
+   std::vector<std::shared_ptr<T>> variedResults;
+   variedResults.reserve(variations.size());
+   for (auto i = 0u; i < variations.size(); ++i)
+      variedResults.emplace_back(std::make_shared<T>(*resPtr.fObjPtr));
+
+   std::vector<void *> typeErasedResults;
+   typeErasedResults.reserve(variedResults.size());
+   for (auto &res : variedResults)
+      typeErasedResults.emplace_back(&res);
+
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction =
+      resPtr.fActionPtr->MakeVariedAction(std::move(typeErasedResults));
+   resPtr.fLoopManager->Book(variedAction.get());
+
+   return RResultMap<T>(resPtr.fObjPtr, variations, std::move(variedResults), *resPtr.fLoopManager,
+                        resPtr.fActionPtr, std::move(variedAction));
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RESULTMAP
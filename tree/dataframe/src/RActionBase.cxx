@@ -9,12 +9,23 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 
 using namespace ROOT::Internal::RDF;
 
 RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines)
-   : fLoopManager(lm), fNSlots(lm->GetNSlots()), fColumnNames(colNames), fDefines(defines) { }
+   : fLoopManager(lm), fTimer(lm->GetNSlots()), fNSlots(lm->GetNSlots()), fColumnNames(colNames), fDefines(defines)
+{
+}
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() {}
+
+void RActionBase::EnableProfiling(RProfiler *profiler)
+{
+   fTimer.Reset(profiler != nullptr);
+   fProfiler = profiler;
+   for (auto &define : fDefines.GetColumns())
+      define.second->EnableProfiling(profiler);
+}
@@ -23,6 +23,15 @@ ROOT::RDF::MakeArrowDataFrame, which accepts one parameter:
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
+A RDataFrame can also read an Arrow IPC file (also known as Feather v2 file) with
+ROOT::RDF::MakeArrowDataFrame(fileName, columns). The file is memory-mapped and only its schema
+is read when the data source is constructed. The record batches are read during the event loop,
+as many at a time as there are processing slots, and released once they are processed: the
+buffers of uncompressed batches reference the mapping, so that their contents are only paged in
+when the processing slots read them, while compressed batches are decompressed into memory.
+Each record batch is processed as one entry range, so that multi-thread event loops distribute
+the batches among the threads.
+
 */
 // clang-format on
 
@@ -41,8 +50,12 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
+#include <arrow/util/config.h>
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif
@@ -216,18 +229,29 @@ private:
 
 public:
    TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0)
    {
+      SetChunks(std::move(chunks), 0);
+      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
+         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
+      }
+   }
+
+   /// Replace the arrays to read by chunks, the first of which starts at firstEntry.
+   void SetChunks(arrow::ArrayVector chunks, ULong64_t firstEntry)
+   {
+      fChunks = std::move(chunks);
+      fFirstEntryPerChunk.clear();
+      fChunkIndex.clear();
       fChunkIndex.reserve(fChunks.size());
-      size_t next = 0;
-      for (auto &chunk : chunks) {
+      auto next = firstEntry;
+      for (auto &chunk : fChunks) {
          fFirstEntryPerChunk.push_back(next);
          next += chunk->length();
          fChunkIndex.push_back(next);
       }
-      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
-         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
-      }
+      std::fill(fLastEntryPerSlot.begin(), fLastEntryPerSlot.end(), firstEntry);
+      std::fill(fLastChunkPerSlot.begin(), fLastChunkPerSlot.end(), 0);
    }
 
    /// This returns the ptr to the ptr to actual data.
@@ -455,6 +479,86 @@ RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::strin
    }
 }
 
+namespace {
+
+void ThrowIfNotOk(const arrow::Status &status, const std::string &what)
+{
+   if (!status.ok())
+      throw std::runtime_error("RArrowDS: " + what + ": " + status.ToString());
+}
+
+/// Open the memory-mapped Arrow IPC file; the reader keeps the mapping alive.
+std::shared_ptr<arrow::ipc::RecordBatchFileReader> OpenArrowFile(std::string_view fileName)
+{
+   const std::string path(fileName);
+   std::shared_ptr<arrow::io::MemoryMappedFile> file;
+   std::shared_ptr<arrow::ipc::RecordBatchFileReader> reader;
+#if ARROW_VERSION_MAJOR > 0 || ARROW_VERSION_MINOR >= 17
+   auto fileResult = arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ);
+   ThrowIfNotOk(fileResult.status(), "cannot open " + path);
+   file = *fileResult;
+   auto readerResult = arrow::ipc::RecordBatchFileReader::Open(file);
+   ThrowIfNotOk(readerResult.status(), "cannot read " + path + " as an Arrow IPC file");
+   reader = *readerResult;
+#else
+   ThrowIfNotOk(arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ, &file), "cannot open " + path);
+   ThrowIfNotOk(arrow::ipc::RecordBatchFileReader::Open(file, &reader), "cannot read " + path + " as an Arrow IPC file");
+#endif
+   return reader;
+}
+
+/// Read one record batch of an Arrow IPC file. The buffers of an uncompressed record batch reference the mapping
+/// rather than copying it; a compressed record batch is decompressed here.
+std::shared_ptr<arrow::RecordBatch> ReadArrowBatch(arrow::ipc::RecordBatchFileReader &reader, int i)
+{
+   std::shared_ptr<arrow::RecordBatch> batch;
+#if ARROW_VERSION_MAJOR > 0 || ARROW_VERSION_MINOR >= 17
+   auto batchResult = reader.ReadRecordBatch(i);
+   ThrowIfNotOk(batchResult.status(), "cannot read record batch " + std::to_string(i));
+   batch = *batchResult;
+#else
+   ThrowIfNotOk(reader.ReadRecordBatch(i, &batch), "cannot read record batch " + std::to_string(i));
+#endif
+   return batch;
+}
+
+/// Make a table without rows with the schema of an Arrow IPC file, to check and look up its columns.
+std::shared_ptr<arrow::Table> MakeEmptyTable(const std::shared_ptr<arrow::ipc::RecordBatchFileReader> &reader)
+{
+   const std::vector<std::shared_ptr<arrow::RecordBatch>> noBatches;
+   std::shared_ptr<arrow::Table> table;
+#if ARROW_VERSION_MAJOR > 0 || ARROW_VERSION_MINOR >= 17
+   auto tableResult = arrow::Table::FromRecordBatches(reader->schema(), noBatches);
+   ThrowIfNotOk(tableResult.status(), "cannot make a table from the file schema");
+   table = *tableResult;
+#else
+   ThrowIfNotOk(arrow::Table::FromRecordBatches(reader->schema(), noBatches, &table),
+                "cannot make a table from the file schema");
+#endif
+   return table;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource for RDataFrame from an Arrow IPC (Feather v2) file.
+/// \param[in] fileName the path of the file, which is memory-mapped. Only its schema is read here.
+/// \param[in] inColumns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the file.
+/// Entry ranges correspond to the record batches of the file, which are read, and decompressed if needed, by
+/// GetEntryRanges.
+RArrowDS::RArrowDS(std::string_view fileName, std::vector<std::string> const &inColumns)
+   : RArrowDS(OpenArrowFile(fileName), inColumns)
+{
+}
+
+RArrowDS::RArrowDS(std::shared_ptr<arrow::ipc::RecordBatchFileReader> fileReader,
+                   std::vector<std::string> const &inColumns)
+   : RArrowDS(MakeEmptyTable(fileReader), inColumns)
+{
+   fFileReader = std::move(fileReader);
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RArrowDS::~RArrowDS()
@@ -468,7 +572,28 @@ const std::vector<std::string> &RArrowDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::GetEntryRanges()
 {
-   auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+   if (!fFileReader) {
+      auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+      return entryRanges;
+   }
+
+   // Read the next record batches of the file, one per slot. The value getters drop the batches of the previous
+   // call, which are all processed by now.
+   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   std::vector<arrow::ArrayVector> chunks(fValueGetters.size());
+   const auto firstEntry = fNextBatchEntry;
+   while (entryRanges.size() < fNSlots && fNextBatch < fFileReader->num_record_batches()) {
+      auto batch = ReadArrowBatch(*fFileReader, fNextBatch++);
+      const ULong64_t end = fNextBatchEntry + batch->num_rows();
+      if (end == fNextBatchEntry)
+         continue;
+      entryRanges.emplace_back(fNextBatchEntry, end);
+      fNextBatchEntry = end;
+      for (size_t ci = 0; ci != chunks.size(); ++ci)
+         chunks[ci].emplace_back(batch->column(fGetterIndex[ci].first));
+   }
+   for (size_t ci = 0; ci != chunks.size(); ++ci)
+      fValueGetters[ci]->SetChunks(std::move(chunks[ci]), firstEntry);
    return entryRanges;
 }
 
@@ -534,6 +659,8 @@ void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, in
 
 int getNRecords(std::shared_ptr<arrow::Table> &table, std::vector<std::string> &columnNames)
 {
+   if (columnNames.empty())
+      return table->num_rows();
    auto index = table->schema()->GetFieldIndex(columnNames.front());
    return table->column(index)->length();
 };
@@ -588,6 +715,12 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
 
 void RArrowDS::Initialise()
 {
+   if (fFileReader) {
+      // the record batches are read by GetEntryRanges
+      fNextBatch = 0;
+      fNextBatchEntry = 0;
+      return;
+   }
    auto nRecords = getNRecords(fTable, fColumnNames);
    splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
 }
@@ -607,6 +740,16 @@ RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<s
    return tdf;
 }
 
+/// Creates a RDataFrame reading an Arrow IPC (Feather v2) file.
+/// \param[in] fileName the path of the file, which is memory-mapped.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the file
+RDataFrame MakeArrowDataFrame(std::string_view fileName, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(fileName, columnNames));
+   return tdf;
+}
+
 } // namespace RDF
 
 } // namespace ROOT
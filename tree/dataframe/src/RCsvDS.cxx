@@ -65,9 +65,10 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+RCsvDS reads the CSV file in chunks of lines, of at most 256 MB each or of the number of lines given as
+`linesChunkSize`, and keeps one chunk at a time in memory as text. The lines of a chunk are only parsed when
+RDataFrame processes the corresponding entries: in multi-thread event loops, each processing slot parses the lines
+of its own entry range, so parsing scales with the number of cores.
 */
 // clang-format on
 
@@ -79,8 +80,8 @@ important to check both how much memory is available and the size of the CSV fil
 #include <TError.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
-#include <sstream>
 #include <string>
 
 namespace ROOT {
@@ -111,39 +112,68 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+/// Read the next chunk of lines, starting at fNextPos, into fChunk. Only complete lines are kept: the bytes read
+/// past the last of them are kept in fReadAhead for the next call. If the chunks are given in lines, the reads are
+/// sized to the lines that are still missing according to the average line length.
+void RCsvDS::ReadChunk()
 {
-   std::istringstream lineStream(line);
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
-
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
-
-      switch (colType) {
-      case 'd': {
-         record.emplace_back(new double(std::stod(col)));
-         break;
-      }
-      case 'l': {
-         record.emplace_back(new Long64_t(std::stoll(col)));
-         break;
+   auto chunkIsFull = [this]() {
+      if (fLinesChunkSize == -1LL)
+         return fChunk.size() >= fgMaxChunkSize && !fLines.empty();
+      return static_cast<Long64_t>(fLines.size()) >= fLinesChunkSize;
+   };
+   auto addLine = [this](std::size_t begin, std::size_t end) {
+      if (end > begin && fChunk[end - 1] == '\r') // Windows line breaks
+         --end;
+      if (end > begin) // skip empty lines
+         fLines.emplace_back(begin, end - begin);
+   };
+
+   auto readSize = [this]() {
+      if (fLinesChunkSize == -1LL || fBytesPerLine == 0)
+         return fgReadBlockSize;
+      // one line more than needed, so that the last line of the chunk is rarely cut
+      const auto nMissingLines = static_cast<std::size_t>(fLinesChunkSize) - fLines.size() + 1;
+      const std::size_t minSize = fgMinReadBlockSize, maxSize = fgReadBlockSize;
+      return std::min(maxSize, std::max(minSize, nMissingLines * fBytesPerLine));
+   };
+
+   fChunk.swap(fReadAhead);
+   fReadAhead.clear();
+   std::size_t lineBegin = 0; // the first byte of fChunk that is not part of a complete line
+   std::size_t pos = 0;       // the first byte of fChunk that was not scanned yet
+   bool eof = false;
+   while (true) {
+      while (!chunkIsFull()) {
+         const auto lineEnd = static_cast<const char *>(std::memchr(&fChunk[pos], '\n', fChunk.size() - pos));
+         if (lineEnd == nullptr) {
+            pos = fChunk.size();
+            break;
+         }
+         pos = lineEnd - fChunk.data();
+         addLine(lineBegin, pos);
+         lineBegin = ++pos;
       }
-      case 'b': {
-         auto b = new bool();
-         record.emplace_back(b);
-         std::istringstream is(col);
-         is >> std::boolalpha >> *b;
+      if (chunkIsFull())
          break;
-      }
-      case 's': {
-         record.emplace_back(new std::string(col));
+      if (eof) { // the last line might not end with a line break
+         addLine(lineBegin, fChunk.size());
+         lineBegin = fChunk.size();
          break;
       }
-      }
-      ++i;
+      const auto scanBegin = fChunk.size();
+      const auto nToRead = readSize();
+      fChunk.resize(scanBegin + nToRead);
+      const auto nRead = fCsvFile->ReadAt(&fChunk[scanBegin], nToRead, fNextPos + scanBegin);
+      fChunk.resize(scanBegin + nRead);
+      eof = nRead < nToRead;
    }
+
+   if (!fLines.empty())
+      fBytesPerLine = (lineBegin + fLines.size() - 1) / fLines.size();
+   fReadAhead.assign(fChunk, lineBegin, std::string::npos);
+   fChunk.resize(lineBegin);
+   fNextPos += lineBegin;
 }
 
 void RCsvDS::GenerateHeaders(size_t size)
@@ -221,34 +251,36 @@ std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
    std::vector<std::string> columns;
 
    for (size_t i = 0; i < line.size(); ++i) {
-      i = ParseValue(line, columns, i);
+      columns.emplace_back();
+      i = ParseValue(line.data(), line.size(), i, columns.back());
    }
 
    return columns;
 }
 
-size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
+////////////////////////////////////////////////////////////////////////
+/// Store in value the field of the line of length size that starts at position i, without its quotes.
+/// Return the position of the delimiter that ends the field, or size for the last field.
+size_t RCsvDS::ParseValue(const char *line, size_t size, size_t i, std::string &value) const
 {
-   std::stringstream val;
+   value.clear();
    bool quoted = false;
 
-   for (; i < line.size(); ++i) {
+   for (; i < size; ++i) {
       if (line[i] == fDelimiter && !quoted) {
          break;
       } else if (line[i] == '"') {
          // Keep just one quote for escaped quotes, none for the normal quotes
-         if (line[i + 1] != '"') {
+         if (i + 1 == size || line[i + 1] != '"') {
             quoted = !quoted;
          } else {
-            val << line[++i];
+            value += line[++i];
          }
       } else {
-         val << line[i];
+         value += line[i];
       }
    }
 
-   columns.emplace_back(val.str());
-
    return i;
 }
 
@@ -278,6 +310,7 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 
    fDataPos = fCsvFile->GetFilePos();
+   fNextPos = fDataPos;
    bool eof = false;
    do {
       eof = !fCsvFile->Readln(line);
@@ -304,31 +337,9 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
 
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'd': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'l': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'b': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 's': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
+   fChunk.clear();
+   fChunk.shrink_to_fit();
+   fLines.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -340,7 +351,8 @@ RCsvDS::~RCsvDS()
 
 void RCsvDS::Finalise()
 {
-   fCsvFile->Seek(fDataPos);
+   fNextPos = fDataPos;
+   fReadAhead.clear();
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
    FreeRecords();
@@ -354,34 +366,28 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
 
-   // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
+   // Read the next chunk of lines and store them in memory, they are parsed by SetEntry
    FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
+   ReadChunk();
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of at most %zu bytes of CSV file into memory, %zu lines read",
+              fgMaxChunkSize, fLines.size());
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fLines.size());
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
+   const auto nRecords = fLines.size();
    if (0 == nRecords)
       return entryRanges;
 
    const auto chunkSize = nRecords / fNSlots;
    const auto remainder = 1U == fNSlots ? 0 : nRecords % fNSlots;
-   auto start = 0ULL == fEntryRangesRequested ? 0ULL : fProcessedLines;
+   fFirstEntry = fProcessedLines;
+   auto start = fFirstEntry;
    auto end = start;
 
    for (auto i : ROOT::TSeqU(fNSlots)) {
@@ -422,26 +428,34 @@ bool RCsvDS::HasColumn(std::string_view colName) const
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
    // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
+   const auto &lineInChunk = fLines[entry - fFirstEntry];
+   // The fields are parsed in place from the chunk, through a buffer per slot that keeps its capacity across entries
+   const char *line = fChunk.data() + lineInChunk.first;
+   const auto lineSize = lineInChunk.second;
+   auto &field = fSlotFields[slot];
+
+   size_t pos = 0;
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
+      if (pos >= lineSize) {
+         std::string msg = "Line " + std::to_string(entry) + " of the CSV file has " + std::to_string(colIndex) +
+                           " fields, " + std::to_string(fHeaders.size()) + " were expected";
+         throw std::runtime_error(msg);
+      }
+      // Strings are unquoted directly into the column value
+      auto &value = colType == 's' ? fStringEvtValues[colIndex][slot] : field;
+      pos = ParseValue(line, lineSize, pos, value) + 1;
       switch (colType) {
       case 'd': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         fDoubleEvtValues[colIndex][slot] = std::stod(value);
          break;
       }
       case 'l': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         fLong64EvtValues[colIndex][slot] = std::stoll(value);
          break;
       }
       case 'b': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
-         break;
-      }
-      case 's': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         fBoolEvtValues[colIndex][slot] = value == "true";
          break;
       }
       }
@@ -465,6 +479,8 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
    fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+
+   fSlotFields.resize(fNSlots);
 }
 
 std::string RCsvDS::GetLabel()
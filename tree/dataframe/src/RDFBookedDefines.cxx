@@ -1,4 +1,6 @@
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 
 namespace ROOT {
 namespace Internal {
@@ -26,6 +28,60 @@ void RBookedDefines::AddName(std::string_view name)
    fDefinesNames = newColsNames;
 }
 
+void RBookedDefines::AddVariation(const std::shared_ptr<RVariationBase> &variation)
+{
+   auto newVariations = std::make_shared<RVariationsMap_t>(GetVariations());
+   (*newVariations)[variation->GetColumnName()].emplace_back(variation);
+   fVariations = newVariations;
+}
+
+std::vector<std::string> RBookedDefines::GetVariationDeps(const std::string &column) const
+{
+   std::vector<std::string> variations;
+   auto addVariations = [&variations](const std::vector<std::string> &names) {
+      for (const auto &name : names)
+         if (std::find(variations.begin(), variations.end(), name) == variations.end())
+            variations.emplace_back(name);
+   };
+
+   const auto varIt = fVariations->find(column);
+   if (varIt != fVariations->end())
+      for (const auto &variation : varIt->second)
+         addVariations(variation->GetVariationNames());
+
+   const auto defIt = fDefines->find(column);
+   if (defIt != fDefines->end())
+      addVariations(defIt->second->GetVariations());
+
+   return variations;
+}
+
+std::vector<std::string> RBookedDefines::GetVariationDeps(const ColumnNames_t &columns) const
+{
+   std::vector<std::string> variations;
+   for (const auto &column : columns) {
+      for (auto &name : GetVariationDeps(column))
+         if (std::find(variations.begin(), variations.end(), name) == variations.end())
+            variations.emplace_back(std::move(name));
+   }
+   return variations;
+}
+
+RVariationBase *RBookedDefines::FindVariation(const std::string &column, const std::string &variationName) const
+{
+   const auto varIt = fVariations->find(column);
+   if (varIt == fVariations->end())
+      return nullptr;
+
+   const auto &variations = varIt->second;
+   for (const auto &variation : variations) {
+      const auto &names = variation->GetVariationNames();
+      if (std::find(names.begin(), names.end(), variationName) != names.end())
+         return variation.get();
+   }
+   return nullptr;
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -9,6 +9,8 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
 
 #include <algorithm> // std::find
@@ -98,7 +100,8 @@ CreateDefineNode(const std::string &columnName, const ROOT::Detail::RDF::RDefine
       return duplicateDefine;
    }
 
-   auto node = std::make_shared<GraphNode>("Define\n" + columnName);
+   const auto profile = columnPtr->GetTimer().Summary();
+   auto node = std::make_shared<GraphNode>("Define\n" + columnName + (profile.empty() ? "" : "\n" + profile));
    node->SetDefine();
 
    sColumnsMap[columnPtr] = node;
@@ -116,7 +119,8 @@ std::shared_ptr<GraphNode> CreateFilterNode(const ROOT::Detail::RDF::RFilterBase
       return duplicateFilter;
    }
    auto filterName = (filterPtr->HasName() ? filterPtr->GetName() : "Filter");
-   auto node = std::make_shared<GraphNode>(filterName);
+   const auto profile = filterPtr->GetTimer().Summary();
+   auto node = std::make_shared<GraphNode>(profile.empty() ? filterName : filterName + "\n" + profile);
 
    sFiltersMap[filterPtr] = node;
    node->SetFilter();
@@ -10,6 +10,7 @@
 
 #include "ROOT/RDFHelpers.hxx"
 #include "TROOT.h"      // IsImplicitMTEnabled
+#include "TVirtualMutex.h" // R__LOCKGUARD
 #include "TError.h"     // Warning
 #include "RConfigure.h" // R__USE_IMT
 #ifdef R__USE_IMT
@@ -17,6 +18,7 @@
 #endif // R__USE_IMT
 
 #include <set>
+#include <string>
 
 using ROOT::RDF::RResultHandle;
 
@@ -57,3 +59,21 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    for (auto &h : uniqueLoops)
       run(h);
 }
+
+static std::string &JitCacheDirectory()
+{
+   static std::string dir;
+   return dir;
+}
+
+void ROOT::RDF::SetJitCacheDirectory(std::string_view dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   JitCacheDirectory() = std::string(dir);
+}
+
+std::string ROOT::RDF::GetJitCacheDirectory()
+{
+   R__LOCKGUARD(gROOTMutex);
+   return JitCacheDirectory();
+}
@@ -10,6 +10,8 @@
 
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
@@ -19,9 +21,11 @@
 #include <TClassEdit.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TPRegexp.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -37,11 +41,16 @@
 #endif
 
 #include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <limits>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 #include <typeinfo>
+#include <vector>
 
 namespace ROOT {
 namespace Detail {
@@ -189,6 +198,15 @@ static std::unordered_map<std::string, std::string> &GetJittedExprs() {
    return jittedExpressions;
 }
 
+/// Declarations of the jitted lambdas that have been booked but not sent to the interpreter yet, by key in
+/// GetJittedExprs. Each RLoopManager declares the ones it uses, in a single interpreter transaction, when
+/// DeclarePendingLambdas is called for it.
+static std::unordered_map<std::string, std::string> &GetPendingLambdas()
+{
+   static std::unordered_map<std::string, std::string> pendingLambdas;
+   return pendingLambdas;
+}
+
 static std::string
 BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
@@ -259,30 +277,51 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
 
 /// Declare a lambda expression to the interpreter in namespace __rdf, return the name of the jitted lambda.
 /// If the lambda expression is already in GetJittedExprs, return the name for the lambda that has already been jitted.
-static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+/// If `defer` is true, the declaration is only queued in `lm`: it is sent to the interpreter, together with the other
+/// pending declarations of `lm`, by the next call to DeclarePendingLambdas. Otherwise the pending declarations of
+/// `lm` are sent right away.
+static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes,
+                                 ROOT::Detail::RDF::RLoopManager &lm, bool defer)
 {
    R__LOCKGUARD(gROOTMutex);
 
    const auto lambdaExpr = BuildLambdaString(expr, vars, varTypes);
    auto &exprMap = GetJittedExprs();
+   auto &pending = GetPendingLambdas();
+   std::string lambdaFullName;
    const auto exprIt = exprMap.find(lambdaExpr);
    if (exprIt != exprMap.end()) {
       // expression already there
-      const auto lambdaName = exprIt->second;
-      return lambdaName;
+      lambdaFullName = exprIt->second;
+      // its declaration might still be pending in another RLoopManager
+      if (pending.find(lambdaExpr) == pending.end())
+         return lambdaFullName;
+   } else {
+      // new expression. Lambdas whose declaration failed are removed from GetJittedExprs: their names are not reused.
+      static unsigned int nLambdas = 0;
+      const auto lambdaBaseName = "lambda" + std::to_string(nLambdas++);
+      lambdaFullName = "__rdf::" + lambdaBaseName;
+
+      const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
+                             lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
+                             lambdaBaseName + ")>::ret_type;\n}\n";
+      pending.insert({lambdaExpr, toDeclare});
+      // Mark the lambda as already jitted; DeclarePendingLambdas removes it again if its declaration fails
+      exprMap.insert({lambdaExpr, lambdaFullName});
    }
 
-   // new expression
-   const auto lambdaBaseName = "lambda" + std::to_string(exprMap.size());
-   const auto lambdaFullName = "__rdf::" + lambdaBaseName;
-
-   const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
-                          lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
-                          lambdaBaseName + ")>::ret_type;\n}";
-   ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
-
-   // InterpreterDeclare could throw. If it doesn't, mark the lambda as already jitted
-   exprMap.insert({lambdaExpr, lambdaFullName});
+   lm.AddPendingLambda(lambdaExpr);
+   if (!defer) {
+      try {
+         ROOT::Internal::RDF::DeclarePendingLambdas(lm);
+      } catch (const std::runtime_error &) {
+         // no code to jit refers to this lambda yet: it must not prevent the code of lm from being jitted
+         for (auto &pendingExpr : lm.TakePendingLambdas())
+            if (pendingExpr != lambdaExpr)
+               lm.AddPendingLambda(pendingExpr);
+         throw;
+      }
+   }
 
    return lambdaFullName;
 }
@@ -292,7 +331,10 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
 static std::string RetTypeOfLambda(const std::string &lambdaName)
 {
    const auto dt = gROOT->GetType((lambdaName + "_ret_t").c_str());
-   R__ASSERT(dt != nullptr);
+   // the declaration of the lambda might have failed when it was deferred (see SetBatchedJitting)
+   if (dt == nullptr)
+      throw std::runtime_error("Define: the expression of the column could not be compiled. The errors printed when "
+                               "the expressions were declared might indicate the cause.");
    const auto type = dt->GetFullTypeName();
    return type;
 }
@@ -541,6 +583,189 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+/// Declare the code of jitted lambdas to the interpreter. If a cache directory is set (see
+/// ROOT::RDF::SetJitCacheDirectory), the code is instead compiled with ACLiC into a library in that directory, named
+/// after the MD5 checksum of the code, and loaded: later processes that declare the same code load the library
+/// instead of compiling it again. Code that ACLiC fails to compile, e.g. because it uses types whose headers are only
+/// known to the interpreter, is marked as such in the cache directory and declared to the interpreter as usual.
+static void DeclareLambdaCode(const std::string &code)
+{
+   const auto cacheDir = ROOT::RDF::GetJitCacheDirectory();
+   if (cacheDir.empty()) {
+      InterpreterDeclare(code);
+      return;
+   }
+
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(code.data()), code.size());
+   md5.Final();
+   const std::string baseName = cacheDir + "/rdfjit_" + md5.AsString();
+   const std::string sourceName = baseName + ".C";
+   const std::string failedName = baseName + ".failed";
+   // AccessPathName returns false if the file exists
+   if (gSystem->AccessPathName(failedName.c_str())) {
+      if (gSystem->AccessPathName(sourceName.c_str())) {
+         gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true);
+         // write to a temporary file first, so that the source file is never seen half-written
+         const std::string tmpName = sourceName + ".tmp" + std::to_string(gSystem->GetPid());
+         std::ofstream source(tmpName);
+         source << "// Jitted RDataFrame expressions\n"
+                << "#include \"ROOT/RDataFrame.hxx\"\n#include \"TMath.h\"\n\n"
+                << code;
+         source.close();
+         if (!source || gSystem->Rename(tmpName.c_str(), sourceName.c_str()) != 0)
+            gSystem->Unlink(tmpName.c_str());
+      }
+      if (!gSystem->AccessPathName(sourceName.c_str()) && gSystem->CompileMacro(sourceName.c_str(), "kOs") == 1) {
+         R__LOG_DEBUG(10, ROOT::Detail::RDF::RDFLogChannel())
+            << "Loaded the jitted expressions of " << sourceName << '\n';
+         return;
+      }
+      std::ofstream(failedName).close();
+   }
+   InterpreterDeclare(code);
+}
+
+/// Send the pending declarations of the given jitted lambdas to the interpreter, in a single transaction. If the
+/// transaction fails, the lambdas are declared one by one: only the ones that cannot be declared are forgotten, so
+/// that they are declared again if they are used again, and the first error is thrown.
+static void DeclareLambdas(std::vector<std::string> toDeclare)
+{
+   auto &pending = GetPendingLambdas();
+   std::vector<std::string> exprs;
+   std::string code;
+   std::set<std::string> seen;
+   for (auto &expr : toDeclare) {
+      const auto it = pending.find(expr);
+      // skip the lambdas declared meanwhile for other RLoopManagers, and the ones booked more than once
+      if (it == pending.end() || !seen.insert(expr).second)
+         continue;
+      code += it->second;
+      exprs.emplace_back(std::move(expr));
+   }
+   if (exprs.empty())
+      return;
+
+   try {
+      DeclareLambdaCode(code);
+      for (const auto &expr : exprs)
+         pending.erase(expr);
+      return;
+   } catch (const std::runtime_error &) {
+   }
+
+   auto &exprMap = GetJittedExprs();
+   std::exception_ptr firstError;
+   for (const auto &expr : exprs) {
+      const auto it = pending.find(expr);
+      const auto lambdaCode = std::move(it->second);
+      pending.erase(it);
+      try {
+         InterpreterDeclare(lambdaCode);
+      } catch (const std::runtime_error &) {
+         exprMap.erase(expr);
+         if (!firstError)
+            firstError = std::current_exception();
+      }
+   }
+   if (firstError)
+      std::rethrow_exception(firstError);
+}
+
+/// Send the declarations of the jitted lambdas used by `lm` that are still pending to the interpreter, in a single
+/// transaction (see DeclareLambdas). The ones that cannot be declared stay pending for `lm`.
+void DeclarePendingLambdas(RLoopManager &lm)
+{
+   R__LOCKGUARD(gROOTMutex);
+   auto exprs = lm.TakePendingLambdas();
+   try {
+      DeclareLambdas(exprs);
+   } catch (const std::runtime_error &) {
+      // the code to jit of lm might refer to the lambdas that could not be declared: keep them pending, so that it is
+      // left out when the code of other RLoopManagers is jitted
+      const auto &exprMap = GetJittedExprs();
+      for (const auto &expr : exprs)
+         if (exprMap.count(expr) == 0)
+            lm.AddPendingLambda(expr);
+      throw;
+   }
+}
+
+/// Send the declarations of the jitted lambdas used by the given RLoopManagers that are still pending to the
+/// interpreter, in a single transaction (see DeclareLambdas). Return the RLoopManagers that use lambdas which could not
+/// be declared: their lambdas stay pending for them, so that the error is reported again when they are jitted.
+std::set<RLoopManager *> DeclarePendingLambdas(const std::vector<RLoopManager *> &lms)
+{
+   R__LOCKGUARD(gROOTMutex);
+
+   std::vector<std::vector<std::string>> exprsOfLms;
+   std::vector<std::string> exprs;
+   for (auto *lm : lms) {
+      exprsOfLms.emplace_back(lm->TakePendingLambdas());
+      exprs.insert(exprs.end(), exprsOfLms.back().begin(), exprsOfLms.back().end());
+   }
+   try {
+      DeclareLambdas(std::move(exprs));
+   } catch (const std::runtime_error &) {
+      // the lambdas that could not be declared have been removed from GetJittedExprs, see below
+   }
+
+   const auto &exprMap = GetJittedExprs();
+   std::set<RLoopManager *> failed;
+   for (auto i = 0u; i < lms.size(); ++i) {
+      const auto &lmExprs = exprsOfLms[i];
+      const bool ok = std::all_of(lmExprs.begin(), lmExprs.end(),
+                                  [&exprMap](const std::string &expr) { return exprMap.count(expr) > 0; });
+      if (ok)
+         continue;
+      failed.insert(lms[i]);
+      for (const auto &expr : lmExprs)
+         lms[i]->AddPendingLambda(expr);
+   }
+   return failed;
+}
+
+/// Return the name of a new, unique file in the given directory (or in the system's temporary directory if empty)
+/// that Cache can use as scratch file.
+std::string MakeCacheScratchFileName(const std::string &scratchDir)
+{
+   const char *dir = scratchDir.empty() ? nullptr : scratchDir.c_str();
+   // TChain expects the .root extension, which TempFileName cannot add: the name it reserves is kept until the
+   // scratch file itself has been created exclusively, so that a file made meanwhile by another process is never
+   // reused.
+   for (int attempt = 0; attempt < 100; ++attempt) {
+      TString base("rdfcache");
+      FILE *reserved = gSystem->TempFileName(base, dir);
+      if (!reserved)
+         break;
+      fclose(reserved);
+      const std::string fileName = std::string(base.Data()) + ".root";
+      FILE *f = std::fopen(fileName.c_str(), "wbx");
+      gSystem->Unlink(base.Data());
+      if (f) {
+         fclose(f);
+         return fileName;
+      }
+   }
+   throw std::runtime_error("Cache: could not create a scratch file in directory \"" +
+                            std::string(dir ? dir : gSystem->TempDirectory()) + "\"");
+}
+
+ROOT::RDF::RSnapshotOptions MakeCacheSnapshotOptions(const ROOT::RDF::RCacheOptions &options)
+{
+   ROOT::RDF::RSnapshotOptions snapOpts;
+   snapOpts.fCompressionAlgorithm = options.fCompressionAlgorithm;
+   snapOpts.fCompressionLevel = options.fCompressionLevel;
+   snapOpts.fOutputFormat = options.fOutputFormat;
+   snapOpts.fLazy = false;
+   // Readers keep a few clusters in memory (the RNTuple cluster cache holds four of them by default): clusters of a
+   // quarter of the read buffer size keep them within it. A negative AutoFlush value is a cluster size in compressed bytes.
+   const auto clusterSize = std::min<ULong64_t>(options.fReadBufferSize / 4, std::numeric_limits<int>::max());
+   if (clusterSize > 0)
+      snapOpts.fAutoFlush = -static_cast<int>(clusterSize);
+   return snapOpts;
+}
+
 void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
                    std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name,
                    std::string_view expression, const std::map<std::string, std::string> &aliasMap,
@@ -553,10 +778,11 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Filter", /*vector2rvec=*/true);
-   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
-   const auto type = RetTypeOfLambda(lambdaName);
-   if (type != "bool")
-      std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
+   auto lm = jittedFilter->GetLoopManagerUnchecked();
+   // Whether the expression returns something convertible to bool is checked by JitFilterHelper, so with batched
+   // jitting the declaration of the lambda can wait until the event loop is about to start
+   const auto lambdaName =
+      DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes, *lm, /*defer=*/lm->GetBatchedJitting());
 
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RBookedDefines *definesOnHeap = new ROOT::Internal::RDF::RBookedDefines(customCols);
@@ -582,7 +808,6 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
                     << "reinterpret_cast<ROOT::Internal::RDF::RBookedDefines*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
 }
 
@@ -600,12 +825,25 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Define", /*vector2rvec=*/true);
-   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
-   const auto type = RetTypeOfLambda(lambdaName);
+   // With batched jitting, the declaration of the lambda waits until the type of the new column is needed, e.g. to
+   // book a node that uses it, or until the event loop is about to start
+   const bool defer = lm.GetBatchedJitting();
+   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes, lm, defer);
 
    auto definesCopy = new RDFInternal::RBookedDefines(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
-   auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm.GetNSlots(), lm.GetDSValuePtrs());
+   std::shared_ptr<RDFDetail::RJittedDefine> jittedDefine;
+   if (defer) {
+      auto typeResolver = [&lm, lambdaName] {
+         DeclarePendingLambdas(lm);
+         return RetTypeOfLambda(lambdaName);
+      };
+      jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, "", lm.GetNSlots(), lm.GetDSValuePtrs(),
+                                                                std::move(typeResolver));
+   } else {
+      jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, RetTypeOfLambda(lambdaName), lm.GetNSlots(),
+                                                                lm.GetDSValuePtrs());
+   }
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", {";
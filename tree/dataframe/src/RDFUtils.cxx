@@ -26,6 +26,7 @@
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -348,6 +349,11 @@ bool IsInternalColumn(std::string_view colName)
    return goodPrefix && '_' == colName.back();                 // also ends with '_'
 }
 
+bool IsStrInVec(const std::string &str, const std::vector<std::string> &vec)
+{
+   return std::find(vec.cbegin(), vec.cend(), str) != vec.cend();
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -70,6 +70,7 @@ Transformations are a way to manipulate the data.
 | [DefineSlotEntry](classROOT_1_1RDF_1_1RInterface.html#a4f17074d5771916e3df18f8458186de7) | Same as `DefineSlot`, but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | [Filter](classROOT_1_1RDF_1_1RInterface.html#a70284a3bedc72b19610aaa91b5007ebd) | Filter the rows of the dataset. |
 | [Range](classROOT_1_1RDF_1_1RInterface.html#a1b36b7868831de2375e061bb06cfc225) | Creates a node that filters entries based on range of entries |
+| Vary | Registers systematic variations of a column. Varied results are retrieved with `ROOT::RDF::Experimental::VariationsFor` and are all computed in the same event loop as the nominal ones. See the section on [systematic variations](#systematics). |
 
 ### Actions
 Actions are a way to produce a result out of the data. Each one is described in more detail in the reference guide.
@@ -85,7 +86,7 @@ produce several different results in one event loop. Instant actions trigger the
 |------------------|-----------------|
 | [Aggregate](classROOT_1_1RDF_1_1RInterface.html#ae540b00addc441f9b504cbae0ef0a24d) | Execute a user-defined accumulation operation on the processed column values. |
 | [Book](classROOT_1_1RDF_1_1RInterface.html#a9b2f61f3333d1669e57055b9ae8be9d9) | Book execution of a custom action using a user-defined helper object. |
-| [Cache](classROOT_1_1RDF_1_1RInterface.html#aaaa0a7bb8eb21315d8daa08c3e25f6c9) | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). |
+| [Cache](classROOT_1_1RDF_1_1RInterface.html#aaaa0a7bb8eb21315d8daa08c3e25f6c9) | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). With RCacheOptions, columns can instead be snapshotted to a compressed scratch file on disk that is read back. |
 | [Count](classROOT_1_1RDF_1_1RInterface.html#a37f9e00c2ece7f53fae50b740adc1456) | Return the number of events processed. |
 | [Display](classROOT_1_1RDF_1_1RInterface.html#aee68f4411f16f00a1d46eccb6d296f01) | Obtains the events in the dataset for the requested columns. The method returns a [RDisplay](classROOT_1_1RDF_1_1RDisplay.html) instance which can be queried to get a compressed tabular representation on the standard output or a complete representation as a string. |
 | [Fill](classROOT_1_1RDF_1_1RInterface.html#a0cac4d08297c23d16de81ff25545440a) | Fill a user-defined object with the values of the specified columns, as if by calling `Obj.Fill(col1, col2, ...). |
@@ -352,8 +353,8 @@ auto d15on = d.Range(15, 0);
 // We can specify a stride too, in this case we pick an event every 3
 auto d15each3 = d.Range(0, 15, 3);
 ~~~
-Note that ranges are not available when multi-threading is enabled. More information on ranges is available
-[here](#ranges).
+When multi-threading is enabled, ranges can only be applied to the dataset itself, not to filters or other ranges.
+More information on ranges is available [here](#ranges).
 
 ### Executing multiple actions in the same event loop
 As a final example let us apply two different cuts on branch "MET" and fill two different histograms with the "pt\_v" of
@@ -763,9 +764,8 @@ Stats are stored in the same order as named filters have been added to the graph
 that has been run using the relevant `RDataFrame`.
 
 ### <a name="ranges"></a>Ranges
-When `RDataFrame` is not being used in a multi-thread environment (i.e. no call to `EnableImplicitMT` was made),
-`Range` transformations are available. These act very much like filters but instead of basing their decision on
-a filter expression, they rely on `begin`,`end` and `stride` parameters.
+`Range` transformations act very much like filters but instead of basing their decision on a filter expression,
+they rely on `begin`,`end` and `stride` parameters.
 
 - `begin`: initial entry number considered for this range.
 - `end`: final entry number (excluded) considered for this range. 0 means that the range goes until the end of the dataset.
@@ -782,6 +782,13 @@ preceding filter*.
 Ranges allow "early quitting": if all branches of execution of a functional graph reached their `end` value of
 processed entries, the event-loop is immediately interrupted. This is useful for debugging and quick data explorations.
 
+In multi-thread event loops (i.e. after a call to `EnableImplicitMT`), entries are not processed in order, so ranges
+cannot count the entries that reach them. Instead, ranges hanging directly from the dataset (possibly after some
+`Define`s) select entries based on their global entry number, which yields the same entries as a single-thread run,
+independently of the number of threads. Early quitting is replaced by skipping: if all branches of the functional
+graph start with a `Range`, only the clusters (or, for data sources, the entry ranges) that overlap with the union of
+the ranges are read. Ranges that hang from a filter or from another range are not supported in multi-thread runs.
+
 ### <a name="custom-columns"></a> Custom columns
 Custom columns are created by invoking `Define(name, f, columnList)`. As usual, `f` can be any callable object
 (function, lambda expression, functor class...); it takes the values of the columns listed in `columnList` (a list of
@@ -818,6 +825,31 @@ first parameter is the slot number which ranges from 0 to ROOT::GetThreadPoolSiz
 - `DefineSlotEntry(name, f, columnList)`. In this case the callable f has this signature `R(unsigned int, ULong64_t,
 T1, T2, ...)`: the first parameter is the slot number while the second one the number of the entry being processed.
 
+### <a name="systematics"></a> Systematic variations
+Analyses often need to produce the same results for several variations of one or more input quantities, e.g. to
+evaluate systematic uncertainties. Rather than running the whole computation graph once per variation, the varied
+values of a column can be registered with `Vary(colName, f, columnList, variationTags)`: `f` must return a `RVec`
+with one varied value per tag. `ROOT::RDF::Experimental::VariationsFor` then returns a map from variation names
+(`"nominal"` and `"colName:tag"`) to the corresponding results:
+
+~~~{.cpp}
+auto nominal_h = df.Vary("pt", [] (double pt) { return ROOT::RVecD{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"})
+                   .Filter([] (double pt) { return pt > 10; }, {"pt"})
+                   .Define("x", someFunc, {"pt", "eta"})
+                   .Histo1D<double>("x");
+
+auto hs = ROOT::RDF::Experimental::VariationsFor(nominal_h);
+hs["nominal"].Draw();
+hs["pt:down"].Draw("SAME");
+hs["pt:up"].Draw("SAME");
+~~~
+
+All variations are computed in the same event loop as the nominal results. `Filter` and `Define` nodes are cloned for
+each variation they depend on, and only these clones are evaluated more than once per entry: nodes that do not depend
+on a varied column are evaluated once, no matter how many variations are requested.
+`VariationsFor` must be called before the event loop runs. Variations are not supported downstream of `Range`, and only
+the `Count`, `Sum`, `Mean`, `StdDev`, `Min`, `Max`, `Fill` and `Histo*D`/`Profile*D` actions can produce varied results.
+
 ##  <a name="actions"></a>Actions
 ### Instant and lazy actions
 Actions can be **instant** or **lazy**. Instant actions are executed as soon as they are called, while lazy actions are
@@ -842,6 +874,25 @@ ROOT::EnableImplicitMT(i)
 ```
 replacing `i` with the number of CPUs/slots that were allocated for this job.
 
+### Bulk processing
+By default, the event loop runs the whole computation graph for one entry before moving to the next one. Calling
+`SetBulkSize(n)` on any node of the computation graph makes the next event loops process the entries in blocks of `n`:
+the input columns of all nodes are copied into contiguous arrays, every Filter computes which entries of the block pass
+it, Defines are evaluated for the entries their readers select, and actions process all the selected entries of the
+block in one call. Fewer virtual calls are made per entry and the inner loops of the actions can be vectorized, which
+speeds up simple selections over many entries.
+```
+ROOT::RDataFrame df("tree", "file.root");
+df.SetBulkSize(256);
+auto df2 = df.Define("pt2", [](float pt) { return pt * pt; }, {"pt"});
+auto meanPt2 = df2.Filter([](float pt) { return pt > 10.f; }, {"pt"}).Mean<float>("pt2");
+```
+Results are the same as with entry-wise processing. Only Filters and Defines on arithmetic (non-bool) columns and the
+`Count`, `Sum`, `Mean`, `Min`, `Max` and histogram actions, as well as `Book` with helpers that implement `ExecBulk`,
+support bulk processing: computation graphs that contain other actions, Ranges or systematic variations fall back to
+entry-wise processing. Since all input columns are read for every entry of a block, bulk processing can be slower
+when Filters reject most entries before expensive columns are needed.
+
 ### Thread-safety of user-defined expressions
 RDataFrame operations such as `Histo1D` or `Snapshot` are guaranteed to work correctly in multi-thread event loops.
 User-defined expressions, such as strings or lambdas passed to `Filter`, `Define`, `Foreach`, `Reduce` or `Aggregate`
@@ -12,6 +12,7 @@
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h" // Long64_t
 
+#include <stdexcept> // std::logic_error
 #include <string>
 #include <vector>
 #include <atomic>
@@ -27,9 +28,12 @@ unsigned int RDefineBase::GetNextID()
 
 RDefineBase::RDefineBase(std::string_view name, std::string_view type, unsigned int nSlots,
                          const RDFInternal::RBookedDefines &defines,
-                         const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
-   : fName(name), fType(type), fNSlots(nSlots), fLastCheckedEntry(fNSlots, -1), fDefines(defines),
-     fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs), fDataSource(ds)
+                         const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds,
+                         const std::string &variationName)
+   : fName(name), fType(type), fNSlots(nSlots), fLastCheckedEntry(fNSlots, -1), fLastStagedEntry(fNSlots, -1),
+     fLastBlockEntry(fNSlots, -1), fDefines(defines),
+     fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs), fDataSource(ds), fVariation(variationName),
+     fTimer(nSlots)
 {
 }
 
@@ -45,3 +49,16 @@ std::string RDefineBase::GetTypeName() const
 {
    return fType;
 }
+
+void RDefineBase::EnableProfiling(RDFInternal::RProfiler *profiler)
+{
+   fTimer.Reset(profiler != nullptr);
+   fProfiler = profiler;
+   if (profiler != nullptr)
+      profiler->AddDefineTimer(fName, fTimer);
+}
+
+void *RDefineBase::UpdateBulk(unsigned int, const char *, const std::vector<Long64_t> &)
+{
+   throw std::logic_error("Define '" + fName + "' does not support bulk event loops.");
+}
@@ -9,15 +9,16 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include <numeric> // std::accumulate
 
 using namespace ROOT::Detail::RDF;
 
 RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const unsigned int nSlots,
-                         const RDFInternal::RBookedDefines &defines)
+                         const RDFInternal::RBookedDefines &defines, const std::string &variationName)
    : RNodeBase(implPtr), fLastResult(nSlots), fAccepted(nSlots), fRejected(nSlots), fName(name), fNSlots(nSlots),
-     fDefines(defines) {}
+     fDefines(defines), fVariation(variationName), fTimer(nSlots) {}
 
 // outlined to pin virtual table
 RFilterBase::~RFilterBase() {}
@@ -44,6 +45,17 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
 void RFilterBase::InitNode()
 {
    fLastCheckedEntry = std::vector<Long64_t>(fNSlots, -1);
+   fLastStagedEntry = std::vector<Long64_t>(fNSlots, -1);
+   fLastCheckedBlock = std::vector<Long64_t>(fNSlots, -1);
+   fBlockMasks.resize(fNSlots);
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
+
+void RFilterBase::EnableProfiling(RDFInternal::RProfiler *profiler)
+{
+   fTimer.Reset(profiler != nullptr);
+   fProfiler = profiler;
+   for (auto &define : fDefines.GetColumns())
+      define.second->EnableProfiling(profiler);
+}
@@ -84,6 +84,42 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::Get
    return fConcreteAction->GetGraph();
 }
 
+std::string RJittedAction::GetActionName()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
+void RJittedAction::EnableProfiling(RProfiler *profiler)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->EnableProfiling(profiler);
+}
+
+const ROOT::Internal::RDF::RNodeTimer &RJittedAction::GetTimer() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetTimer();
+}
+
+bool RJittedAction::SupportsBulk() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->SupportsBulk();
+}
+
+void RJittedAction::StageEntry(unsigned int slot, std::size_t idx, Long64_t entry)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->StageEntry(slot, idx, entry);
+}
+
+void RJittedAction::RunBulk(unsigned int slot, const std::vector<Long64_t> &entries)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, entries);
+}
+
 /**
    Retrieve a wrapper to the result of the action that knows how to merge
    with others of the same type.
@@ -93,3 +129,15 @@ std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> RJittedAction::GetMergea
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetMergeableValue();
 }
+
+std::vector<std::string> RJittedAction::GetVariations() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariations();
+}
+
+std::unique_ptr<ROOT::Internal::RDF::RActionBase> RJittedAction::MakeVariedAction(std::vector<void *> &&results)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(std::move(results));
+}
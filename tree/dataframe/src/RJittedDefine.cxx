@@ -31,6 +31,15 @@ const std::type_info &RJittedDefine::GetTypeId() const
    return fConcreteDefine->GetTypeId();
 }
 
+std::string RJittedDefine::GetTypeName() const
+{
+   if (!fTypeResolver)
+      return RDefineBase::GetTypeName();
+   if (fResolvedType.empty())
+      fResolvedType = fTypeResolver();
+   return fResolvedType;
+}
+
 void RJittedDefine::Update(unsigned int slot, Long64_t entry)
 {
    R__ASSERT(fConcreteDefine != nullptr);
@@ -42,3 +51,45 @@ void RJittedDefine::FinaliseSlot(unsigned int slot)
    R__ASSERT(fConcreteDefine != nullptr);
    fConcreteDefine->FinaliseSlot(slot);
 }
+
+std::vector<std::string> RJittedDefine::GetVariations() const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariations();
+}
+
+RDefineBase &RJittedDefine::GetVariedDefine(const std::string &variationName)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariedDefine(variationName);
+}
+
+void RJittedDefine::EnableProfiling(RDFInternal::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->EnableProfiling(profiler);
+}
+
+const RDFInternal::RNodeTimer &RJittedDefine::GetTimer() const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetTimer();
+}
+
+bool RJittedDefine::SupportsBulk() const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->SupportsBulk();
+}
+
+void RJittedDefine::StageEntry(unsigned int slot, std::size_t idx, Long64_t entry)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->StageEntry(slot, idx, entry);
+}
+
+void *RJittedDefine::UpdateBulk(unsigned int slot, const char *mask, const std::vector<Long64_t> &entries)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->UpdateBulk(slot, mask, entries);
+}
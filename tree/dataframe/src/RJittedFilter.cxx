@@ -53,6 +53,24 @@ void RJittedFilter::FillReport(ROOT::RDF::RCutFlowReport &cr) const
    fConcreteFilter->FillReport(cr);
 }
 
+const RDFInternal::RBookedDefines &RJittedFilter::GetDefines() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetDefines();
+}
+
+void RJittedFilter::EnableProfiling(RDFInternal::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->EnableProfiling(profiler);
+}
+
+const RDFInternal::RNodeTimer &RJittedFilter::GetTimer() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetTimer();
+}
+
 void RJittedFilter::IncrChildrenCount()
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -112,3 +130,33 @@ std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
+
+std::vector<std::string> RJittedFilter::GetVariations() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariations();
+}
+
+std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &variationName)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariedFilter(variationName);
+}
+
+bool RJittedFilter::SupportsBulk() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->SupportsBulk();
+}
+
+void RJittedFilter::StageEntry(unsigned int slot, std::size_t idx, Long64_t entry)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->StageEntry(slot, idx, entry);
+}
+
+const char *RJittedFilter::CheckFiltersBulk(unsigned int slot, const std::vector<Long64_t> &entries)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, entries);
+}
@@ -1,14 +1,18 @@
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // DeclarePendingLambdas
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RSlotStack.hxx"
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TChain.h"
@@ -38,20 +42,21 @@
 #include <unordered_map>
 #include <vector>
 #include <set>
-#include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
+#include <limits>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::Internal::RDF;
 
 namespace {
-/// A helper function that returns all RDF code that is currently scheduled for just-in-time compilation.
-/// This allows different RLoopManager instances to share these data.
+/// A helper function that returns all RDF code that is currently scheduled for just-in-time compilation, by
+/// RLoopManager. This allows different RLoopManager instances to share these data.
 /// We want RLoopManagers to be able to add their code to a global "code to execute via cling",
 /// so that, lazily, we can jit everything that's needed by all RDFs in one go, which is potentially
-/// much faster than jitting each RLoopManager's code separately.
-static std::string &GetCodeToJit()
+/// much faster than jitting each RLoopManager's code separately. The code is kept by RLoopManager so that the code of
+/// the computation graphs whose expressions cannot be compiled can be left out.
+static std::unordered_map<RLoopManager *, std::string> &GetCodeToJit()
 {
-   static std::string code;
+   static std::unordered_map<RLoopManager *, std::string> code;
    return code;
 }
 
@@ -302,27 +307,40 @@ ColumnNames_t ROOT::Internal::RDF::GetBranchNames(TTree &t, bool allowDuplicates
    return bNames;
 }
 
+RLoopManager::RScratchFiles::~RScratchFiles()
+{
+   for (const auto &fileName : fFileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
 RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
-     fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles)
+     fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles), fProfiler(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
    : fNEmptyEntries(nEmptyEntries), fNSlots(RDFInternal::GetNSlots()),
-     fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles)
+     fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles), fProfiler(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds))
+     fDataSource(std::move(ds)), fProfiler(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
 
+RLoopManager::~RLoopManager()
+{
+   // code that has not been jitted must not be jitted by other RLoopManagers after this one is gone
+   R__LOCKGUARD(gROOTMutex);
+   GetCodeToJit().erase(this);
+}
+
 struct RSlotRAII {
    RSlotStack &fSlotStack;
    unsigned int fSlot;
@@ -336,12 +354,16 @@ void RLoopManager::RunEmptySourceMT()
 #ifdef R__USE_IMT
    RSlotStack slotStack(fNSlots);
    // Working with an empty tree.
+   // Only generate the entries that global ranges might select, if the whole computation graph is behind them.
+   const auto globalRange = GetGlobalEntryRange();
+   const auto firstEntry = std::min(globalRange.first, fNEmptyEntries);
+   const auto endEntry = std::min(globalRange.second, fNEmptyEntries);
    // Evenly partition the entries according to fNSlots. Produce around 2 tasks per slot.
-   const auto nEntriesPerSlot = fNEmptyEntries / (fNSlots * 2);
-   auto remainder = fNEmptyEntries % (fNSlots * 2);
+   const auto nEntriesPerSlot = (endEntry - firstEntry) / (fNSlots * 2);
+   auto remainder = (endEntry - firstEntry) % (fNSlots * 2);
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   ULong64_t start = 0;
-   while (start < fNEmptyEntries) {
+   ULong64_t start = firstEntry;
+   while (start < endEntry) {
       ULong64_t end = start + nEntriesPerSlot;
       if (remainder > 0) {
          ++end;
@@ -361,6 +383,7 @@ void RLoopManager::RunEmptySourceMT()
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
             RunAndCheckFilters(slot, currEntry);
          }
+         RunBlock(slot);
       } catch (...) {
          CleanUpTask(slot);
          // Error might throw in experiment frameworks like CMSSW
@@ -385,6 +408,7 @@ void RLoopManager::RunEmptySource()
       for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
          RunAndCheckFilters(0, currEntry);
       }
+      RunBlock(0u);
    } catch (...) {
       CleanUpTask(0u);
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -399,11 +423,23 @@ void RLoopManager::RunTreeProcessorMT()
 #ifdef R__USE_IMT
    RSlotStack slotStack(fNSlots);
    const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
-   auto tp = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+   // Global ranges need global entry numbers, which TTreeProcessorMT provides if it is given an entry range.
+   // Otherwise entries get task-local numbers, which avoids opening all files upfront to compute entry offsets.
+   const bool useGlobalEntries = HasActiveGlobalRanges();
+   std::unique_ptr<ROOT::TTreeProcessorMT> tp;
+   if (useGlobalEntries) {
+      const auto globalRange = GetGlobalEntryRange();
+      const auto maxEntry = static_cast<ULong64_t>(std::numeric_limits<Long64_t>::max());
+      const std::pair<Long64_t, Long64_t> range{std::min(globalRange.first, maxEntry),
+                                                std::min(globalRange.second, maxEntry)};
+      tp = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots, range);
+   } else {
+      tp = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+   }
 
    std::atomic<ULong64_t> entryCount(0ull);
 
-   tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+   tp->Process([this, &slotStack, &entryCount, useGlobalEntries](TTreeReader &r) -> void {
       RSlotRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       InitNodeSlots(&r, slot);
@@ -414,8 +450,10 @@ void RLoopManager::RunTreeProcessorMT()
       try {
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
-            RunAndCheckFilters(slot, count++);
+            RunAndCheckFilters(slot, useGlobalEntries ? r.GetCurrentEntry() : count);
+            ++count;
          }
+         RunBlock(slot);
       } catch (...) {
          CleanUpTask(slot);
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -441,6 +479,7 @@ void RLoopManager::RunTreeReader()
       while (r.Next() && fNStopsReceived < fNChildren) {
          RunAndCheckFilters(0, r.GetCurrentEntry());
       }
+      RunBlock(0u);
    } catch (...) {
       CleanUpTask(0u);
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -474,6 +513,7 @@ void RLoopManager::RunDataSource()
                }
             }
          }
+         RunBlock(0u);
       } catch (...) {
          CleanUpTask(0u);
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -509,6 +549,7 @@ void RLoopManager::RunDataSourceMT()
                RunAndCheckFilters(slot, entry);
             }
          }
+         RunBlock(slot);
       } catch (...) {
          CleanUpTask(slot);
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -518,10 +559,23 @@ void RLoopManager::RunDataSourceMT()
       fDataSource->FinaliseSlot(slot);
    };
 
+   // Entry ranges of the data source are clipped to the entries that global ranges might select
+   const auto globalRange = GetGlobalEntryRange();
+   auto clipRanges = [&globalRange](const std::vector<std::pair<ULong64_t, ULong64_t>> &ranges) {
+      std::vector<std::pair<ULong64_t, ULong64_t>> clipped;
+      for (const auto &range : ranges) {
+         const auto start = std::max(range.first, globalRange.first);
+         const auto end = std::min(range.second, globalRange.second);
+         if (start < end)
+            clipped.emplace_back(start, end);
+      }
+      return clipped;
+   };
+
    fDataSource->Initialise();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
-      pool.Foreach(runOnRange, ranges);
+      pool.Foreach(runOnRange, clipRanges(ranges));
       ranges = fDataSource->GetEntryRanges();
    }
    fDataSource->Finalise();
@@ -532,6 +586,10 @@ void RLoopManager::RunDataSourceMT()
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fRunInBulk) {
+      AddEntryToBlock(slot, entry);
+      return;
+   }
    for (auto &actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
    for (auto &namedFilterPtr : fBookedNamedFilters)
@@ -540,6 +598,54 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Whether all booked actions and named filters, and the nodes upstream of them, can process entries block-wise.
+bool RLoopManager::CanRunInBulk() const
+{
+   const bool canRunInBulk =
+      std::all_of(fBookedActions.begin(), fBookedActions.end(),
+                  [](RDFInternal::RActionBase *a) { return a->SupportsBulk(); }) &&
+      std::all_of(fBookedNamedFilters.begin(), fBookedNamedFilters.end(),
+                  [](RFilterBase *f) { return f->SupportsBulk(); });
+   if (!canRunInBulk)
+      R__LOG_INFO(RDFLogChannel()) << "A bulk size of " << fBulkSize
+                                   << " was requested, but some nodes of the computation graph cannot process "
+                                      "entries in bulk: the event loop processes one entry at a time.";
+   return canRunInBulk;
+}
+
+/// Bulk event loops: read the input columns of all nodes for the given entry, which is added to the current block of
+/// the slot, and process the block if it is complete.
+void RLoopManager::AddEntryToBlock(unsigned int slot, Long64_t entry)
+{
+   auto &entries = fBlockEntries[slot];
+   const auto idx = entries.size();
+   entries.emplace_back(entry);
+   // the values are copied now: the data source or the TTreeReader move to the next entry before the block is done
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->StageEntry(slot, idx, entry);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->StageEntry(slot, idx, entry);
+   if (entries.size() == fBulkSize)
+      RunBlock(slot);
+}
+
+/// Bulk event loops: execute actions and named filters on the entries of the current block of the slot, if any.
+/// Callbacks are invoked once per entry of the block afterwards. A no-op for entry-wise event loops.
+void RLoopManager::RunBlock(unsigned int slot)
+{
+   if (!fRunInBulk || fBlockEntries[slot].empty())
+      return;
+   const auto &entries = fBlockEntries[slot];
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, entries);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, entries);
+   for (auto &callback : fCallbacks)
+      for (auto i = 0u; i < entries.size(); ++i)
+         callback(slot);
+   fBlockEntries[slot].clear();
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
@@ -566,6 +672,33 @@ void RLoopManager::InitNodes()
       range->InitNode();
    for (auto &ptr : fBookedActions)
       ptr->Initialize();
+   SetUpProfiling();
+   fRunInBulk = fBulkSize > 1 && CanRunInBulk();
+   if (fRunInBulk) {
+      fBlockEntries.resize(fNSlots);
+      fBlockMasks.resize(fNSlots);
+   }
+}
+
+/// Enable the timers of the booked nodes if a Profile action was booked, disable them if the previous event loop
+/// was profiled and this one is not.
+void RLoopManager::SetUpProfiling()
+{
+   if (!fProfileNextRun && !fProfilingEnabled)
+      return;
+
+   fProfilingEnabled = fProfileNextRun;
+   fProfileNextRun = false;
+   fProfiler.Clear();
+   // actions that already ran keep no stale timings, e.g. in the output of SaveGraph. This comes first as they might
+   // share Defines with the booked nodes.
+   for (auto *action : fRunActions)
+      action->EnableProfiling(nullptr);
+   auto *profiler = fProfilingEnabled ? &fProfiler : nullptr;
+   for (auto *filter : fBookedFilters)
+      filter->EnableProfiling(profiler);
+   for (auto *action : fBookedActions)
+      action->EnableProfiling(profiler);
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -595,6 +728,9 @@ void RLoopManager::CleanUpNodes()
 /// Perform clean-up operations. To be called at the end of each task execution.
 void RLoopManager::CleanUpTask(unsigned int slot)
 {
+   // entries of an interrupted block are dropped
+   if (fRunInBulk)
+      fBlockEntries[slot].clear();
    for (auto &ptr : fBookedActions)
       ptr->FinalizeSlot(slot);
    for (auto &ptr : fBookedFilters)
@@ -602,19 +738,50 @@ void RLoopManager::CleanUpTask(unsigned int slot)
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
+/// The code to jit of all computation graphs is compiled together, after the lambdas it uses whose declaration has
+/// been deferred because batched jitting is enabled (see SetBatchedJitting) have been declared in a single
+/// transaction. The code of the other graphs whose lambdas cannot be declared is left out: it is jitted, and the
+/// error reported, when they run.
 /// This method also clears the contents of GetCodeToJit().
 void RLoopManager::Jit()
 {
    // TODO this should be a read lock unless we find GetCodeToJit non-empty
    R__LOCKGUARD(gROOTMutex);
 
-   const std::string code = std::move(GetCodeToJit());
+   auto &codeToJit = GetCodeToJit();
+   std::vector<RLoopManager *> lms{this};
+   for (const auto &lmAndCode : codeToJit)
+      if (lmAndCode.first != this)
+         lms.emplace_back(lmAndCode.first);
+
+   TStopwatch s;
+   s.Start();
+   const auto failed = RDFInternal::DeclarePendingLambdas(lms);
+   s.Stop();
+   if (s.RealTime() > 1e-3)
+      R__LOG_INFO(RDFLogChannel()) << "Declaration of jitted expressions completed in "
+                                   << std::to_string(s.RealTime()) << " seconds.";
+   if (failed.count(this) > 0) {
+      // the code of this graph refers to these lambdas: it is discarded as well
+      codeToJit.erase(this);
+      throw std::runtime_error("\nRDataFrame: An error occurred during just-in-time compilation of the expressions of "
+                               "Filters or Defines. The lines above might indicate the cause of the crash\n");
+   }
+
+   std::string code;
+   for (auto it = codeToJit.begin(); it != codeToJit.end();) {
+      if (failed.count(it->first) > 0) {
+         ++it;
+         continue;
+      }
+      code += it->second;
+      it = codeToJit.erase(it);
+   }
    if (code.empty()) {
       R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
       return;
    }
 
-   TStopwatch s;
    s.Start();
    RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
    s.Stop();
@@ -636,6 +803,39 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// Whether any Range that selects global entry numbers is part of the computation graph of the next event loop.
+/// Must be called after EvalChildrenCounts.
+bool RLoopManager::HasActiveGlobalRanges() const
+{
+   return std::any_of(fBookedRanges.begin(), fBookedRanges.end(),
+                      [](RRangeBase *r) { return r->IsGlobal() && r->HasChildren(); });
+}
+
+/// Return the interval [begin, end) of global entry numbers that the next event loop needs to process.
+/// If every branch of the computation graph starts with a Range that selects global entry numbers (ranges booked
+/// with IMT enabled), entries outside of the union of their selections cannot affect any result and do not need to
+/// be read at all. Otherwise, the whole dataset needs to be processed.
+/// Must be called after EvalChildrenCounts.
+std::pair<ULong64_t, ULong64_t> RLoopManager::GetGlobalEntryRange() const
+{
+   const std::pair<ULong64_t, ULong64_t> fullRange{0ull, std::numeric_limits<ULong64_t>::max()};
+   ULong64_t begin = fullRange.second;
+   ULong64_t end = 0ull;
+   unsigned int nActiveRanges = 0u;
+   for (auto *range : fBookedRanges) {
+      if (!range->IsGlobal() || !range->HasChildren())
+         continue;
+      ++nActiveRanges;
+      const auto bounds = range->GetGlobalEntryBounds();
+      begin = std::min(begin, bounds.first);
+      end = std::max(end, bounds.second);
+   }
+   // global ranges only hang from the RLoopManager: if they are all of its active children, nothing else needs entries
+   if (nActiveRanges == 0u || nActiveRanges != fNChildren)
+      return fullRange;
+   return {begin, end};
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 void RLoopManager::Run()
@@ -662,6 +862,7 @@ void RLoopManager::Run()
    case ELoopType::kDataSource: RunDataSource(); break;
    }
    s.Stop();
+   fLoopRealTime = s.RealTime();
 
    CleanUpNodes();
 
@@ -696,7 +897,8 @@ void RLoopManager::Deregister(RDFInternal::RActionBase *actionPtr)
 void RLoopManager::Book(RFilterBase *filterPtr)
 {
    fBookedFilters.emplace_back(filterPtr);
-   if (filterPtr->HasName()) {
+   // varied clones of named filters do not appear in reports: only the nominal selection is tracked
+   if (filterPtr->HasName() && filterPtr->GetVariation() == "nominal") {
       fBookedNamedFilters.emplace_back(filterPtr);
       fMustRunNamedFilters = true;
    }
@@ -719,6 +921,22 @@ void RLoopManager::Deregister(RRangeBase *rangePtr)
 }
 
 // dummy call, end of recursive chain of calls
+/// Set the number of entries that the next event loops process together, see RInterface::SetBulkSize.
+void RLoopManager::SetBulkSize(unsigned int bulkSize)
+{
+   if (bulkSize == 0)
+      throw std::runtime_error("RDataFrame: the bulk size must be at least 1.");
+   fBulkSize = bulkSize;
+}
+
+/// All the entries of a block pass the RLoopManager.
+const char *RLoopManager::CheckFiltersBulk(unsigned int slot, const std::vector<Long64_t> &entries)
+{
+   auto &mask = fBlockMasks[slot];
+   mask.resize(entries.size(), 1);
+   return mask.data();
+}
+
 bool RLoopManager::CheckFilters(unsigned int, Long64_t)
 {
    return true;
@@ -731,10 +949,10 @@ void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
       fPtr->FillReport(rep);
 }
 
-void RLoopManager::ToJitExec(const std::string &code) const
+void RLoopManager::ToJitExec(const std::string &code)
 {
    R__LOCKGUARD(gROOTMutex);
-   GetCodeToJit().append(code);
+   GetCodeToJit()[this].append(code);
 }
 
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
@@ -745,6 +963,32 @@ void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(u
       fCallbacks.emplace_back(everyNEvents, std::move(f), fNSlots);
 }
 
+/// Add the timers of the last event loop to the report. Called by the Profile action when it is finalized, i.e.
+/// before the booked actions are moved to the list of actions that were run.
+void RLoopManager::FillProfileReport(ROOT::RDF::RProfileReport &rep) const
+{
+   rep.fRealTime = fLoopRealTime;
+   if (!fProfilingEnabled)
+      return;
+
+   for (const auto &readTimer : fProfiler.GetReadTimers())
+      rep.AddNode("Read", readTimer.first, *readTimer.second);
+   for (const auto &defineTimer : fProfiler.GetDefineTimers())
+      if (!RDFInternal::IsInternalColumn(defineTimer.first))
+         rep.AddNode("Define", defineTimer.first, *defineTimer.second);
+   for (const auto *filter : fBookedFilters) {
+      if (!filter->GetTimer().IsEnabled())
+         continue;
+      std::string name = filter->HasName() ? filter->GetName() : "Unnamed Filter";
+      if (filter->GetVariation() != "nominal")
+         name += " (" + filter->GetVariation() + ")";
+      rep.AddNode("Filter", name, filter->GetTimer());
+   }
+   for (auto *action : fBookedActions)
+      if (action->GetTimer().IsEnabled())
+         rep.AddNode("Action", action->GetActionName(), action->GetTimer());
+}
+
 std::vector<std::string> RLoopManager::GetFiltersNames()
 {
    std::vector<std::string> filters;
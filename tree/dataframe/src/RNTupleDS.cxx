@@ -15,6 +15,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RFieldValue.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -25,6 +26,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -108,12 +110,79 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetFilteredClusterRanges() const
+{
+   const auto &desc = fSources[0]->GetDescriptor();
+
+   // The principal columns of the fields whose statistics can be used to skip clusters
+   std::vector<std::pair<DescriptorId_t, const RClusterFilter *>> filterColumns;
+   for (const auto &filter : fClusterFilters) {
+      const auto fieldId = desc.FindFieldId(filter.fFieldName);
+      if (fieldId == kInvalidDescriptorId)
+         throw RException(R__FAIL("cluster filter on unknown field '" + filter.fFieldName + "'"));
+      // The elements of fields inside collections do not correspond to entries
+      bool isEntryField = true;
+      for (auto parentId = desc.GetFieldDescriptor(fieldId).GetParentId();
+           parentId != desc.GetFieldZeroId(); parentId = desc.GetFieldDescriptor(parentId).GetParentId()) {
+         if (desc.GetFieldDescriptor(parentId).GetStructure() != ENTupleStructure::kRecord)
+            isEntryField = false;
+      }
+      const auto columnId = desc.FindColumnId(fieldId, 0);
+      if (isEntryField && (columnId != kInvalidDescriptorId))
+         filterColumns.emplace_back(columnId, &filter);
+   }
+
+   std::vector<const RClusterDescriptor *> clusters;
+   for (std::size_t i = 0; i < desc.GetNClusters(); ++i)
+      clusters.emplace_back(&desc.GetClusterDescriptor(i));
+   std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+      return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+   });
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> selected;
+   ULong64_t nSelectedEntries = 0;
+   for (const auto cluster : clusters) {
+      bool isSelected = true;
+      for (const auto &fc : filterColumns) {
+         if (!cluster->HasColumnStatistics(fc.first))
+            continue;
+         if (!cluster->GetColumnStatistics(fc.first).Overlaps(fc.second->fMin, fc.second->fMax)) {
+            isSelected = false;
+            break;
+         }
+      }
+      if (!isSelected)
+         continue;
+
+      selected.emplace_back(cluster->GetFirstEntryIndex(), cluster->GetFirstEntryIndex() + cluster->GetNEntries());
+      nSelectedEntries += cluster->GetNEntries();
+   }
+
+   // Merge adjacent clusters as long as there remain about one range per slot for the event loop
+   const ULong64_t maxRangeEntries = std::max(1ULL, nSelectedEntries / std::max(1U, fNSlots));
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   for (const auto &range : selected) {
+      if (!ranges.empty() && (ranges.back().second == range.first) &&
+          (range.second - ranges.back().first <= maxRangeEntries)) {
+         ranges.back().second = range.second;
+      } else {
+         ranges.emplace_back(range);
+      }
+   }
+   return ranges;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges) return ranges;
 
+   if (!fClusterFilters.empty()) {
+      fHasSeenAllRanges = true;
+      return GetFilteredClusterRanges();
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -179,3 +248,14 @@ ROOT::RDataFrame ROOT::Experimental::MakeNTupleDataFrame(std::string_view ntuple
    ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(std::move(pageSource)));
    return rdf;
 }
+
+ROOT::RDataFrame ROOT::Experimental::MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName,
+                                                        const std::vector<RNTupleDS::RClusterFilter> &clusterFilters)
+{
+   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   auto ds = std::make_unique<RNTupleDS>(std::move(pageSource));
+   for (const auto &filter : clusterFilters)
+      ds->AddClusterFilter(filter);
+   ROOT::RDataFrame rdf(std::move(ds));
+   return rdf;
+}
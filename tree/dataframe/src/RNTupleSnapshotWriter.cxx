@@ -0,0 +1,317 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNTupleSnapshotWriter.hxx"
+#include "ROOT/RDataSource.hxx"
+
+#ifdef R__RDF_HAS_RNTUPLE
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RNTupleZip.hxx"
+#include "ROOT/RPageAllocator.hxx"
+#include "ROOT/RPageStorage.hxx"
+#endif
+
+#include <cctype>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::Internal::RDF::RNTupleSnapshotWriter;
+
+#ifdef R__RDF_HAS_RNTUPLE
+
+namespace {
+
+void CheckSnapshotOptions(const ROOT::RDF::RSnapshotOptions &options)
+{
+   std::string mode = options.fMode;
+   for (auto &c : mode)
+      c = std::tolower(c);
+   if (mode != "recreate")
+      throw std::invalid_argument("Snapshot: RNTuple output only supports the \"RECREATE\" file mode, but mode \"" +
+                                  options.fMode + "\" was requested");
+}
+
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RClusterDescriptor;
+using ROOT::Experimental::Detail::RPage;
+using ROOT::Experimental::Detail::RPageSink;
+
+/// The sink of the output file shared by the processing slots
+struct RSharedSink {
+   std::unique_ptr<RPageSink> fSink;
+   /// Connected to fSink but never filled; its columns release their pages to fSink, so it is destructed first
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> fModel;
+   NTupleSize_t fNEntries = 0; ///< Number of entries committed to fSink
+   std::mutex fMutex;          ///< Serializes the cluster commits of the slots
+};
+
+/// The page sink of a processing slot. It packs and compresses the pages of the slot and keeps them in memory until
+/// the cluster is committed; the sealed pages of the cluster are then appended to the shared sink of the output file
+/// in one go. The slots thus compress in parallel and only the writing of their clusters is serialized, as in
+/// TBufferMerger.
+class RSlotPageSink final : public RPageSink {
+   RSharedSink &fShared;
+   /// The sealed pages of the open cluster, indexed by column id, and the buffers they point to
+   std::vector<std::vector<RSealedPage>> fSealedPages;
+   std::vector<std::unique_ptr<unsigned char[]>> fBuffers;
+   std::uint64_t fClusterZippedBytes = 0;
+   NTupleSize_t fNEntries = 0; ///< Number of entries of this slot committed so far
+
+protected:
+   void CreateImpl(const ROOT::Experimental::RNTupleModel &) final {}
+
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      // The on-storage column type determines the packing, it may differ from the in-memory column type
+      const auto element = GetOnStorageElement(columnHandle.fId);
+      const void *packed = page.GetBuffer();
+      std::size_t packedBytes = page.GetSize();
+      std::unique_ptr<unsigned char[]> packBuffer;
+      if (!element->IsMappable()) {
+         packedBytes = (page.GetNElements() * element->GetBitsOnStorage() + 7) / 8;
+         packBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+         element->Pack(packBuffer.get(), page.GetBuffer(), page.GetNElements());
+         packed = packBuffer.get();
+      }
+      auto zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+      const auto zippedBytes = ROOT::Experimental::Detail::RNTupleCompressor::Zip(
+         packed, packedBytes, fOptions.GetCompression(), zipBuffer.get());
+
+      if (fSealedPages.size() <= columnHandle.fId)
+         fSealedPages.resize(columnHandle.fId + 1);
+      fSealedPages[columnHandle.fId].emplace_back(zipBuffer.get(), zippedBytes, page.GetNElements());
+      fBuffers.emplace_back(std::move(zipBuffer));
+      fClusterZippedBytes += zippedBytes;
+      // The pages get their locators in the shared sink
+      return RClusterDescriptor::RLocator();
+   }
+
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      {
+         std::lock_guard<std::mutex> lock(fShared.fMutex);
+         for (std::size_t c = 0; c < fSealedPages.size(); ++c) {
+            for (auto &sealedPage : fSealedPages[c]) {
+               // The statistics of the slot's cluster cover the values of all its pages
+               if (fOptions.GetUseColumnStatistics())
+                  sealedPage.fStatistics = &fOpenColumnStatistics[c];
+               fShared.fSink->CommitSealedPage(c, sealedPage);
+            }
+         }
+         fShared.fNEntries += nEntries - fNEntries;
+         fShared.fSink->CommitCluster(fShared.fNEntries);
+      }
+      fNEntries = nEntries;
+      for (auto &sealedPages : fSealedPages)
+         sealedPages.clear();
+      fBuffers.clear();
+
+      // Only used to estimate the compression factor of the next cluster
+      RClusterDescriptor::RLocator result;
+      result.fBytesOnStorage = fClusterZippedBytes;
+      fClusterZippedBytes = 0;
+      return result;
+   }
+
+   void CommitDatasetImpl() final {}
+
+public:
+   RSlotPageSink(std::string_view ntupleName, const ROOT::Experimental::RNTupleWriteOptions &options,
+                 RSharedSink &shared)
+      : RPageSink(ntupleName, options), fShared(shared)
+   {
+   }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final
+   {
+      if (nElements == 0)
+         nElements = GetDefaultNElementsPerPage(columnHandle);
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+   }
+
+   void ReleasePage(RPage &page) final { ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(page); }
+};
+
+} // anonymous namespace
+
+struct RNTupleSnapshotWriter::RImpl {
+   /// The writer of a processing slot, the top-level fields of its model, in the order of the output columns, and
+   /// the entry bound to the values of the columns
+   struct RSlotWriter {
+      std::unique_ptr<ROOT::Experimental::RNTupleWriter> fWriter;
+      std::vector<ROOT::Experimental::Detail::RFieldBase *> fFields;
+      std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+   };
+
+   std::string fFileName;
+   std::string fNTupleName;
+   std::vector<std::string> fFieldNames;
+   std::vector<std::string> fTypeNames;
+   ROOT::Experimental::RNTupleWriteOptions fWriteOptions;
+   /// With more than one slot, the sink of the output file; declared before the slots, which commit to it
+   std::unique_ptr<RSharedSink> fShared;
+   std::once_flag fSharedOnce;
+   std::vector<RSlotWriter> fSlots;
+
+   /// If `fields` is given, it receives the top-level fields of the model
+   std::unique_ptr<ROOT::Experimental::RNTupleModel>
+   CreateModel(std::vector<ROOT::Experimental::Detail::RFieldBase *> *fields) const
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      for (std::size_t i = 0; i < fFieldNames.size(); ++i) {
+         auto field = ROOT::Experimental::Detail::RFieldBase::Create(fFieldNames[i], fTypeNames[i]).Unwrap();
+         if (fields)
+            fields->emplace_back(field.get());
+         model->AddField(std::move(field));
+      }
+      return model;
+   }
+
+   void CreateSharedSink()
+   {
+      std::call_once(fSharedOnce, [this]() {
+         auto shared = std::make_unique<RSharedSink>();
+         shared->fModel = CreateModel(nullptr);
+         shared->fSink = ROOT::Experimental::Detail::RPageSink::Create(fNTupleName, fFileName, fWriteOptions);
+         shared->fSink->Create(*shared->fModel);
+         fShared = std::move(shared);
+      });
+   }
+
+   void OpenSlot(unsigned int slot)
+   {
+      auto &slotWriter = fSlots[slot];
+      slotWriter.fFields.clear();
+      auto model = CreateModel(&slotWriter.fFields);
+      // The values are bound to the entry by Fill
+      slotWriter.fEntry = std::make_unique<ROOT::Experimental::REntry>();
+      for (auto field : slotWriter.fFields)
+         slotWriter.fEntry->CaptureValue(field->CaptureValue(nullptr));
+
+      std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink;
+      if (fSlots.size() == 1) {
+         sink = ROOT::Experimental::Detail::RPageSink::Create(fNTupleName, fFileName, fWriteOptions);
+      } else {
+         CreateSharedSink();
+         sink = std::make_unique<RSlotPageSink>(fNTupleName, fWriteOptions, *fShared);
+      }
+      slotWriter.fWriter = std::make_unique<ROOT::Experimental::RNTupleWriter>(std::move(model), std::move(sink));
+   }
+};
+
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName,
+                                             const std::string &ntupleName, const std::vector<std::string> &fieldNames,
+                                             const std::vector<std::string> &typeNames,
+                                             const ROOT::RDF::RSnapshotOptions &options)
+   : fImpl(std::make_unique<RImpl>())
+{
+   CheckSnapshotOptions(options);
+   fImpl->fFileName = fileName;
+   fImpl->fNTupleName = ntupleName;
+   fImpl->fFieldNames = fieldNames;
+   fImpl->fTypeNames = typeNames;
+   fImpl->fWriteOptions.SetCompression(
+      ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+   // Record the value ranges of the clusters, such that RNTupleDS can skip clusters when the snapshot is read back
+   fImpl->fWriteOptions.SetUseColumnStatistics(true);
+   // As for TTrees, a negative AutoFlush value is the target size in bytes of the compressed clusters
+   if (options.fAutoFlush < 0)
+      fImpl->fWriteOptions.SetApproxZippedClusterSize(-options.fAutoFlush);
+   fImpl->fSlots.resize(nSlots);
+
+   // Fail early, at booking time, if any of the column types cannot be stored in an RNTuple
+   for (std::size_t i = 0; i < fieldNames.size(); ++i) {
+      auto field = ROOT::Experimental::Detail::RFieldBase::Create(fieldNames[i], typeNames[i]);
+      if (!field)
+         throw std::runtime_error("Snapshot: column \"" + fieldNames[i] + "\" of type \"" + typeNames[i] +
+                                  "\" cannot be written to an RNTuple: " + field.GetError()->GetReport());
+   }
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::InitSlot(unsigned int slot)
+{
+   if (!fImpl->fSlots[slot].fWriter)
+      fImpl->OpenSlot(slot);
+}
+
+void RNTupleSnapshotWriter::Fill(unsigned int slot, const std::vector<void *> &values)
+{
+   auto &slotWriter = fImpl->fSlots[slot];
+   // Rebind only the values whose address changed since the previous entry
+   auto value = slotWriter.fEntry->begin();
+   for (std::size_t i = 0; i < values.size(); ++i, ++value) {
+      if (value->GetRawPtr() != values[i])
+         *value = slotWriter.fFields[i]->CaptureValue(values[i]);
+   }
+   slotWriter.fWriter->Fill(*slotWriter.fEntry);
+}
+
+void RNTupleSnapshotWriter::Finalize()
+{
+   auto &slots = fImpl->fSlots;
+   if (slots.size() == 1) {
+      // Single slot: the writer writes the output file directly. If it was never used, write an empty RNTuple.
+      if (!slots[0].fWriter)
+         fImpl->OpenSlot(0);
+      slots[0].fWriter.reset();
+      return;
+   }
+
+   // Destroying the slot writers commits their last clusters to the shared sink. If no slot processed any entry,
+   // this writes an empty RNTuple with the right schema.
+   fImpl->CreateSharedSink();
+   for (auto &slotWriter : slots)
+      slotWriter.fWriter.reset();
+   fImpl->fShared->fSink->CommitDataset();
+   fImpl->fShared.reset();
+}
+
+std::unique_ptr<ROOT::RDF::RDataSource>
+ROOT::Internal::RDF::MakeNTupleSnapshotDS(const std::string &ntupleName, const std::string &fileName)
+{
+   return std::make_unique<ROOT::Experimental::RNTupleDS>(
+      ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName));
+}
+
+#else // R__RDF_HAS_RNTUPLE
+
+struct RNTupleSnapshotWriter::RImpl {
+};
+
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int, const std::string &, const std::string &,
+                                             const std::vector<std::string> &, const std::vector<std::string> &,
+                                             const ROOT::RDF::RSnapshotOptions &)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::InitSlot(unsigned int) {}
+
+void RNTupleSnapshotWriter::Fill(unsigned int, const std::vector<void *> &) {}
+
+void RNTupleSnapshotWriter::Finalize() {}
+
+std::unique_ptr<ROOT::RDF::RDataSource>
+ROOT::Internal::RDF::MakeNTupleSnapshotDS(const std::string &, const std::string &)
+{
+   throw std::runtime_error("Reading RNTuples with RDataFrame requires ROOT to be built with root7=ON");
+}
+
+#endif // R__RDF_HAS_RNTUPLE
@@ -0,0 +1,102 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNodeTimer.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+using ROOT::Internal::RDF::RNodeTimer;
+using ROOT::Internal::RDF::RProfiler;
+
+namespace {
+
+ULong64_t Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/// Time spent in the scopes nested in the innermost open scope of this thread.
+/// A processing slot is used by a single thread at a time and scopes are strictly nested within a thread, so a
+/// thread-local value is enough to keep track of the nesting.
+ULong64_t &NestedTime()
+{
+   thread_local ULong64_t nestedTime = 0ull;
+   return nestedTime;
+}
+
+} // anonymous namespace
+
+void RNodeTimer::RScope::Start()
+{
+   auto &nestedTime = NestedTime();
+   fOuterNestedTime = nestedTime;
+   nestedTime = 0ull;
+   fStart = Now();
+}
+
+void RNodeTimer::RScope::Stop()
+{
+   const auto elapsed = Now() - fStart;
+   auto &nestedTime = NestedTime();
+   auto &counters = fTimer->fCounters[fSlot];
+   counters.fNanoseconds += elapsed > nestedTime ? elapsed - nestedTime : 0ull;
+   ++counters.fCalls;
+   nestedTime = fOuterNestedTime + elapsed;
+}
+
+void RNodeTimer::Reset(bool enable)
+{
+   for (auto &counters : fCounters) {
+      counters.fNanoseconds = 0ull;
+      counters.fCalls = 0ull;
+   }
+   fEnabled = enable;
+}
+
+std::string RNodeTimer::Summary() const
+{
+   if (!fEnabled)
+      return "";
+   ULong64_t nanoseconds = 0ull;
+   ULong64_t calls = 0ull;
+   for (const auto &counters : fCounters) {
+      nanoseconds += counters.fNanoseconds;
+      calls += counters.fCalls;
+   }
+   std::stringstream ss;
+   ss << std::fixed << std::setprecision(3) << nanoseconds * 1e-9 << " s, " << calls << " entries";
+   return ss.str();
+}
+
+RNodeTimer &RProfiler::GetReadTimer(const std::string &colName)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &timer = fReadTimers[colName];
+   if (!timer) {
+      timer = std::make_unique<RNodeTimer>(fNSlots);
+      timer->Reset(true);
+   }
+   return *timer;
+}
+
+void RProfiler::AddDefineTimer(const std::string &name, const RNodeTimer &timer)
+{
+   auto isThisTimer = [&timer](const std::pair<std::string, const RNodeTimer *> &t) { return t.second == &timer; };
+   if (std::none_of(fDefineTimers.begin(), fDefineTimers.end(), isThisTimer))
+      fDefineTimers.emplace_back(name, &timer);
+}
+
+void RProfiler::Clear()
+{
+   fReadTimers.clear();
+   fDefineTimers.clear();
+}
@@ -0,0 +1,89 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "ROOT/RDF/RNodeTimer.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace ROOT {
+
+namespace RDF {
+
+RNodeProfile::RNodeProfile(const std::string &kind, const std::string &name,
+                           const ROOT::Internal::RDF::RNodeTimer &timer)
+   : fKind(kind), fName(name), fTimes(timer.GetNSlots()), fEntries(timer.GetNSlots())
+{
+   for (auto slot = 0u; slot < timer.GetNSlots(); ++slot) {
+      fTimes[slot] = timer.GetNanoseconds(slot) * 1e-9;
+      fEntries[slot] = timer.GetCalls(slot);
+   }
+}
+
+double RNodeProfile::GetTime() const
+{
+   return std::accumulate(fTimes.begin(), fTimes.end(), 0.);
+}
+
+ULong64_t RNodeProfile::GetEntries() const
+{
+   return std::accumulate(fEntries.begin(), fEntries.end(), 0ull);
+}
+
+void RProfileReport::AddNode(const std::string &kind, const std::string &name,
+                             const ROOT::Internal::RDF::RNodeTimer &timer)
+{
+   fNodes.emplace_back(RNodeProfile(kind, name, timer));
+}
+
+void RProfileReport::Print() const
+{
+   std::vector<const RNodeProfile *> nodes;
+   for (auto &node : fNodes)
+      nodes.emplace_back(&node);
+   std::stable_sort(nodes.begin(), nodes.end(),
+                    [](const RNodeProfile *a, const RNodeProfile *b) { return a->GetTime() > b->GetTime(); });
+
+   double totalTime = 0.;
+   for (auto *node : nodes)
+      totalTime += node->GetTime();
+
+   Printf("Event loop: %.3f s elapsed, %.3f s spent in the profiled nodes", fRealTime, totalTime);
+   for (auto *node : nodes) {
+      const auto time = node->GetTime();
+      const auto entries = node->GetEntries();
+      const auto fraction = totalTime > 0. ? 100. * time / totalTime : 0.;
+      const auto timePerEntry = entries > 0 ? 1e9 * time / entries : 0.;
+      Printf("%-6s %-30s: time=%10.3f s (%5.1f %%) entries=%-12llu time/entry=%10.1f ns", node->GetKind().c_str(),
+             node->GetName().c_str(), time, fraction, entries, timePerEntry);
+   }
+}
+
+const RNodeProfile &RProfileReport::At(std::string_view kind, std::string_view name) const
+{
+   const RNodeProfile *found = nullptr;
+   for (auto &node : fNodes) {
+      if (node.GetKind() != kind || node.GetName() != name)
+         continue;
+      if (found != nullptr)
+         throw std::runtime_error("There is more than one " + std::string(kind) + " called \"" + std::string(name) +
+                                  "\" in the profile report.");
+      found = &node;
+   }
+   if (found == nullptr)
+      throw std::runtime_error("Cannot find a " + std::string(kind) + " called \"" + std::string(name) +
+                               "\" in the profile report.");
+   return *found;
+}
+
+} // End NS RDF
+
+} // End NS ROOT
@@ -10,12 +10,14 @@
 
 #include "ROOT/RDF/RRangeBase.hxx"
 
+#include <limits>
+
 using ROOT::Detail::RDF::RRangeBase;
 using ROOT::Detail::RDF::RLoopManager;
 
 RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
-                       const unsigned int nSlots)
-   : RNodeBase(implPtr), fStart(start), fStop(stop), fStride(stride), fNSlots(nSlots) { }
+                       const unsigned int nSlots, bool isGlobal)
+   : RNodeBase(implPtr), fStart(start), fStop(stop), fStride(stride), fNSlots(nSlots), fIsGlobal(isGlobal) { }
 
 void RRangeBase::ResetCounters()
 {
@@ -24,5 +26,11 @@ void RRangeBase::ResetCounters()
    fHasStopped = false;
 }
 
+std::pair<ULong64_t, ULong64_t> RRangeBase::GetGlobalEntryBounds() const
+{
+   const ULong64_t end = fStop == 0 ? std::numeric_limits<ULong64_t>::max() : fStop;
+   return {fStart, end};
+}
+
 // outlined to pin virtual table
 RRangeBase::~RRangeBase() { }
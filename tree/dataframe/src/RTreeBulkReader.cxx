@@ -0,0 +1,118 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RTreeBulkReader.hxx>
+#include <TBranch.h>
+#include <TClass.h>
+#include <TDataType.h>
+#include <TLeaf.h>
+#include <TMath.h>
+#include <TTree.h>
+#include <TTreeReader.h>
+
+ROOT::Internal::RDF::RTreeBulkReader::RTreeBulkReader(TTreeReader &r, const std::string &colName,
+                                                      const std::type_info &valueType,
+                                                      const std::type_info *vectorType)
+   : fReader(&r), fBranchName(colName), fVectorClass(vectorType ? TClass::GetClass(*vectorType) : nullptr),
+     fJagged(vectorType != nullptr)
+{
+   // Types without a TDataType (fValueSize stays 0) are never read in bulk
+   const auto type = TDataType::GetType(valueType);
+   if (auto *dataType = TDataType::GetDataType(type)) {
+      fTypeName = TDataType::GetTypeName(type);
+      fValueSize = dataType->Size();
+   }
+}
+
+/// Look up the branch in the given tree and check whether it can be read in bulk.
+void ROOT::Internal::RDF::RTreeBulkReader::SetTree(TTree &tree)
+{
+   fTree = &tree;
+   fBranch = nullptr;
+   fFirst = fEnd = 0;
+   if (fValueSize == 0)
+      return;
+
+   auto *branch = tree.GetBranch(fBranchName.c_str());
+   // TTree::GetBranch also looks into friend trees, whose entries do not follow the ones of this tree
+   if (!branch || branch->GetTree() != &tree)
+      return;
+   if (branch->GetListOfBranches()->GetEntriesFast() != 0 || branch->GetListOfLeaves()->GetEntriesFast() != 1)
+      return;
+   auto *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLenStatic() != 1)
+      return;
+
+   if (fJagged) {
+      Int_t headerSize = 0, elementSize = 0;
+      if (!leaf->GetJaggedLayout(headerSize, elementSize) || elementSize != fValueSize)
+         return;
+      // Arrays with a count leaf have a fundamental leaf type, std::vectors are identified by their class
+      if (leaf->GetLeafCount() ? fTypeName != leaf->GetTypeName()
+                               : !fVectorClass || TClass::GetClass(branch->GetClassName()) != fVectorClass)
+         return;
+   } else {
+      if (branch->IsA() != TBranch::Class() || leaf->GetLeafCount() || fTypeName != leaf->GetTypeName() ||
+          leaf->GetLenType() != fValueSize)
+         return;
+   }
+
+   fBranch = branch;
+}
+
+/// Load the basket of fBranch that contains the given local entry. Return false if the branch cannot be read in bulk.
+bool ROOT::Internal::RDF::RTreeBulkReader::LoadBasket(Long64_t entry)
+{
+   // The bulk reading methods only deserialize whole baskets, starting from their first entry
+   const auto *basketEntry = fBranch->GetBasketEntry();
+   const auto basket = TMath::BinarySearch(fBranch->GetWriteBasket() + 1, basketEntry, entry);
+   // Baskets that were never written (e.g. those of in-memory trees) are still being filled and are read normally
+   if (basket < 0 || fBranch->GetBasketSeek(basket) == 0)
+      return false;
+   const auto first = basketEntry[basket];
+
+   const auto n = fJagged ? fBranch->GetBulkRead().GetBulkEntriesJagged(first, fBuffer, fOffsets)
+                          : fBranch->GetBulkRead().GetBulkEntries(first, fBuffer);
+   if (n <= 0 || entry >= first + n)
+      return false;
+
+   fFirst = first;
+   fEnd = first + n;
+   return true;
+}
+
+Long64_t ROOT::Internal::RDF::RTreeBulkReader::Seek(bool &loaded)
+{
+   loaded = false;
+   auto *chainOrTree = fReader->GetTree();
+   if (!chainOrTree)
+      return -1;
+   // The branches of a TChain are the ones of its current tree; entries are numbered within that tree
+   auto *tree = chainOrTree->GetTree();
+   const auto treeNumber = chainOrTree->GetTreeNumber();
+   if (!tree)
+      return -1;
+   if (tree != fTree || treeNumber != fTreeNumber) {
+      fTreeNumber = treeNumber;
+      SetTree(*tree);
+   }
+   if (!fBranch)
+      return -1;
+
+   const auto entry = tree->GetReadEntry();
+   if (entry < fFirst || entry >= fEnd) {
+      if (!LoadBasket(entry)) {
+         // Do not retry for the rest of this tree: the TTreeReader takes over
+         fBranch = nullptr;
+         fFirst = fEnd = 0;
+         return -1;
+      }
+      loaded = true;
+   }
+   return entry - fFirst;
+}
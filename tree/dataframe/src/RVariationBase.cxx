@@ -0,0 +1,57 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RVariationBase.hxx"
+
+#include <algorithm>
+#include <stdexcept> // std::logic_error
+#include <string>
+#include <vector>
+
+namespace {
+std::vector<std::string> MakeVariationNames(const std::string &variationName, const std::vector<std::string> &tags)
+{
+   std::vector<std::string> names;
+   names.reserve(tags.size());
+   for (const auto &tag : tags)
+      names.emplace_back(variationName + ':' + tag);
+   return names;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RVariationBase::RVariationBase(std::string_view colName, std::string_view variationName,
+                               const std::vector<std::string> &tags, std::string_view type, unsigned int nSlots,
+                               const RBookedDefines &defines,
+                               const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+                               ROOT::RDF::RDataSource *ds)
+   : fColumnName(colName), fVariationName(variationName),
+     fVariationNames(MakeVariationNames(fVariationName, tags)), fType(type), fNSlots(nSlots),
+     fLastCheckedEntry(fNSlots, -1), fDefines(defines), fIsInitialized(fNSlots, false), fDSValuePtrs(DSValuePtrs),
+     fDataSource(ds)
+{
+}
+
+// pin vtable. Work around cling JIT issue.
+RVariationBase::~RVariationBase() {}
+
+std::size_t RVariationBase::GetVariationIndex(const std::string &variationName) const
+{
+   const auto it = std::find(fVariationNames.begin(), fVariationNames.end(), variationName);
+   if (it == fVariationNames.end())
+      throw std::logic_error("Variation \"" + variationName + "\" is not provided by the variation of column \"" +
+                             fColumnName + "\".");
+   return std::distance(fVariationNames.begin(), it);
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,32 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RVariationReader.hxx>
+#include <ROOT/RDF/Utils.hxx> // TypeID2TypeName
+
+#include <cstring>   // std::strcmp
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <typeinfo>
+
+void ROOT::Internal::RDF::CheckVariationType(RVariationBase &variation, const std::type_info &tid)
+{
+   const auto &colTId = variation.GetTypeId();
+
+   // Here we compare names and not typeinfos since they may come from two different contexts: a compiled
+   // and a jitted one.
+   if (0 != std::strcmp(colTId.name(), tid.name())) {
+      const auto tName = TypeID2TypeName(tid);
+      const auto colTypeName = TypeID2TypeName(colTId);
+      std::string errMsg = "RVariationReader: column \"" + variation.GetColumnName() + "\" is being used as ";
+      errMsg += tName.empty() ? std::string(tid.name()) + " (extracted from type info)" : tName;
+      errMsg += " but its variation \"" + variation.GetVariationName() + "\" has type ";
+      errMsg += colTypeName.empty() ? std::string(colTId.name()) + " (extracted from type info)" : colTypeName;
+      throw std::runtime_error(errMsg);
+   }
+}
@@ -346,3 +346,61 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+// Return the names of the files in directory `dir`
+static std::vector<std::string> ListFiles(const char *dir)
+{
+   std::vector<std::string> files;
+   void *dirp = gSystem->OpenDirectory(dir);
+   while (const char *entry = gSystem->GetDirEntry(dirp)) {
+      const std::string name(entry);
+      if (name != "." && name != "..")
+         files.emplace_back(name);
+   }
+   gSystem->FreeDirectory(dirp);
+   return files;
+}
+
+TEST(Cache, DiskSnapshot)
+{
+   const auto scratchDir = "dataframe_cache_ondisk";
+   gSystem->mkdir(scratchDir);
+
+   ROOT::RDF::RCacheOptions opts;
+   opts.fStorage = ROOT::RDF::ECacheStorage::kDiskSnapshot;
+   opts.fScratchDir = scratchDir;
+   opts.fReadBufferSize = 4 * 1024; // tiny clusters, so that the cache is read back in several chunks
+   {
+      ROOT::RDataFrame df(1000);
+      auto cached = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                       .Define("y", [](int x) { return std::vector<float>(x % 3, x); }, {"x"})
+                       .Filter([](int x) { return x % 2 == 0; }, {"x"})
+                       .Cache<int, std::vector<float>>({"x", "y"}, opts);
+      EXPECT_EQ(ListFiles(scratchDir).size(), 1u);
+
+      auto xs = *cached.Take<int>("x");
+      std::sort(xs.begin(), xs.end());
+      ASSERT_EQ(xs.size(), 500u);
+      for (auto i : ROOT::TSeqU(500))
+         EXPECT_EQ(xs[i], int(2 * i));
+      auto nBadY =
+         cached.Filter([](int x, const std::vector<float> &y) { return y != std::vector<float>(x % 3, x); }, {"x", "y"})
+            .Count();
+      EXPECT_EQ(*nBadY, 0ull);
+
+      // jitted, with a regex
+      auto cachedj = df.Define("z", "rdfentry_ * 2").Cache("z", opts);
+      EXPECT_EQ(ListFiles(scratchDir).size(), 2u);
+      EXPECT_EQ(*cachedj.Sum<ULong64_t>("z"), 999000ull);
+   }
+   // the scratch files are removed together with the cached dataframes
+   EXPECT_TRUE(ListFiles(scratchDir).empty());
+   gSystem->Unlink(scratchDir);
+}
+
+TEST(Cache, InMemoryWithOptions)
+{
+   ROOT::RDataFrame df(5);
+   auto cached = df.Define("x", "int(rdfentry_)").Cache<int>({"x"}, ROOT::RDF::RCacheOptions());
+   EXPECT_EQ(*cached.Sum<int>("x"), 10);
+}
@@ -1,5 +1,9 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/TSeq.hxx"
+#include "TH3D.h"
+#include "THnSparse.h"
+#include "TProfile.h"
+#include "TROOT.h"
 
 #include "gtest/gtest.h"
 
@@ -285,3 +289,79 @@ TEST(RDataFrameHisto, FillVecBool)
     EXPECT_EQ(h->GetBinContent(2), n);
     EXPECT_EQ(h->GetBinContent(3), 0u);
 }
+
+TEST(RDataFrameHisto, FillShared)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   // enough entries for each slot to flush its buffer several times
+   ROOT::RDataFrame df(10000);
+   auto d = df.Define("x", [](ULong64_t e) { return (e % 10) + 0.5; }, {"rdfentry_"})
+               .Define("y", [](ULong64_t e) { return (e % 7) + 0.5; }, {"rdfentry_"})
+               .Define("z", [](ULong64_t e) { return (e % 3) + 0.5; }, {"rdfentry_"})
+               .Define("w", [](ULong64_t e) { return e % 2 + 1.; }, {"rdfentry_"});
+   const ::TH3D model("h", "h", 10, 0, 10, 7, 0, 7, 3, 0, 3);
+   auto hPerSlot = d.Fill<double, double, double, double>(::TH3D(model), {"x", "y", "z", "w"});
+   auto hShared =
+      d.Fill<double, double, double, double>(::TH3D(model), {"x", "y", "z", "w"}, EFillStrategy::kShared);
+   auto hSharedJit = d.Fill(::TH3D(model), {"x", "y", "z", "w"}, EFillStrategy::kShared);
+
+   EXPECT_DOUBLE_EQ(hShared->GetEntries(), 10000);
+   EXPECT_DOUBLE_EQ(hSharedJit->GetEntries(), 10000);
+   EXPECT_DOUBLE_EQ(hShared->GetSumOfWeights(), hPerSlot->GetSumOfWeights());
+   EXPECT_DOUBLE_EQ(hShared->GetMean(1), hPerSlot->GetMean(1));
+   EXPECT_DOUBLE_EQ(hShared->GetMean(3), hPerSlot->GetMean(3));
+   for (auto bin : ROOT::TSeqI(hPerSlot->GetNcells())) {
+      EXPECT_DOUBLE_EQ(hShared->GetBinContent(bin), hPerSlot->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hSharedJit->GetBinContent(bin), hPerSlot->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hShared->GetBinError(bin), hPerSlot->GetBinError(bin));
+   }
+   EXPECT_DOUBLE_EQ(hShared->GetStdDev(2), hPerSlot->GetStdDev(2));
+   EXPECT_DOUBLE_EQ(hShared->GetCovariance(1, 3), hPerSlot->GetCovariance(1, 3));
+
+   // profiles are filled through a single lock
+   auto pPerSlot = d.Fill<double, double>(::TProfile("p", "p", 10, 0, 10), {"x", "y"});
+   auto pShared = d.Fill<double, double>(::TProfile("p", "p", 10, 0, 10), {"x", "y"}, EFillStrategy::kShared);
+   for (auto bin : ROOT::TSeqI(pPerSlot->GetNcells()))
+      EXPECT_DOUBLE_EQ(pShared->GetBinContent(bin), pPerSlot->GetBinContent(bin));
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
+
+TEST(RDataFrameHisto, FillSharedCollections)
+{
+   ROOT::RDataFrame df(10);
+   auto d = df.Define("v", [] { return ROOT::RVec<double>{0.5, 1.5, 2.5}; })
+               .Define("u", [] { return ROOT::RVec<double>{0.5, 1.5}; })
+               .Define("w", [] { return 2.; });
+   auto h = d.Fill<ROOT::RVec<double>, double>(::TH1D("h", "h", 3, 0, 3), {"v", "w"}, EFillStrategy::kShared);
+   EXPECT_DOUBLE_EQ(h->GetEntries(), 30);
+   for (auto bin : {1, 2, 3})
+      EXPECT_DOUBLE_EQ(h->GetBinContent(bin), 20);
+
+   auto bad = d.Fill<ROOT::RVec<double>, ROOT::RVec<double>>(::TH2D("h2", "h2", 3, 0, 3, 3, 0, 3), {"v", "u"},
+                                                             EFillStrategy::kShared);
+   EXPECT_THROW(bad.GetValue(), std::runtime_error);
+}
+
+TEST(RDataFrameHisto, FillSharedTHnSparse)
+{
+   ROOT::RDataFrame df(100);
+   auto d = df.Define("x", [](ULong64_t e) { return (e % 10) + 0.5; }, {"rdfentry_"})
+               .Define("y", [](ULong64_t e) { return (e % 5) + 0.5; }, {"rdfentry_"})
+               .Define("w", [] { return 2.; });
+   const Int_t nBins[] = {10, 5};
+   const Double_t mins[] = {0, 0};
+   const Double_t maxs[] = {10, 5};
+   auto h = d.Fill<double, double, double>(THnSparseD("hs", "hs", 2, nBins, mins, maxs), {"x", "y", "w"},
+                                           EFillStrategy::kShared);
+   EXPECT_DOUBLE_EQ(h->GetEntries(), 100);
+   const Int_t firstBin[] = {1, 1};
+   EXPECT_DOUBLE_EQ(h->GetBinContent(firstBin), 20);
+
+   EXPECT_THROW((d.Fill<double, double>(THnSparseD("hs", "hs", 2, nBins, mins, maxs), {"x", "y"},
+                                        EFillStrategy::kPerSlot)),
+                std::runtime_error);
+}
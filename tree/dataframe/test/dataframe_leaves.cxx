@@ -1,8 +1,14 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/TSeq.hxx"
+#include "TChain.h"
+#include "TFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 
 using namespace ROOT::VecOps;
 
@@ -72,3 +78,64 @@ TEST(RDFLeaves, OneLeafWithDotNameClass)
    EXPECT_EQ(*res, 40);
 }
 
+
+TEST(RDFLeaves, ReadBasketsInBulk)
+{
+   // Scalars, variable-size arrays and std::vectors of fundamental types are read one basket at a time:
+   // check the values across several baskets and across the trees of a chain
+   const std::vector<std::string> fileNames{"dataframe_leaves_readbasketsinbulk_0.root",
+                                            "dataframe_leaves_readbasketsinbulk_1.root"};
+   const int nEntries = 250;
+   for (auto fileIdx : ROOT::TSeqI(fileNames.size())) {
+      TFile f(fileNames[fileIdx].c_str(), "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      int x = 0;
+      int n = 0;
+      float arr[4];
+      std::vector<double> v;
+      t.Branch("x", &x);
+      t.Branch("n", &n);
+      t.Branch("arr", arr, "arr[n]/F");
+      t.Branch("v", &v);
+      for (auto i : ROOT::TSeqI(nEntries)) {
+         x = fileIdx * nEntries + i;
+         n = x % 4;
+         v.clear();
+         for (auto j : ROOT::TSeqI(n)) {
+            arr[j] = x + j;
+            v.emplace_back(x - j);
+         }
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c("t");
+   for (const auto &fileName : fileNames)
+      c.Add(fileName.c_str());
+   ROOT::RDataFrame df(c);
+   auto xs = df.Take<int>("x");
+   auto arrs = df.Take<RVec<float>>("arr");
+   auto vs = df.Take<RVec<double>>("v");
+   auto sum = df.Filter([](int x) { return x % 3 == 0; }, {"x"}).Sum<int>("x");
+
+   ASSERT_EQ(xs->size(), 2u * nEntries);
+   auto expectedSum = 0;
+   for (auto x : ROOT::TSeqI(2 * nEntries)) {
+      EXPECT_EQ((*xs)[x], x);
+      const auto n = x % 4;
+      ASSERT_EQ((*arrs)[x].size(), std::size_t(n));
+      ASSERT_EQ((*vs)[x].size(), std::size_t(n));
+      for (auto j : ROOT::TSeqI(n)) {
+         EXPECT_FLOAT_EQ((*arrs)[x][j], x + j);
+         EXPECT_DOUBLE_EQ((*vs)[x][j], x - j);
+      }
+      if (x % 3 == 0)
+         expectedSum += x;
+   }
+   EXPECT_EQ(*sum, expectedSum);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
@@ -1,5 +1,13 @@
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RTrivialDS.hxx"
+#include <TFile.h>
 #include <TROOT.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -91,18 +99,100 @@ TEST_F(RDFRanges, NoEarlyStopping)
 }
 
 #ifdef R__USE_IMT
-TEST(RDFRangesMT, ThrowIfIMT)
-{
-   bool hasThrown = false;
-   ROOT::EnableImplicitMT();
-   RDataFrame d(0);
-   try {
-      d.Range(0);
-   } catch (const std::exception &e) {
-      hasThrown = true;
-      EXPECT_STREQ(e.what(), "Range was called with ImplicitMT enabled, but multi-thread is not supported.");
+struct IMTRAII {
+   IMTRAII(unsigned int nThreads = 0u) { ROOT::EnableImplicitMT(nThreads); }
+   ~IMTRAII() { ROOT::DisableImplicitMT(); }
+};
+
+template <typename T>
+std::vector<T> Sorted(std::vector<T> v)
+{
+   std::sort(v.begin(), v.end());
+   return v;
+}
+
+TEST(RDFRangesMT, EmptySource)
+{
+   IMTRAII _;
+   RDataFrame d(100);
+   auto c1 = d.Range(0).Count();
+   auto c2 = d.Range(10).Count();
+   auto m = d.Range(5, 50).Max<ULong64_t>("rdfentry_");
+   auto t = d.Range(5, 10, 3).Take<ULong64_t>("rdfentry_");
+   auto defined = d.Define("x", [](ULong64_t e) { return e * 2; }, {"rdfentry_"}).Range(90, 0).Min<ULong64_t>("x");
+   EXPECT_EQ(*c1, 100u);
+   EXPECT_EQ(*c2, 10u);
+   EXPECT_EQ(*m, 49u);
+   EXPECT_EQ(Sorted(*t), std::vector<ULong64_t>({5, 8}));
+   EXPECT_EQ(*defined, 180u);
+}
+
+TEST(RDFRangesMT, SameAsSingleThread)
+{
+   auto takeRanged = [] {
+      RDataFrame d(1000);
+      auto r1 = d.Range(17, 613, 7).Take<ULong64_t>("rdfentry_");
+      auto r2 = d.Range(400, 0, 3).Take<ULong64_t>("rdfentry_");
+      auto all = d.Count(); // not behind a Range: all entries must still be processed
+      EXPECT_EQ(*all, 1000u);
+      return std::make_pair(Sorted(*r1), Sorted(*r2));
+   };
+   const auto expected = takeRanged();
+   for (unsigned int nThreads : {1u, 2u, 4u}) {
+      IMTRAII _(nThreads);
+      EXPECT_EQ(takeRanged(), expected);
+   }
+}
+
+TEST(RDFRangesMT, TTree)
+{
+   const auto fname = "dataframe_ranges_mt.root";
+   {
+      // many small clusters, so that ranges start and end in the middle of clusters
+      TFile f(fname, "recreate");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      t.SetAutoFlush(7);
+      for (x = 0; x < 200; ++x)
+         t.Fill();
+      t.Write();
+   }
+   auto takeRanged = [&] {
+      RDataFrame d("t", fname);
+      auto r1 = d.Range(10, 100, 3).Take<int>("x");
+      auto r2 = d.Range(150).Take<int>("x");
+      return std::make_pair(Sorted(*r1), Sorted(*r2));
+   };
+   const auto expected = takeRanged();
+   EXPECT_EQ(expected.first.size(), 30u);
+   EXPECT_EQ(expected.second.size(), 150u);
+   {
+      IMTRAII _(4);
+      EXPECT_EQ(takeRanged(), expected);
    }
-   EXPECT_TRUE(hasThrown);
+   gSystem->Unlink(fname);
+}
+
+TEST(RDFRangesMT, DataSource)
+{
+   auto takeRanged = [] {
+      auto d = ROOT::RDF::MakeTrivialDataFrame(100);
+      return Sorted(*d.Range(20, 80, 4).Take<ULong64_t>("col0"));
+   };
+   const auto expected = takeRanged();
+   EXPECT_EQ(expected.size(), 15u);
+   IMTRAII _(4);
+   EXPECT_EQ(takeRanged(), expected);
+}
+
+TEST(RDFRangesMT, ThrowIfNotOnDataset)
+{
+   IMTRAII _;
+   RDataFrame d(10);
+   auto f = d.Filter([] { return true; });
+   EXPECT_THROW(f.Range(0), std::runtime_error);
+   EXPECT_THROW(d.Range(5).Range(2), std::runtime_error);
 }
 #endif
 
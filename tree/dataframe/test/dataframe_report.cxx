@@ -1,5 +1,6 @@
 #include "TRandom.h"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "ROOT/TSeq.hxx"
 #include "gtest/gtest.h"
 
@@ -97,3 +98,32 @@ TEST(RDataFrameReport, ActionLazyness)
    EXPECT_TRUE(hasRun);
 
 }
+
+TEST(RDataFrameReport, Profile)
+{
+   ROOT::RDataFrame d(100);
+   auto df = d.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Filter([](double x) { return x < 50; }, {"x"}, "xcut");
+   auto sum = df.Sum<double>("x");
+   auto profile = df.Profile();
+
+   EXPECT_DOUBLE_EQ(*sum, 1225.);
+   EXPECT_EQ(profile->At("Define", "x").GetEntries(), 100ull);
+   EXPECT_EQ(profile->At("Filter", "xcut").GetEntries(), 100ull);
+   EXPECT_EQ(profile->At("Action", "Sum").GetEntries(), 50ull);
+   for (const auto &node : *profile)
+      EXPECT_GE(node.GetTime(), 0.);
+   EXPECT_GE(profile->GetRealTime(), 0.);
+   EXPECT_THROW(profile->At("Filter", "nonexistent"), std::runtime_error);
+
+   testing::internal::CaptureStdout();
+   profile->Print();
+   EXPECT_NE(testing::internal::GetCapturedStdout().find("xcut"), std::string::npos);
+
+   EXPECT_NE(ROOT::RDF::SaveGraph(d).find("100 entries"), std::string::npos);
+
+   // the following event loop is not profiled
+   auto count = df.Count();
+   EXPECT_EQ(*count, 50ull);
+   EXPECT_EQ(ROOT::RDF::SaveGraph(d).find("entries"), std::string::npos);
+}
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <ROOTUnitTestSupport.h>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
 #include <TFile.h>
@@ -15,6 +16,7 @@
 #include <algorithm> // std::sort
 #include <array>
 #include <chrono>
+#include <numeric> // std::accumulate
 #include <thread>
 #include <set>
 #include <random>
@@ -966,6 +968,225 @@ TEST_P(RDFSimpleTests, WritingToFundamentalType)
    EXPECT_THROW(ROOT::RDataFrame(1).Define("x", [] { return 1; }).Filter("x = 42"), std::runtime_error);
 }
 
+TEST_P(RDFSimpleTests, BatchedJitting)
+{
+   ROOT::RDataFrame df(100);
+   EXPECT_FALSE(df.GetBatchedJitting());
+   df.SetBatchedJitting(true);
+   EXPECT_TRUE(df.GetBatchedJitting());
+
+   auto d = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+   auto f1 = d.Filter("x % 2 == 0 && x > -7");
+   auto f2 = f1.Filter("x < 51 + 0");
+   // a Filter on a batched Define needs the type of the column: this declares all the pending lambdas
+   auto f3 = f2.Define("y", "x * 2 + 0").Filter("y > 10 + 0");
+   EXPECT_EQ(*f2.Count(), 26ull);
+   EXPECT_EQ(*f3.Count(), 20ull);
+   EXPECT_EQ(1u, df.GetNRuns());
+
+   // errors in the expression of a Filter are only reported when the event loop starts
+   ROOT::RDataFrame df2(1);
+   df2.SetBatchedJitting(true);
+   auto bad = df2.Define("x", [] { return 1; }).Filter("x = 43");
+   auto count = bad.Count();
+   EXPECT_THROW(count.GetValue(), std::runtime_error);
+
+   // a failed batch does not affect the next ones
+   ROOT::RDataFrame df3(10);
+   df3.SetBatchedJitting(true);
+   EXPECT_EQ(*df3.Filter("rdfentry_ > 4 + 0").Count(), 5ull);
+
+   // the pending Filters of a computation graph are not declared, nor their errors reported, by other graphs
+   ROOT::RDataFrame df4(10);
+   df4.SetBatchedJitting(true);
+   auto bad4 = df4.Define("x", [] { return 1; }).Filter("x = 44");
+   ROOT::RDataFrame df5(10);
+   EXPECT_EQ(*df5.Define("z", "rdfentry_ * 3 + 0").Filter("z > 5 + 0").Count(), 8ull);
+   auto count4 = bad4.Count();
+   EXPECT_THROW(count4.GetValue(), std::runtime_error);
+
+   // two graphs with pending Filters and Defines: the first one to run also compiles the code of the other
+   ROOT::RDataFrame df6(10);
+   df6.SetBatchedJitting(true);
+   auto count6 = df6.Define("a", "rdfentry_ + 100").Filter("a > 104 + 0").Count();
+   ROOT::RDataFrame df7(10);
+   df7.SetBatchedJitting(true);
+   auto count7 = df7.Define("b", "rdfentry_ + 200").Filter("b < 203 + 0").Count();
+   EXPECT_EQ(*count6, 5ull);
+   EXPECT_EQ(*count7, 3ull);
+   EXPECT_EQ(1u, df7.GetNRuns());
+}
+
+TEST_P(RDFSimpleTests, BatchedJittingDefines)
+{
+   ROOT::RDataFrame df(10);
+   df.SetBatchedJitting(true);
+   // the type of a batched Define is only known once its expression is compiled, when it is first needed
+   auto d = df.Define("x", "rdfentry_ * 1.5").Define("y", "int(rdfentry_) + 300");
+   EXPECT_EQ(d.GetColumnType("y"), "int");
+   EXPECT_EQ(d.GetColumnType("x"), "double");
+   auto sum = d.Define("z", "x + y").Sum<double>("z");
+   EXPECT_DOUBLE_EQ(*sum, 67.5 + 3045.);
+
+   // errors in the expression of a batched Define are reported when its type is needed
+   ROOT::RDataFrame df2(1);
+   df2.SetBatchedJitting(true);
+   auto bad = df2.Define("x", "rdfentry_ + nonexistentvar123");
+   EXPECT_THROW(bad.GetColumnType("x"), std::runtime_error);
+   EXPECT_THROW(bad.GetColumnType("x"), std::runtime_error);
+}
+
+TEST(RDFJitCache, SourceInCacheDirectory)
+{
+   const std::string cacheDir = "dataframe_simple_jitcache";
+   EXPECT_EQ(ROOT::RDF::GetJitCacheDirectory(), "");
+   ROOT::RDF::SetJitCacheDirectory(cacheDir);
+   EXPECT_EQ(ROOT::RDF::GetJitCacheDirectory(), cacheDir);
+   ROOT::RDataFrame df(10);
+   df.SetBatchedJitting(true);
+   auto count = df.Define("c", "rdfentry_ * 7 + 1").Filter("c % 2 == 0 && c > 11 + 1").Count();
+   EXPECT_EQ(*count, 4ull);
+   ROOT::RDF::SetJitCacheDirectory("");
+
+   // the cache holds the source of the batches of expressions, and the libraries ACLiC could make of them
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(dir, nullptr);
+   std::vector<std::string> entries;
+   while (const char *entry = gSystem->GetDirEntry(dir))
+      if (std::string(entry) != "." && std::string(entry) != "..")
+         entries.emplace_back(entry);
+   gSystem->FreeDirectory(dir);
+   EXPECT_TRUE(std::any_of(entries.begin(), entries.end(), [](const std::string &e) {
+      return e.find("rdfjit_") == 0 && e.size() > 2 && e.compare(e.size() - 2, 2, ".C") == 0;
+   }));
+   for (const auto &e : entries)
+      gSystem->Unlink((cacheDir + "/" + e).c_str());
+   gSystem->Unlink(cacheDir.c_str());
+}
+
+// Count the entries it processes, and how many times it was called with a block of entries
+class BulkCountHelper : public ROOT::Detail::RDF::RActionImpl<BulkCountHelper> {
+   const std::shared_ptr<ULong64_t> fCount;
+   const std::shared_ptr<unsigned int> fNBulkCalls;
+   std::vector<ULong64_t> fCounts;
+   std::vector<unsigned int> fBulkCalls;
+
+public:
+   BulkCountHelper(unsigned int nSlots, const std::shared_ptr<unsigned int> &nBulkCalls)
+      : fCount(std::make_shared<ULong64_t>(0ull)), fNBulkCalls(nBulkCalls), fCounts(nSlots, 0ull),
+        fBulkCalls(nSlots, 0u)
+   {
+   }
+   BulkCountHelper(BulkCountHelper &&) = default;
+   BulkCountHelper(const BulkCountHelper &) = delete;
+   using Result_t = ULong64_t;
+   std::shared_ptr<ULong64_t> GetResultPtr() const { return fCount; }
+   void Initialize() {}
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Exec(unsigned int slot, double) { ++fCounts[slot]; }
+   void ExecBulk(unsigned int slot, const double *, std::size_t n)
+   {
+      fCounts[slot] += n;
+      ++fBulkCalls[slot];
+   }
+   void Finalize()
+   {
+      *fCount = std::accumulate(fCounts.begin(), fCounts.end(), 0ull);
+      *fNBulkCalls = std::accumulate(fBulkCalls.begin(), fBulkCalls.end(), 0u);
+   }
+
+   std::string GetActionName() { return "BulkCount"; }
+};
+
+// Run Filters, Defines and actions that support bulk processing on 1000 entries with the given bulk size
+std::vector<double> RunBulkGraph(unsigned int bulkSize, unsigned int nSlots, unsigned int &nBulkCalls)
+{
+   ROOT::RDataFrame df(1000);
+   df.SetBulkSize(bulkSize);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+               .Define("w", [](ULong64_t e) { return float(e % 2); }, {"rdfentry_"});
+   auto f = d.Filter([](double x) { return x > 0.; }, {"x"}, "positive");
+   // y must only be evaluated for the entries that pass the filter above
+   auto g = f.Define("y",
+                     [](double x) {
+                        if (x <= 0.)
+                           throw std::runtime_error("y was evaluated for a rejected entry");
+                        return int(1000. / x);
+                     },
+                     {"x"})
+               .Filter([](int y) { return y % 3 != 0; }, {"y"}, "y not multiple of 3");
+   auto nBulk = std::make_shared<unsigned int>(0u);
+   auto sum = g.Sum<double>("x");
+   auto mean = g.Mean<double>("x");
+   auto min = g.Min<int>("y");
+   auto max = g.Max<int>("y");
+   auto count = g.Count();
+   auto h = g.Histo1D<double>("x");
+   auto hModel = g.Histo1D<double, float>({"h", "h", 100, 0., 1000.}, "x", "w");
+   auto h2 = g.Histo2D<double, int>({"h2", "h2", 10, 0., 1000., 10, 0., 1000.}, "x", "y");
+   auto counted = g.Book<double>(BulkCountHelper(nSlots, nBulk), {"x"});
+   auto report = df.Report();
+
+   std::vector<double> results{*sum,
+                               *mean,
+                               double(*min),
+                               double(*max),
+                               double(*count),
+                               double(*counted),
+                               h->GetEntries(),
+                               h->GetMean(),
+                               hModel->GetSumOfWeights(),
+                               h2->GetEntries(),
+                               h2->GetMean(2)};
+   for (int i = 0; i <= hModel->GetNbinsX() + 1; ++i)
+      results.emplace_back(hModel->GetBinContent(i));
+   for (auto &&cut : *report) {
+      results.emplace_back(cut.GetAll());
+      results.emplace_back(cut.GetPass());
+   }
+   nBulkCalls = *nBulk;
+   return results;
+}
+
+TEST_P(RDFSimpleTests, BulkSize)
+{
+   ROOT::RDataFrame df(1);
+   EXPECT_EQ(1u, df.GetBulkSize());
+   EXPECT_THROW(df.SetBulkSize(0), std::runtime_error);
+   df.SetBulkSize(64);
+   EXPECT_EQ(64u, df.GetBulkSize());
+
+   unsigned int nBulkCalls = 0u;
+   const auto expected = RunBulkGraph(1u, NSLOTS, nBulkCalls);
+   EXPECT_EQ(0u, nBulkCalls);
+   // 999 entries pass the first filter, blocks of 7 entries end with a partial block in every task
+   const auto results = RunBulkGraph(7u, NSLOTS, nBulkCalls);
+   EXPECT_LT(0u, nBulkCalls);
+   ASSERT_EQ(expected.size(), results.size());
+   for (auto i = 0u; i < expected.size(); ++i)
+      EXPECT_DOUBLE_EQ(expected[i], results[i]) << "result " << i;
+}
+
+TEST_P(RDFSimpleTests, BulkSizeFallback)
+{
+   ROOT::RDataFrame df(100);
+   df.SetBulkSize(8);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto nBulk = std::make_shared<unsigned int>(0u);
+   auto counted = d.Book<double>(BulkCountHelper(NSLOTS, nBulk), {"x"});
+   // Take does not support bulk processing: the whole event loop processes one entry at a time
+   auto take = d.Take<double>("x");
+   EXPECT_EQ(100u, *counted);
+   EXPECT_EQ(100u, take->size());
+   EXPECT_EQ(0u, *nBulk);
+
+   // the next event loop has no unsupported action
+   auto f = d.Filter([](double x) { return x < 50.; }, {"x"});
+   auto counted2 = f.Book<double>(BulkCountHelper(NSLOTS, nBulk), {"x"});
+   EXPECT_EQ(50u, *counted2);
+   EXPECT_LT(0u, *nBulk);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -0,0 +1,177 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RVec.hxx"
+#include "TH1D.h"
+#include <TROOT.h>
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+namespace {
+ROOT::RDF::RNode MakeVariedDF(ROOT::RDF::RNode df)
+{
+   return df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+      .Vary("x", [](int x) { return RVec<int>{x - 1, x + 1}; }, {"x"}, {"down", "up"});
+}
+} // anonymous namespace
+
+TEST(RDFVary, SimpleSum)
+{
+   ROOT::RDataFrame df(10);
+   auto sum = MakeVariedDF(df).Sum<int>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:down", "x:up"}));
+   EXPECT_EQ(sums["nominal"], 45);
+   EXPECT_EQ(sums["x:down"], 35);
+   EXPECT_EQ(sums["x:up"], 55);
+   EXPECT_EQ(*sum, 45);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+   EXPECT_THROW(sums["x:sideways"], std::runtime_error);
+}
+
+TEST(RDFVary, FilterAndDefine)
+{
+   ROOT::RDataFrame df(10);
+   auto filtered = MakeVariedDF(df)
+                      .Filter([](int x) { return x > 5; }, {"x"})
+                      .Define("y", [](int x) { return 2 * x; }, {"x"});
+   auto counts = VariationsFor(filtered.Count());
+   auto sums = VariationsFor(filtered.Sum<int>("y"));
+
+   EXPECT_EQ(counts["nominal"], 4ull);
+   EXPECT_EQ(counts["x:down"], 3ull);
+   EXPECT_EQ(counts["x:up"], 5ull);
+   EXPECT_EQ(sums["nominal"], 60);
+   EXPECT_EQ(sums["x:down"], 42);
+   EXPECT_EQ(sums["x:up"], 80);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+}
+
+TEST(RDFVary, JittedFilter)
+{
+   ROOT::RDataFrame df(10);
+   auto sums = VariationsFor(MakeVariedDF(df).Filter("x > 5").Sum<int>("x"));
+
+   EXPECT_EQ(sums["nominal"], 30);
+   EXPECT_EQ(sums["x:down"], 21);
+   EXPECT_EQ(sums["x:up"], 40);
+}
+
+TEST(RDFVary, Histo1D)
+{
+   ROOT::RDataFrame df(10);
+   auto filtered = MakeVariedDF(df).Filter([](int x) { return x >= 0; }, {"x"});
+   auto hs = VariationsFor(filtered.Histo1D<int>({"h", "h", 20, -5, 15}, "x"));
+   auto hsNoModel = VariationsFor(filtered.Histo1D<int>("x"));
+
+   EXPECT_EQ(hs["nominal"].GetEntries(), 10);
+   EXPECT_EQ(hs["x:down"].GetEntries(), 9);
+   EXPECT_EQ(hs["x:up"].GetEntries(), 10);
+   EXPECT_DOUBLE_EQ(hs["nominal"].GetMean(), 4.5);
+   EXPECT_DOUBLE_EQ(hs["x:down"].GetMean(), 4.);
+   EXPECT_DOUBLE_EQ(hs["x:up"].GetMean(), 5.5);
+   EXPECT_EQ(hsNoModel["nominal"].GetEntries(), 10);
+   EXPECT_EQ(hsNoModel["x:down"].GetEntries(), 9);
+   EXPECT_EQ(hsNoModel["x:up"].GetEntries(), 10);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+}
+
+TEST(RDFVary, OnlyDependentNodesAreVaried)
+{
+   ROOT::RDataFrame df(10);
+   unsigned int nCalls = 0u;
+   auto sums = VariationsFor(MakeVariedDF(df)
+                                .Define("w",
+                                        [&nCalls](ULong64_t e) {
+                                           ++nCalls;
+                                           return e;
+                                        },
+                                        {"rdfentry_"})
+                                .Filter([](int x) { return x > 5; }, {"x"})
+                                .Sum<ULong64_t>("w"));
+
+   EXPECT_EQ(sums["nominal"], 30ull);
+   EXPECT_EQ(sums["x:down"], 24ull);
+   EXPECT_EQ(sums["x:up"], 35ull);
+   // "w" does not depend on "x": it is evaluated once per entry that passes any of the varied selections
+   EXPECT_EQ(nCalls, 5u);
+}
+
+TEST(RDFVary, MultipleColumns)
+{
+   ROOT::RDataFrame df(4);
+   auto sums = VariationsFor(MakeVariedDF(df)
+                                .Define("y", [](int x) { return 10 * x; }, {"x"})
+                                .Vary("y", [](int y) { return RVec<int>{y + 1, y + 2}; }, {"y"}, 2, "yshift")
+                                .Define("z", [](int x, int y) { return x + y; }, {"x", "y"})
+                                .Sum<int>("z"));
+
+   // the variations of "x" propagate to "y", which is defined in terms of "x",
+   // while the variations of "y" are computed from the nominal values
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:down", "x:up", "yshift:0", "yshift:1"}));
+   EXPECT_EQ(sums["nominal"], 66);
+   EXPECT_EQ(sums["x:down"], 22);
+   EXPECT_EQ(sums["x:up"], 110);
+   EXPECT_EQ(sums["yshift:0"], 70);
+   EXPECT_EQ(sums["yshift:1"], 74);
+}
+
+TEST(RDFVary, NoVariations)
+{
+   ROOT::RDataFrame df(10);
+   auto counts = VariationsFor(MakeVariedDF(df).Count());
+
+   EXPECT_EQ(counts.GetKeys(), std::vector<std::string>({"nominal"}));
+   EXPECT_EQ(counts["nominal"], 10ull);
+}
+
+TEST(RDFVary, Errors)
+{
+   ROOT::RDataFrame df(10);
+   auto varied = MakeVariedDF(df);
+
+   // a variation with the same name for the same column
+   EXPECT_THROW(varied.Vary("x", [](int x) { return RVec<int>{x}; }, {"x"}, {"other"}, "x"), std::runtime_error);
+
+   // wrong number of varied values
+   ROOT::RDataFrame df2(10);
+   auto sums = VariationsFor(
+      df2.Define("x", [] { return 1; }).Vary("x", [] { return RVec<int>{0}; }, {}, {"down", "up"}).Sum<int>("x"));
+   EXPECT_THROW(sums["x:up"], std::runtime_error);
+
+   // variations are not supported downstream of Range
+   auto count = varied.Filter([](int x) { return x > 5; }, {"x"}).Range(2).Count();
+   EXPECT_THROW(VariationsFor(count), std::runtime_error);
+
+   // VariationsFor must be called before the event loop
+   auto sum = varied.Sum<int>("x");
+   EXPECT_EQ(*sum, 45);
+   EXPECT_THROW(VariationsFor(sum), std::logic_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFVary, MT)
+{
+   ROOT::EnableImplicitMT(4);
+   {
+      ROOT::RDataFrame df(1000);
+      auto filtered = MakeVariedDF(df).Filter([](int x) { return x % 2 == 0; }, {"x"});
+      auto counts = VariationsFor(filtered.Count());
+      auto sums = VariationsFor(filtered.Sum<int>("x"));
+
+      EXPECT_EQ(counts["nominal"], 500ull);
+      EXPECT_EQ(counts["x:down"], 500ull);
+      EXPECT_EQ(counts["x:up"], 500ull);
+      EXPECT_EQ(sums["nominal"], 249500);
+      EXPECT_EQ(sums["x:down"], 249500);
+      EXPECT_EQ(sums["x:up"], 250500);
+   }
+   ROOT::DisableImplicitMT();
+}
+#endif
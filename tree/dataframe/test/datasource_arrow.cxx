@@ -12,6 +12,11 @@
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/testing/gtest_util.h>
+#include <arrow/util/config.h>
+#if ARROW_VERSION_MAJOR >= 2
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#endif
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif
@@ -203,6 +208,49 @@ TEST(RArrowDS, FromARDFWithJitting)
    EXPECT_EQ(40, *min);
 }
 
+#if ARROW_VERSION_MAJOR >= 2
+TEST(RArrowDS, FromIPCFile)
+{
+   const std::string fileName = "RArrowDS_test_ipc.arrow";
+   {
+      auto table = createTestTable();
+      ASSERT_OK_AND_ASSIGN(auto sink, arrow::io::FileOutputStream::Open(fileName));
+      ASSERT_OK_AND_ASSIGN(auto writer, arrow::ipc::MakeFileWriter(sink, table->schema()));
+      ASSERT_OK(writer->WriteTable(*table, /*max_chunksize=*/4));
+      ASSERT_OK(writer->Close());
+      ASSERT_OK(sink->Close());
+   }
+
+   // one entry range per record batch, the batches are read one per slot at a time
+   RArrowDS tds(fileName, {});
+   tds.SetNSlots(1);
+   auto ages1 = tds.GetColumnReaders<Long64_t>("Age");
+   tds.Initialise();
+   auto ranges = tds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(4U, ranges[0].second);
+   tds.InitSlot(0, 0);
+   tds.SetEntry(0, 3);
+   EXPECT_EQ(30, **ages1[0]);
+   ranges = tds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(4U, ranges[0].first);
+   EXPECT_EQ(6U, ranges[0].second);
+   tds.InitSlot(0, 4);
+   tds.SetEntry(0, 5);
+   EXPECT_EQ(0, **ages1[0]);
+   EXPECT_TRUE(tds.GetEntryRanges().empty());
+
+   auto rdf = MakeArrowDataFrame(fileName, {"Age", "Name"});
+   auto ages = rdf.Take<Long64_t>("Age");
+   auto names = rdf.Take<std::string>("Name");
+   EXPECT_EQ((std::vector<Long64_t>{64, 50, 40, 30, 2, 0}), *ages);
+   EXPECT_EQ("\"Joe\"", names->at(2));
+   EXPECT_EQ(" Mary Ann ", names->at(5));
+}
+#endif
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
@@ -2,9 +2,11 @@
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <iostream>
 
 using namespace ROOT::RDF;
@@ -320,6 +322,39 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ParallelParsingMT)
+{
+   // a file larger than the blocks RCsvDS reads it in, so that lines straddle the blocks
+   const auto fileName = "RCsvDS_test_parallel.csv";
+   const auto nLines = 200000LL;
+   {
+      std::ofstream f(fileName);
+      f << "Index,Half,Name\n";
+      for (auto i = 0LL; i < nLines; ++i) {
+         f << i << ',' << i / 2. << ",entry" << i << '\n';
+         if (i % 1000 == 0)
+            f << '\n'; // empty lines are skipped
+      }
+   }
+
+   for (auto chunkSize : {-1LL, 12345LL}) {
+      auto df = ROOT::RDF::MakeCsvDataFrame(fileName, true, ',', chunkSize);
+      auto c = df.Count();
+      auto sumIndex = df.Sum<Long64_t>("Index");
+      auto sumHalf = df.Sum<double>("Half");
+      auto nMatchingNames =
+         df.Filter([](Long64_t i, const std::string &n) { return n == "entry" + std::to_string(i); }, {"Index", "Name"})
+            .Count();
+
+      EXPECT_EQ(ULong64_t(nLines), *c);
+      EXPECT_EQ(nLines * (nLines - 1) / 2, *sumIndex);
+      EXPECT_DOUBLE_EQ(nLines * (nLines - 1) / 4., *sumHalf);
+      EXPECT_EQ(ULong64_t(nLines), *nMatchingNames);
+   }
+
+   gSystem->Unlink(fileName);
+}
+
 #endif // R__USE_IMT
 
 #endif // R__B64
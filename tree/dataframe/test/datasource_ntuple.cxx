@@ -5,6 +5,8 @@
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <TSystem.h>
+
 #include <gtest/gtest.h>
 
 using ROOT::Experimental::RNTupleDS;
@@ -98,3 +100,63 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+void SnapshotTest(unsigned int nEntries)
+{
+   const auto fname = "RNTupleDS_test_snapshot.root";
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+
+   ROOT::RDataFrame df(nEntries);
+   auto out = df.Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                 .Define("v", [](float x) { return ROOT::RVec<float>{x, 2 * x}; }, {"x"})
+                 .Define("s", [](float x) { return std::to_string(int(x)); }, {"x"})
+                 .Filter([](float x) { return x > 0; }, {"x"})
+                 .Snapshot<float, ROOT::RVec<float>, std::string>("ntuple", fname, {"x", "v", "s"}, opts);
+
+   auto outdf = *out;
+   EXPECT_EQ(outdf.GetColumnType("x"), "float");
+   EXPECT_EQ(*outdf.Count(), nEntries - 1);
+   const auto expectedSum = float(nEntries * (nEntries - 1) / 2);
+   EXPECT_FLOAT_EQ(*outdf.Sum<float>("x"), expectedSum);
+   auto sumv = outdf.Define("sv", [](const ROOT::RVec<float> &v) { return ROOT::VecOps::Sum(v); }, {"v"}).Sum("sv");
+   EXPECT_FLOAT_EQ(*sumv, 3 * expectedSum);
+   auto check =
+      outdf.Filter([](float x, const std::string &s) { return s == std::to_string(int(x)); }, {"x", "s"}).Count();
+   EXPECT_EQ(*check, nEntries - 1);
+
+   // the output is a regular RNTuple, also when the slots write through the shared sink
+   auto readback = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fname);
+   EXPECT_EQ(*readback.Count(), nEntries - 1);
+   // the value ranges of the clusters are recorded, so that a cluster filter can skip all of them
+   auto pruned = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fname, {{"x", double(nEntries), 2. * nEntries}});
+   EXPECT_EQ(*pruned.Count(), 0u);
+
+   gSystem->Unlink(fname);
+}
+
+TEST(RNTupleDSSnapshot, Snapshot)
+{
+   SnapshotTest(100);
+}
+
+TEST(RNTupleDSSnapshot, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotTest(10000);
+}
+
+TEST(RNTupleDSSnapshot, Errors)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   ROOT::RDataFrame df(1);
+   auto dd = df.Define("x", [] { return 1.f; });
+
+   opts.fMode = "UPDATE";
+   EXPECT_THROW(dd.Snapshot<float>("ntuple", "RNTupleDS_test_snapshot_err.root", {"x"}, opts), std::invalid_argument);
+   opts.fMode = "RECREATE";
+   EXPECT_THROW(dd.Snapshot<float>("dir/ntuple", "RNTupleDS_test_snapshot_err.root", {"x"}, opts),
+                std::invalid_argument);
+}
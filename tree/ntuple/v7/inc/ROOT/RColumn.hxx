@@ -178,6 +178,30 @@ public:
          (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
    }
 
+   /// Maps the page that contains globalIndex and returns the element at globalIndex.  Sets nItems to the number of
+   /// consecutive elements, starting at globalIndex, that are available in the mapped page.
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(globalIndex)) {
+         MapPage(globalIndex);
+      }
+      nItems = fCurrentPage.GetGlobalRangeLast() - globalIndex + 1;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+         (globalIndex - fCurrentPage.GetGlobalRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(clusterIndex)) {
+         MapPage(clusterIndex);
+      }
+      nItems = fCurrentPage.GetClusterRangeLast() - clusterIndex.GetIndex() + 1;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+         (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fCurrentPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -207,6 +231,32 @@ public:
       *collectionStart = RClusterIndex(fCurrentPage.GetClusterInfo().GetId(), idxStart);
    }
 
+   /// For offset columns only, get the coordinates of the collections of the nEntries entries starting at globalIndex.
+   /// The entries must be on the same page.  Unlike GetCollectionInfo(), the page that contains the entries remains
+   /// the current page, so that the elements returned by MapV() stay valid.
+   void GetCollectionInfo(const NTupleSize_t globalIndex, const NTupleSize_t nEntries,
+                          RClusterIndex *collectionStart, ClusterSize_t *collectionSize)
+   {
+      R__ASSERT(nEntries > 0);
+      auto idxEnd = *Map<ClusterSize_t, EColumnType::kIndex>(globalIndex + nEntries - 1);
+      R__ASSERT(fCurrentPage.Contains(globalIndex));
+      ClusterSize_t idxStart(0);
+      if (globalIndex > fCurrentPage.GetClusterInfo().GetIndexOffset()) {
+         if (fCurrentPage.Contains(globalIndex - 1)) {
+            idxStart = *Map<ClusterSize_t, EColumnType::kIndex>(globalIndex - 1);
+         } else {
+            // The previous offset is on the previous page, which is read without replacing the current page
+            auto page = fPageSource->PopulatePage(fHandleSource, globalIndex - 1);
+            idxStart = *reinterpret_cast<ClusterSize_t *>(
+               static_cast<unsigned char *>(page.GetBuffer()) +
+               (globalIndex - 1 - page.GetGlobalRangeFirst()) * RColumnElement<ClusterSize_t, EColumnType::kIndex>::kSize);
+            fPageSource->ReleasePage(page);
+         }
+      }
+      *collectionSize = idxEnd - idxStart;
+      *collectionStart = RClusterIndex(fCurrentPage.GetClusterInfo().GetId(), idxStart);
+   }
+
    void GetCollectionInfo(const RClusterIndex &clusterIndex,
                           RClusterIndex *collectionStart, ClusterSize_t *collectionSize)
    {
@@ -49,6 +49,15 @@ enum class EColumnType {
    kInt64,
    kInt32,
    kInt16,
+   // The split types store the same values as their plain counterparts but the bytes of the elements of a page are
+   // reordered (byte stream split) such that the first bytes of all elements come first, then the second bytes etc.
+   // Index columns are additionally delta encoded, signed integer columns are zigzag encoded.  That makes pages
+   // compress considerably better.
+   kSplitIndex,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
 };
 
 // clang-format off
@@ -484,6 +484,12 @@ public:
    ClusterSize_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<ClusterSize_t, EColumnType::kIndex>(clusterIndex);
    }
+   ClusterSize_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(globalIndex, nItems);
+   }
+   ClusterSize_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -504,6 +510,10 @@ public:
    void GetCollectionInfo(NTupleSize_t globalIndex, RClusterIndex *collectionStart, ClusterSize_t *size) {
       fPrincipalColumn->GetCollectionInfo(globalIndex, collectionStart, size);
    }
+   void GetCollectionInfo(NTupleSize_t globalIndex, NTupleSize_t nEntries, RClusterIndex *collectionStart,
+                          ClusterSize_t *size) {
+      fPrincipalColumn->GetCollectionInfo(globalIndex, nEntries, collectionStart, size);
+   }
    void GetCollectionInfo(const RClusterIndex &clusterIndex, RClusterIndex *collectionStart, ClusterSize_t *size) {
       fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
    }
@@ -532,6 +542,12 @@ public:
    bool *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<bool, EColumnType::kBit>(clusterIndex);
    }
+   bool *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(globalIndex, nItems);
+   }
+   bool *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -571,6 +587,12 @@ public:
    float *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<float, EColumnType::kReal32>(clusterIndex);
    }
+   float *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(globalIndex, nItems);
+   }
+   float *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -611,6 +633,12 @@ public:
    double *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<double, EColumnType::kReal64>(clusterIndex);
    }
+   double *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(globalIndex, nItems);
+   }
+   double *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -650,6 +678,12 @@ public:
    std::uint8_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint8_t, EColumnType::kByte>(clusterIndex);
    }
+   std::uint8_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(globalIndex, nItems);
+   }
+   std::uint8_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -689,6 +723,12 @@ public:
    std::int32_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::int32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::int32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::int32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -728,6 +768,12 @@ public:
    std::uint32_t *Map(const RClusterIndex clusterIndex) {
       return fPrincipalColumn->Map<std::uint32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::uint32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::uint32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -767,6 +813,12 @@ public:
    std::uint64_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint64_t, EColumnType::kInt64>(clusterIndex);
    }
+   std::uint64_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(globalIndex, nItems);
+   }
+   std::uint64_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
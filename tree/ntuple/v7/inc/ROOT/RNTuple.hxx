@@ -205,14 +205,21 @@ An output ntuple can be filled with entries. The caller has to make sure that th
 is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
 writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
 triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+
+Clusters are committed automatically every RNTupleWriteOptions::kDefaultClusterSizeEntries entries or, if set in
+the write options, once their estimated compressed size reaches the target cluster size.  Calling CommitCluster()
+explicitly yields smaller clusters.
 */
 // clang-format on
 class RNTupleWriter {
 private:
-   static constexpr NTupleSize_t kDefaultClusterSizeEntries = 64000;
+   /// Set as the page sink's scheduler for parallel page compression if IMT is on
+   /// Needs to be destructed after the page sink is destructed and so declared before
+   RNTupleImtTaskScheduler fZipTasks;
    std::unique_ptr<Detail::RPageSink> fSink;
    /// Needs to be destructed before fSink
    std::unique_ptr<RNTupleModel> fModel;
+   /// Number of entries per cluster if clusters are not sized by bytes, zero otherwise
    NTupleSize_t fClusterSizeEntries;
    NTupleSize_t fLastCommitted;
    NTupleSize_t fNEntries;
@@ -240,7 +247,7 @@ public:
          value.GetField()->Append(value);
       }
       fNEntries++;
-      if ((fNEntries % fClusterSizeEntries) == 0)
+      if (fSink->IsClusterFull() || (fClusterSizeEntries > 0 && fNEntries - fLastCommitted >= fClusterSizeEntries))
          CommitCluster();
    }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
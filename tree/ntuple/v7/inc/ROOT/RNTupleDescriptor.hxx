@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <vector>
@@ -178,9 +179,6 @@ public:
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
 
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
-
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
                 fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
@@ -191,6 +189,25 @@ public:
       }
    };
 
+   /// Optional summary of the values of a particular column in a particular cluster.  For index columns, i.e.
+   /// the principal columns of collections, the minimum and maximum refer to the collection sizes.  Integer values
+   /// beyond 2^53 are rounded outwards, so that the interval [fMin, fMax] always covers all the values.  NaN values
+   /// are not taken into account.
+   struct RColumnStatistics {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      double fMin = std::numeric_limits<double>::infinity();
+      double fMax = -std::numeric_limits<double>::infinity();
+
+      bool operator==(const RColumnStatistics &other) const {
+         return fColumnId == other.fColumnId && fMin == other.fMin && fMax == other.fMax;
+      }
+
+      /// True if no value has been recorded
+      bool IsEmpty() const { return fMin > fMax; }
+      /// True if the cluster may contain a value in the closed interval [min, max]
+      bool Overlaps(double min, double max) const { return !IsEmpty() && (fMin <= max) && (fMax >= min); }
+   };
+
    /// Records the parition of data into pages for a particular column in a particular cluster
    struct RPageRange {
       /// We do not need to store the element size / uncompressed page size because we know to which column
@@ -232,6 +249,8 @@ private:
 
    std::unordered_map<DescriptorId_t, RColumnRange> fColumnRanges;
    std::unordered_map<DescriptorId_t, RPageRange> fPageRanges;
+   /// Only present for columns for which the writer recorded statistics
+   std::unordered_map<DescriptorId_t, RColumnStatistics> fColumnStatistics;
 
 public:
    /// In order to handle changes to the serialization routine in future ntuple versions
@@ -253,6 +272,10 @@ public:
    RLocator GetLocator() const { return fLocator; }
    const RColumnRange &GetColumnRange(DescriptorId_t columnId) const { return fColumnRanges.at(columnId); }
    const RPageRange &GetPageRange(DescriptorId_t columnId) const { return fPageRanges.at(columnId); }
+   bool HasColumnStatistics(DescriptorId_t columnId) const { return fColumnStatistics.count(columnId) > 0; }
+   const RColumnStatistics &GetColumnStatistics(DescriptorId_t columnId) const {
+      return fColumnStatistics.at(columnId);
+   }
 };
 
 
@@ -641,6 +664,7 @@ public:
    void SetClusterLocator(DescriptorId_t clusterId, RClusterDescriptor::RLocator locator);
    void AddClusterColumnRange(DescriptorId_t clusterId, const RClusterDescriptor::RColumnRange &columnRange);
    void AddClusterPageRange(DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange);
+   void AddClusterColumnStatistics(DescriptorId_t clusterId, const RClusterDescriptor::RColumnStatistics &statistics);
 
    void AddClustersFromFooter(void* footerBuffer);
 };
@@ -19,6 +19,10 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +42,44 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of several ntuples with the same schema
+
+The merger does not read the data field by field. Instead, it copies the sealed pages of the inputs, i.e. the
+packed and compressed pages as they are stored, into the destination. Pages are copied verbatim if the compression
+setting of the input column matches the compression of the destination; otherwise they are decompressed and
+recompressed but still not unpacked. Every input cluster becomes a cluster in the destination.
+
+All the inputs must have the same fields and the same on-storage column types as the destination, which is
+created from the schema of the first input. The write options of the destination must therefore use the same
+column encodings as the inputs (e.g., split encoding). A schema mismatch throws an RException.
+
+The inputs are streamed cluster by cluster: every cluster is committed to the destination as soon as it is loaded
+and released right after. With more than one parallel input and implicit multi-threading enabled, the next few inputs
+are attached and have their next cluster read and, if necessary, recompressed by tasks of the IMT pool while the
+current cluster is written. At most one cluster per input in flight is kept in memory besides the one being written.
+Without IMT, the inputs are merged sequentially.
+
+If the destination records column statistics, the statistics of the input clusters are carried over.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// The maximum number of inputs that are read concurrently; one means sequential merging
+   unsigned int fNParallelInputs = 1;
+
+public:
+   explicit RNTupleMerger(unsigned int nParallelInputs = 1);
+
+   /// Appends the entries of the sources to the destination in the order of the sources. The sources must not be
+   /// attached and the destination must not be created yet.  Every source is released as soon as its pages are
+   /// written; the data set of the destination is committed at the end.
+   void Merge(std::vector<std::unique_ptr<Detail::RPageSource>> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -28,6 +28,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -273,6 +274,28 @@ using RNTuplePlainTimer = RNTupleTimer<RNTuplePlainCounter, RNTupleTickCounter<R
 using RNTupleAtomicTimer = RNTupleTimer<RNTupleAtomicCounter, RNTupleTickCounter<RNTupleAtomicCounter>>;
 
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleTraceEvent
+\ingroup NTuple
+\brief A time interval of an activity, such as reading or unzipping a batch of clusters, on a given thread
+
+Trace events complement the counters, which only sum up durations.  They show when an activity happened and on which
+thread, e.g. to see whether I/O and decompression overlap.
+*/
+// clang-format on
+struct RNTupleTraceEvent {
+   std::string fName;
+   /// Free-form details, e.g. the ids of the clusters involved
+   std::string fDetail;
+   /// Small integer that identifies the recording thread; threads are numbered in the order of their first event
+   int fThreadId = 0;
+   /// Microseconds since the first recorded event of the process
+   std::int64_t fStartUs = 0;
+   std::int64_t fDurationUs = 0;
+};
+
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RNTupleMetrics
@@ -280,6 +303,9 @@ using RNTupleAtomicTimer = RNTupleTimer<RNTupleAtomicCounter, RNTupleTickCounter
 \brief A collection of Counter objects with a name, a unit, and a description.
 
 The class owns the counters; on registration of a new
+
+Enabled metrics also record trace events.  The counters and the events can be exported as JSON and the events
+in the Chrome trace event format, which can be viewed with chrome://tracing or Perfetto.
 */
 // clang-format on
 class RNTupleMetrics {
@@ -287,12 +313,28 @@ private:
    /// Symbol to split metrics name from counter / sub metrics name
    static constexpr char kNamespaceSeperator = '.';
 
+public:
+   /// Default number of trace events kept by a metrics object, see SetMaxEvents()
+   static constexpr std::size_t kDefaultMaxEvents = 100000;
+
+private:
+
    std::vector<std::unique_ptr<RNTuplePerfCounter>> fCounters;
    std::vector<RNTupleMetrics *> fObservedMetrics;
    std::string fName;
    bool fIsEnabled = false;
+   /// Events can be recorded concurrently, e.g. by the I/O and the unzip threads of a cluster pool
+   std::unique_ptr<std::mutex> fLockEvents = std::make_unique<std::mutex>();
+   /// Ring buffer of the most recent events; once full, fNextEvent points to the oldest event
+   std::vector<RNTupleTraceEvent> fEvents;
+   std::size_t fNextEvent = 0;
+   std::size_t fMaxEvents = kDefaultMaxEvents;
+   std::uint64_t fNDroppedEvents = 0;
 
    bool Contains(const std::string &name) const;
+   void PrintJSONImpl(std::ostream &output, const std::string &indent) const;
+   void CollectEvents(const std::string &prefix,
+                      std::vector<std::pair<std::string, RNTupleTraceEvent>> &events) const;
 
 public:
    explicit RNTupleMetrics(const std::string &name) : fName(name) {}
@@ -319,8 +361,52 @@ public:
    void ObserveMetrics(RNTupleMetrics &observee);
 
    void Print(std::ostream &output, const std::string &prefix = "") const;
+   /// Writes the counters and the trace events of this and of the observed metrics as a JSON object
+   void PrintJSON(std::ostream &output) const;
+   /// Writes the trace events of this and of the observed metrics in the Chrome trace event format; the event
+   /// category is the name of the recording metrics
+   void PrintTraceEvents(std::ostream &output) const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
+
+   /// Thread-safe; ignored if the metrics are disabled.  Once the maximum number of events is reached, every new
+   /// event replaces the oldest one.
+   void RecordEvent(const RNTupleTraceEvent &event);
+   /// Returns the kept events, oldest first
+   std::vector<RNTupleTraceEvent> GetEvents() const;
+   /// Sets the number of events kept, which bounds the memory used by tracing; zero discards all events
+   void SetMaxEvents(std::size_t maxEvents);
+   std::size_t GetMaxEvents() const { return fMaxEvents; }
+   /// The number of events that were discarded because the maximum number of events was reached
+   std::uint64_t GetNDroppedEvents() const;
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleTraceScope
+\ingroup NTuple
+\brief Records a trace event for the time between construction and destruction
+
+Like RNTupleTimer, the scope does nothing if the metrics are disabled when it is opened.
+*/
+// clang-format on
+class RNTupleTraceScope {
+private:
+   RNTupleMetrics &fMetrics;
+   /// Whether the metrics were enabled when the scope was opened; scopes opened before are never recorded
+   bool fIsActive;
+   RNTupleTraceEvent fEvent;
+   std::chrono::steady_clock::time_point fStartTime;
+
+public:
+   RNTupleTraceScope(RNTupleMetrics &metrics, const std::string &name);
+   ~RNTupleTraceScope();
+   RNTupleTraceScope(const RNTupleTraceScope &other) = delete;
+   RNTupleTraceScope &operator =(const RNTupleTraceScope &other) = delete;
+
+   bool IsActive() const { return fIsActive; }
+   void SetDetail(const std::string &detail) { fEvent.fDetail = detail; }
 };
 
 } // namespace Detail
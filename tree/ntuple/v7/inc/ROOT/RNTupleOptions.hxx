@@ -18,6 +18,8 @@
 
 #include <Compression.h>
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -44,8 +46,24 @@ All page sink classes need to support the common options.
 */
 // clang-format on
 class RNTupleWriteOptions {
+public:
+  /// By default, pages hold a fixed number of elements and clusters a fixed number of entries; the byte-based
+  /// sizes below are opt-in.  Sensible values are e.g. 64kB pages, 50MB zipped clusters, and 512MB at most unzipped.
+  static constexpr std::size_t kDefaultElementsPerPage = 10000;
+  static constexpr std::size_t kDefaultClusterSizeEntries = 64000;
+  static constexpr std::size_t kDefaultApproxUnzippedPageSize = 0;
+  static constexpr std::size_t kDefaultApproxZippedClusterSize = 0;
+  static constexpr std::size_t kDefaultMaxUnzippedClusterSize = 0;
+
+private:
   int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
   ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
+  bool fUseSplitEncoding{false};
+  bool fUseReal16{false};
+  bool fUseColumnStatistics{false};
+  std::size_t fApproxUnzippedPageSize{kDefaultApproxUnzippedPageSize};
+  std::size_t fApproxZippedClusterSize{kDefaultApproxZippedClusterSize};
+  std::size_t fMaxUnzippedClusterSize{kDefaultMaxUnzippedClusterSize};
 
 public:
   int GetCompression() const { return fCompression; }
@@ -56,6 +74,31 @@ public:
 
   ENTupleContainerFormat GetContainerFormat() const { return fContainerFormat; }
   void SetContainerFormat(ENTupleContainerFormat val) { fContainerFormat = val; }
+
+  /// If set, index, integer, and floating point columns are stored with the split column types (e.g.
+  /// EColumnType::kSplitIndex), which encode pages before they are compressed
+  bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+  void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+  /// If set, float columns are stored as EColumnType::kReal16, i.e. in IEEE half precision.  Lossy!
+  bool GetUseReal16() const { return fUseReal16; }
+  void SetUseReal16(bool val) { fUseReal16 = val; }
+  /// If set, the minimum and maximum value of the numerical and index columns are recorded per cluster
+  /// (see RClusterDescriptor::RColumnStatistics).  Readers can use them to skip clusters.
+  bool GetUseColumnStatistics() const { return fUseColumnStatistics; }
+  void SetUseColumnStatistics(bool val) { fUseColumnStatistics = val; }
+  /// If set, pages are sized such that their packed, uncompressed size is approximately the given number of bytes,
+  /// independent of the element size of the column.  Zero (the default) uses kDefaultElementsPerPage elements.
+  std::size_t GetApproxUnzippedPageSize() const { return fApproxUnzippedPageSize; }
+  void SetApproxUnzippedPageSize(std::size_t val) { fApproxUnzippedPageSize = val; }
+  /// If set, the writer commits a cluster when its compressed size is estimated to reach the given number of bytes.
+  /// The estimate uses the compression factor of the previous cluster.  Zero (the default) commits a cluster every
+  /// kDefaultClusterSizeEntries entries.
+  std::size_t GetApproxZippedClusterSize() const { return fApproxZippedClusterSize; }
+  void SetApproxZippedClusterSize(std::size_t val) { fApproxZippedClusterSize = val; }
+  /// If set, the writer also commits a cluster when its uncompressed size reaches the given number of bytes.  This
+  /// bounds the memory used for buffering pages during writing.  Zero (the default) means no limit.
+  std::size_t GetMaxUnzippedClusterSize() const { return fMaxUnzippedClusterSize; }
+  void SetMaxUnzippedClusterSize(std::size_t val) { fMaxUnzippedClusterSize = val; }
 };
 
 
@@ -76,12 +119,20 @@ public:
       kDefault = kOn,
    };
 
+   /// Number of clusters held in memory by the cluster cache, including the currently used cluster
+   static constexpr unsigned int kDefaultClusterCacheSize = 4;
+
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
+   unsigned int fClusterCacheSize = kDefaultClusterCacheSize;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+   /// The cluster cache size determines how many clusters are read and decompressed ahead of the currently used
+   /// cluster, and thus bounds the memory used for preloaded pages.  Zero, like one, disables the look-ahead.
+   unsigned int GetClusterCacheSize() const { return fClusterCacheSize; }
+   void SetClusterCacheSize(unsigned int val) { fClusterCacheSize = val; }
 };
 
 } // namespace Experimental
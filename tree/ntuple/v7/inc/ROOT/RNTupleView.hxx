@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -145,7 +147,10 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields,
+MapV() gives zero-copy access to a contiguous batch of values, which is useful for processing a column in batches,
+e.g. with vectorized kernels.  For collections, the batch of the collection's offsets together with the batch of the
+item values of the corresponding cluster range describe the collections of several entries.
 */
 // clang-format on
 template <typename T>
@@ -197,6 +202,25 @@ public:
       fField.Read(clusterIndex, &fValue);
       return *fValue.Get<T>();
    }
+
+   /// Returns the values from globalIndex to at most globalIndex + maxSize without copying them.  The returned
+   /// span ends at the latest at the end of the page that contains globalIndex, so it may be shorter than requested.
+   /// The span is valid until the view is used to access another page.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapV(NTupleSize_t globalIndex, NTupleSize_t maxSize) {
+      NTupleSize_t nItems;
+      const C *values = fField.MapV(globalIndex, nItems);
+      return std::span<const C>(values, std::min(nItems, maxSize));
+   }
+
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapV(const RClusterIndex &clusterIndex, NTupleSize_t maxSize) {
+      NTupleSize_t nItems;
+      const C *values = fField.MapV(clusterIndex, nItems);
+      return std::span<const C>(values, std::min(nItems, maxSize));
+   }
 };
 
 
@@ -205,6 +229,9 @@ public:
 \class ROOT::Experimental::RNTupleViewCollection
 \ingroup NTuple
 \brief A view for a collection, that can itself generate new ntuple views for its nested fields.
+
+MapV() on a collection view maps the collection offsets: the offset of an entry is the cluster-local index one past
+the last item of its collection.
 */
 // clang-format on
 class RNTupleViewCollection : public RNTupleView<ClusterSize_t> {
@@ -234,6 +261,16 @@ public:
       return RNTupleClusterRange(collectionStart.GetClusterId(), collectionStart.GetIndex(),
                                  collectionStart.GetIndex() + size);
    }
+   /// Returns the cluster-local range of the items of the collections of the nEntries entries starting at
+   /// globalIndex, e.g. of a batch of offsets from MapV().  The entries must be on the same page, which is the case
+   /// for a batch from MapV(); the batch remains valid.
+   RNTupleClusterRange GetCollectionRange(NTupleSize_t globalIndex, NTupleSize_t nEntries) {
+      ClusterSize_t size;
+      RClusterIndex collectionStart;
+      fField.GetCollectionInfo(globalIndex, nEntries, &collectionStart, &size);
+      return RNTupleClusterRange(collectionStart.GetClusterId(), collectionStart.GetIndex(),
+                                 collectionStart.GetIndex() + size);
+   }
    RNTupleClusterRange GetCollectionRange(const RClusterIndex &clusterIndex) {
       ClusterSize_t size;
       RClusterIndex collectionStart;
@@ -96,12 +96,20 @@ public:
    /// Returns the size of the compressed data block. The data is written into the zip buffer.
    /// This works only for small input buffer up to 16MB
    size_t operator() (const void *from, size_t nbytes, int compression) {
+      return Zip(from, nbytes, compression, fZipBuffer->data());
+   }
+
+   /// Returns the size of the compressed data block. The data is written into the provided buffer, which needs to
+   /// have room for at least nbytes. Does not use the zip buffer and can thus be used concurrently, e.g. from
+   /// parallel page compression tasks. Works only for small input buffers up to 16MB.
+   static size_t Zip(const void *from, size_t nbytes, int compression, void *to) {
       R__ASSERT(from != nullptr);
+      R__ASSERT(to != nullptr);
       R__ASSERT(nbytes <= kMAXZIPBUF);
 
       auto cxLevel = compression % 100;
       if (cxLevel == 0) {
-         memcpy(fZipBuffer->data(), from, nbytes);
+         memcpy(to, from, nbytes);
          return nbytes;
       }
 
@@ -109,14 +117,14 @@ public:
       int szSource = nbytes;
       char *source = const_cast<char *>(static_cast<const char *>(from));
       int szTarget = nbytes;
-      char *target = reinterpret_cast<char *>(fZipBuffer->data());
+      char *target = static_cast<char *>(to);
       int szOut = 0;
       R__zipMultipleAlgorithm(cxLevel, &szSource, source, &szTarget, target, &szOut, cxAlgorithm);
       R__ASSERT(szOut >= 0);
       if ((szOut > 0) && (static_cast<unsigned int>(szOut) < nbytes))
          return szOut;
 
-      memcpy(fZipBuffer->data(), from, nbytes);
+      memcpy(to, from, nbytes);
       return nbytes;
    }
 
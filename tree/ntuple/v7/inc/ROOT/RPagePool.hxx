@@ -75,6 +75,9 @@ public:
    /// this page. If the reference counter drops to zero, the page pool might decide to call the deleter given in
    /// during registration.
    void ReturnPage(const RPage &page);
+   /// Frees the preloaded pages of the given cluster that have not been requested (reference counter is zero).
+   /// Pages in use remain in the pool until they are returned.
+   void Evict(DescriptorId_t clusterId);
 };
 
 } // namespace Detail
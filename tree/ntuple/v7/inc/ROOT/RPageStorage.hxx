@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorage
 #define ROOT7_RPageStorage
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -28,6 +29,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -74,6 +76,11 @@ public:
 protected:
    std::string fNTupleName;
    RTaskScheduler *fTaskScheduler = nullptr;
+   /// Elements of the on-storage column types, used to pack and unpack pages.  Created once per column when the
+   /// column is added.  Indexed by column id.
+   std::vector<std::unique_ptr<RColumnElementBase>> fOnStorageElements;
+
+   void AddOnStorageElement(DescriptorId_t columnId, EColumnType type);
 
 public:
    explicit RPageStorage(std::string_view name);
@@ -83,6 +90,9 @@ public:
    RPageStorage& operator =(RPageStorage &&other) = default;
    virtual ~RPageStorage();
 
+   /// The element of the on-storage type of a column that has been added to the page storage
+   RColumnElementBase *GetOnStorageElement(DescriptorId_t columnId) const { return fOnStorageElements[columnId].get(); }
+
    /// Whether the concrete implementation is a sink or a source
    virtual EPageStorageType GetType() = 0;
 
@@ -126,6 +136,22 @@ up to the given entry number are committed.
 */
 // clang-format on
 class RPageSink : public RPageStorage {
+public:
+   /// A page as it is stored, i.e. packed and compressed according to the on-storage column type and the compression
+   /// setting of the sink.  Sealed pages can be copied from a page source without unpacking and decompression,
+   /// e.g. for merging ntuples.  The buffer is owned by the caller.
+   struct RSealedPage {
+      const void *fBuffer = nullptr;
+      std::uint32_t fSize = 0;
+      std::uint32_t fNElements = 0;
+      /// Optionally, a value range that covers the elements of the page, e.g. the column statistics of the cluster
+      /// the page was taken from.  Not owned.
+      const RClusterDescriptor::RColumnStatistics *fStatistics = nullptr;
+
+      RSealedPage() = default;
+      RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
+   };
+
 protected:
    RNTupleWriteOptions fOptions;
 
@@ -139,10 +165,28 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// If enabled in the write options, keeps track of the value range of the columns in the currently open cluster.
+   /// Indexed by column id.
+   std::vector<RClusterDescriptor::RColumnStatistics> fOpenColumnStatistics;
+   /// For index columns, the last index value of the currently open cluster; used to calculate collection sizes
+   std::vector<ClusterSize_t::ValueType> fOpenLastIndexes;
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   /// Sum of the in-memory sizes of the pages committed to the currently open cluster
+   std::uint64_t fOpenClusterUnzippedBytes = 0;
+   /// Uncompressed size at which the open cluster is considered full, derived from the write options and the
+   /// compression factor of the last cluster
+   std::uint64_t fOpenClusterUnzippedLimit = 0;
+
+   void UpdateColumnStatistics(ColumnHandle_t columnHandle, const RPage &page);
+   /// The uncompressed size at which the open cluster is full, given the compression factor of the last cluster
+   std::uint64_t GetUnzippedClusterLimit(double compressionFactor) const;
+   /// The number of elements of a page whose packed size is approximately the page size of the write options
+   std::size_t GetDefaultNElementsPerPage(ColumnHandle_t columnHandle) const;
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
    virtual RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
+   /// Page sinks that can store sealed pages override this method; by default, an RException is thrown
+   virtual RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage);
    virtual RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) = 0;
    virtual void CommitDatasetImpl() = 0;
 
@@ -159,9 +203,16 @@ public:
    static std::unique_ptr<RPageSink> Create(std::string_view ntupleName, std::string_view location,
                                             const RNTupleWriteOptions &options = RNTupleWriteOptions());
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
+   const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
+   /// The descriptor is built while writing; it is complete only after the data set has been committed
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
+   /// The column type on storage can differ from the in-memory column type, depending on the write options.  For
+   /// instance, with split encoding, a kReal32 column is written as a kSplitReal32 column.  The in-memory and on-storage
+   /// column types share the same C++ representation.  The column elements of the on-storage type pack and unpack pages.
+   RColumnModel GetColumnModelOnStorage(const RColumnModel &model) const;
 
    /// Physically creates the storage container to hold the ntuple (e.g., a keys a TFile or an S3 bucket)
    /// To do so, Create() calls CreateImpl() after updating the descriptor.
@@ -169,8 +220,15 @@ public:
    void Create(RNTupleModel &model);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
+   /// Write a page that is already packed and compressed.  If column statistics are enabled, the statistics of the
+   /// open cluster are widened by the value range of the sealed page; without a value range, the column statistics
+   /// of the open cluster cover all values.
+   void CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
+   /// Whether the currently open cluster reached the byte-based cluster size of the write options, if set.  Pages
+   /// that are still being filled by the columns are not taken into account.
+   bool IsClusterFull() const { return fOpenClusterUnzippedBytes >= fOpenClusterUnzippedLimit; }
    /// Finalize the current cluster and the entrire data set.
    void CommitDataset() { CommitDatasetImpl(); }
 
@@ -193,6 +251,14 @@ class RPageSource : public RPageStorage {
 public:
    /// Derived from the model (fields) that are actually being requested at a given point in time
    using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+   /// Identifies a (partial) cluster to be loaded: the cluster id and the set of requested columns
+   struct RClusterKey {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      ColumnSet_t fColumnSet;
+      RClusterKey() = default;
+      RClusterKey(DescriptorId_t clusterId, const ColumnSet_t &columnSet)
+         : fClusterId(clusterId), fColumnSet(columnSet) {}
+   };
 
 protected:
    RNTupleReadOptions fOptions;
@@ -242,6 +308,10 @@ public:
    /// LoadCluster() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+   /// Populates several (partial) clusters in one go; the returned clusters are in the order of the keys.
+   /// The default implementation calls LoadCluster() for every key.  Page sources should override it if they
+   /// can fetch the pages of all the clusters with a single vector read, which keeps the storage queue filled.
+   virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RClusterKey> &clusterKeys);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
@@ -249,6 +319,10 @@ public:
    /// actual implementation will only run if a task scheduler is set. In practice, a task scheduler is set
    /// if implicit multi-threading is turned on.
    void UnzipCluster(RCluster *cluster);
+   /// Called by the cluster pool when a cluster is dropped from the pool.  Page sources that preload unzipped pages
+   /// release the ones of the given cluster that have not been used so far, which bounds the memory held by
+   /// preloaded pages to the size of the cluster pool.  No-op by default.
+   virtual void EvictCluster(DescriptorId_t /* clusterId */) {}
 };
 
 } // namespace Detail
@@ -20,22 +20,21 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <array>
 #include <cstdio>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class TFile;
 
 namespace ROOT {
 
-namespace Internal {
-class RRawFile;
-}
-
 namespace Experimental {
 namespace Detail {
 
@@ -54,9 +53,6 @@ The written file can be either in ROOT format or in RNTuple bare format.
 */
 // clang-format on
 class RPageSinkFile : public RPageSink {
-public:
-   static constexpr std::size_t kDefaultElementsPerPage = 10000;
-
 private:
    RNTupleMetrics fMetrics;
    std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
@@ -69,9 +65,29 @@ private:
    /// Helper for zipping keys and header / footer; comprises a 16MB zip buffer
    RNTupleCompressor fCompressor;
 
+   /// A committed page of the currently open cluster whose compression is scheduled on the task scheduler
+   struct RPendingPage {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      /// Index of the page in the open page range of its column
+      std::size_t fPageIdx = 0;
+      std::size_t fPackedBytes = 0;
+      std::size_t fZippedBytes = 0;
+      /// The packed page; released by the compression task once the zipped copy is available
+      std::unique_ptr<unsigned char[]> fBuffer;
+      std::unique_ptr<unsigned char[]> fZipBuffer;
+   };
+   /// If a task scheduler is set, pages are compressed in parallel and written in order when the cluster is
+   /// committed. A deque keeps the page addresses stable while compression tasks are running.
+   std::deque<RPendingPage> fPendingPages;
+
+   RClusterDescriptor::RLocator WriteSealedPage(const unsigned char *buffer, std::size_t zippedBytes,
+                                                std::size_t packedBytes);
+   void SchedulePage(ColumnHandle_t columnHandle, const RPage &page);
+
 protected:
    void CreateImpl(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
    RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
    void CommitDatasetImpl() final;
 
@@ -162,6 +178,11 @@ private:
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Allocates the memory of the on-disk pages of the given cluster and columns and appends the corresponding
+   /// read requests to readRequests.  This way, the requests of several clusters can be sent to the storage
+   /// in a single RRawFile::ReadV() call.
+   std::unique_ptr<RCluster> PrepareSingleCluster(const RClusterKey &clusterKey,
+                                                  std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -184,6 +205,8 @@ public:
    void ReleasePage(RPage &page) final;
 
    std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RClusterKey> &clusterKeys) final;
+   void EvictCluster(DescriptorId_t clusterId) final;
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
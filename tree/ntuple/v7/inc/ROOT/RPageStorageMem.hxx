@@ -0,0 +1,162 @@
+/// \file ROOT/RPageStorageMem.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageStorageMem
+#define ROOT7_RPageStorageMem
+
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RPageAllocatorHeap;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleArena
+\ingroup NTuple
+\brief Heap-backed container for the pages and the meta-data of ntuples written by an RPageSinkMem
+
+An arena can hold several ntuples, identified by their name. An ntuple becomes visible to page sources only once
+its page sink committed the data set. Pages are stored uncompressed and unpacked, i.e. in their in-memory layout,
+so that an RPageSourceMem can map them without any copy.
+*/
+// clang-format on
+class RNTupleArena {
+public:
+   /// The serialized header and footer and the pages of a single ntuple. The page locators in the footer
+   /// refer to the index of the page in fPages.
+   struct RNTupleData {
+      std::unique_ptr<unsigned char[]> fHeader;
+      std::size_t fSzHeader = 0;
+      std::unique_ptr<unsigned char[]> fFooter;
+      std::size_t fSzFooter = 0;
+      std::vector<std::unique_ptr<unsigned char[]>> fPages;
+   };
+
+private:
+   mutable std::mutex fLock;
+   std::unordered_map<std::string, std::shared_ptr<const RNTupleData>> fNTuples;
+
+public:
+   RNTupleArena() = default;
+   RNTupleArena(const RNTupleArena &other) = delete;
+   RNTupleArena &operator =(const RNTupleArena &other) = delete;
+   ~RNTupleArena() = default;
+
+   /// Makes the data available under the given name; replaces an existing ntuple of the same name. Page sources
+   /// that are attached to the replaced ntuple keep their data alive.
+   void Publish(std::string_view ntupleName, std::unique_ptr<RNTupleData> data);
+   /// Returns nullptr if no ntuple with the given name has been committed
+   std::shared_ptr<const RNTupleData> Get(std::string_view ntupleName) const;
+   /// Returns false if no ntuple with the given name exists
+   bool Erase(std::string_view ntupleName);
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkMem
+\ingroup NTuple
+\brief Storage provider that writes ntuple pages into an in-memory arena
+
+Pages are neither packed nor compressed; the compression setting of the write options is ignored.
+*/
+// clang-format on
+class RPageSinkMem : public RPageSink {
+private:
+   std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   std::shared_ptr<RNTupleArena> fArena;
+   /// Filled while writing and handed over to the arena in CommitDataset()
+   std::unique_ptr<RNTupleArena::RNTupleData> fData;
+   /// Index of the first page of the current cluster
+   std::uint64_t fClusterFirstPage = 0;
+   /// Sum of the page sizes of the current cluster
+   std::uint64_t fClusterSize = 0;
+
+protected:
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   void CommitDatasetImpl() final;
+
+public:
+   RPageSinkMem(std::string_view ntupleName, std::shared_ptr<RNTupleArena> arena,
+                const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RPageSinkMem(const RPageSinkMem&) = delete;
+   RPageSinkMem& operator=(const RPageSinkMem&) = delete;
+   RPageSinkMem(RPageSinkMem&&) = default;
+   RPageSinkMem& operator=(RPageSinkMem&&) = default;
+   virtual ~RPageSinkMem();
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSourceMem
+\ingroup NTuple
+\brief Storage provider that reads ntuple pages from an in-memory arena
+
+Populated pages point directly into the arena. Therefore, the arena must outlive the page source, which is ensured
+by the shared ownership of the arena.
+*/
+// clang-format on
+class RPageSourceMem : public RPageSource {
+private:
+   std::shared_ptr<RNTupleArena> fArena;
+   /// Set on Attach(); keeps the ntuple's data alive even if it is replaced in the arena
+   std::shared_ptr<const RNTupleArena::RNTupleData> fData;
+
+   RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
+                                 ClusterSize_t::ValueType idxInCluster);
+
+protected:
+   RNTupleDescriptor AttachImpl() final;
+
+public:
+   RPageSourceMem(std::string_view ntupleName, std::shared_ptr<RNTupleArena> arena,
+                  const RNTupleReadOptions &options = RNTupleReadOptions());
+   std::unique_ptr<RPageSource> Clone() const final;
+
+   RPageSourceMem(const RPageSourceMem&) = delete;
+   RPageSourceMem& operator=(const RPageSourceMem&) = delete;
+   RPageSourceMem(RPageSourceMem&&) = default;
+   RPageSourceMem& operator=(RPageSourceMem&&) = default;
+   virtual ~RPageSourceMem();
+
+   RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
+   RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
+   void ReleasePage(RPage &page) final;
+
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+};
+
+} // namespace Detail
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -15,6 +15,7 @@
 
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
 #include <TError.h>
@@ -28,6 +29,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <utility>
 
 bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(const RInFlightCluster &other) const
@@ -49,13 +51,13 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
 
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int size)
    : fPageSource(pageSource)
-   , fPool(size)
+   // A size of zero means no look-ahead: the pool only holds the current cluster
+   , fPool(std::max(size, 1u))
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
-   R__ASSERT(size > 0);
    fWindowPre = 0;
-   fWindowPost = size;
+   fWindowPost = fPool.size();
    // Large pools maintain a small look-back window together with the large look-ahead window
    while ((1u << fWindowPre) < (fWindowPost - (fWindowPre + 1))) {
       fWindowPre++;
@@ -99,7 +101,12 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          if (!item.fCluster)
             return;
 
-         fPageSource.UnzipCluster(item.fCluster.get());
+         {
+            RNTupleTraceScope traceScope(fPageSource.GetMetrics(), "unzip");
+            if (traceScope.IsActive())
+               traceScope.SetDetail("cluster " + std::to_string(item.fCluster->GetId()));
+            fPageSource.UnzipCluster(item.fCluster.get());
+         }
 
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
          item.fPromise.set_value(std::move(item.fCluster));
@@ -120,12 +127,34 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
          }
       }
 
-      for (auto &item : readItems) {
-         if (item.fClusterId == kInvalidDescriptorId)
-            return;
+      // All the clusters of the work queue are loaded in one go, which lets the page source issue the
+      // reads of all their pages at once.  The empty item used to stop the thread is always the last one.
+      const bool isShutdown = !readItems.empty() && (readItems.back().fClusterId == kInvalidDescriptorId);
+      if (isShutdown) {
+         // The pool is being destructed: nobody waits for the remaining clusters, so don't read them
+         for (auto &item : readItems)
+            item.fPromise.set_value(nullptr);
+         return;
+      }
+
+      std::vector<RPageSource::RClusterKey> clusterKeys;
+      for (const auto &item : readItems)
+         clusterKeys.emplace_back(item.fClusterId, item.fColumns);
+      std::vector<std::unique_ptr<RCluster>> clusters;
+      if (!clusterKeys.empty()) {
+         RNTupleTraceScope traceScope(fPageSource.GetMetrics(), "read");
+         if (traceScope.IsActive()) {
+            std::string detail = "clusters";
+            for (const auto &key : clusterKeys)
+               detail += " " + std::to_string(key.fClusterId);
+            traceScope.SetDetail(detail);
+         }
+         clusters = fPageSource.LoadClusters(clusterKeys);
+      }
 
-         // TODO(jblomer): the page source needs to be capable of loading multiple clusters in one go
-         auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+      for (std::size_t i = 0; i < readItems.size(); ++i) {
+         auto &item = readItems[i];
+         auto &cluster = clusters[i];
 
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -254,6 +283,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          continue;
       if (keep.count(cptr->GetId()) > 0)
          continue;
+      fPageSource.EvictCluster(cptr->GetId());
       cptr.reset();
    }
 
@@ -280,6 +310,9 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          auto cptr = itr->fFuture.get();
          // If cptr is nullptr, the cluster expired previously and was released by the I/O thread
          if (!cptr || itr->fIsExpired) {
+            // The unzip thread may have preloaded pages of the expired cluster
+            if (cptr && !FindInPool(cptr->GetId()))
+               fPageSource.EvictCluster(cptr->GetId());
             cptr.reset();
             itr = fInFlightClusters.erase(itr);
             continue;
@@ -20,9 +20,141 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Stores the encoded elements of src such that byte b of element i ends up at dst[b * count + i]
+template <typename T, typename EncodeFuncT>
+void SplitPack(void *dst, const void *src, std::size_t count, EncodeFuncT encode)
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   auto valueArray = reinterpret_cast<const T *>(src);
+   for (std::size_t i = 0; i < count; ++i) {
+      const T value = encode(valueArray, i);
+      unsigned char bytes[sizeof(T)];
+      memcpy(bytes, &value, sizeof(T));
+      for (std::size_t b = 0; b < sizeof(T); ++b)
+         splitArray[b * count + i] = bytes[b];
+   }
+}
+
+/// Inverse of SplitPack(); the decode function receives the already restored elements before index i
+template <typename T, typename DecodeFuncT>
+void SplitUnpack(void *dst, const void *src, std::size_t count, DecodeFuncT decode)
+{
+   auto valueArray = reinterpret_cast<T *>(dst);
+   auto splitArray = reinterpret_cast<const unsigned char *>(src);
+   for (std::size_t i = 0; i < count; ++i) {
+      unsigned char bytes[sizeof(T)];
+      for (std::size_t b = 0; b < sizeof(T); ++b)
+         bytes[b] = splitArray[b * count + i];
+      T value;
+      memcpy(&value, bytes, sizeof(T));
+      valueArray[i] = decode(valueArray, i, value);
+   }
+}
+
+template <typename T>
+T EncodeIdentity(const T *values, std::size_t i)
+{
+   return values[i];
+}
+
+template <typename T>
+T DecodeIdentity(const T * /* values */, std::size_t /* i */, T value)
+{
+   return value;
+}
+
+/// Maps signed integers of small magnitude to small unsigned integers: 0, -1, 1, -2, 2, ... --> 0, 1, 2, 3, 4, ...
+template <typename T>
+T EncodeZigzag(const T *values, std::size_t i)
+{
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   const auto value = values[i];
+   return static_cast<T>((static_cast<UnsignedT>(value) << 1) ^ static_cast<UnsignedT>(value >> (sizeof(T) * 8 - 1)));
+}
+
+template <typename T>
+T DecodeZigzag(const T * /* values */, std::size_t /* i */, T value)
+{
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   const auto encoded = static_cast<UnsignedT>(value);
+   return static_cast<T>((encoded >> 1) ^ (~(encoded & 1) + 1));
+}
+
+/// Converts a float to IEEE 754 half precision, rounding to nearest even
+std::uint16_t FloatToHalf(float value)
+{
+   std::uint32_t bits;
+   memcpy(&bits, &value, sizeof(bits));
+   const std::uint16_t sign = (bits >> 16) & 0x8000;
+   const std::uint32_t absBits = bits & 0x7fffffff;
+
+   if (absBits >= 0x7f800000) {
+      // Infinity stays infinity, NaN stays NaN
+      return sign | 0x7c00 | ((absBits > 0x7f800000) ? 0x0200 : 0);
+   }
+
+   if (absBits < 0x38800000) {
+      // Below the smallest normal half precision number 2^-14: subnormal or zero
+      if (absBits < 0x33000000)
+         return sign;
+      const std::uint32_t mantissa = (absBits & 0x7fffff) | 0x800000;
+      const std::uint32_t shift = 126 - (absBits >> 23);
+      std::uint32_t halfMantissa = mantissa >> shift;
+      const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+      const std::uint32_t halfway = 1u << (shift - 1);
+      if ((remainder > halfway) || ((remainder == halfway) && (halfMantissa & 1)))
+         ++halfMantissa;
+      return sign | halfMantissa;
+   }
+
+   // Rebias the exponent from 127 to 15 and cut the mantissa from 23 to 10 bits; the rounding carry can propagate
+   // into the exponent
+   std::uint32_t halfBits = (absBits >> 13) - ((127 - 15) << 10);
+   const std::uint32_t remainder = absBits & 0x1fff;
+   if ((remainder > 0x1000) || ((remainder == 0x1000) && (halfBits & 1)))
+      ++halfBits;
+   if (halfBits >= 0x7c00)
+      return sign | 0x7c00;
+   return sign | halfBits;
+}
+
+float HalfToFloat(std::uint16_t half)
+{
+   const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000) << 16;
+   const std::uint32_t exponent = (half >> 10) & 0x1f;
+   std::uint32_t mantissa = half & 0x3ff;
+
+   std::uint32_t bits;
+   if (exponent == 0x1f) {
+      bits = sign | 0x7f800000 | (mantissa << 13);
+   } else if (exponent != 0) {
+      bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+   } else if (mantissa == 0) {
+      bits = sign;
+   } else {
+      // Subnormal half precision numbers are normal single precision numbers
+      std::uint32_t shift = 0;
+      while ((mantissa & 0x400) == 0) {
+         mantissa <<= 1;
+         ++shift;
+      }
+      bits = sign | ((113 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+   }
+
+   float result;
+   memcpy(&result, &bits, sizeof(result));
+   return result;
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -42,6 +174,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kReal16:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal16>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -67,6 +211,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kReal16:
+      return 16;
+   case EColumnType::kSplitIndex:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
    default:
       R__ASSERT(false);
    }
@@ -107,3 +263,94 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
       }
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<
+   ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   // Index values are monotonically increasing within a cluster; the first element of the page is stored as is
+   SplitPack<ClusterSize_t::ValueType>(dst, src, count, [](const ClusterSize_t::ValueType *values, std::size_t i) {
+      return (i == 0) ? values[0] : values[i] - values[i - 1];
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<
+   ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<ClusterSize_t::ValueType>(dst, src, count,
+      [](const ClusterSize_t::ValueType *values, std::size_t i, ClusterSize_t::ValueType delta) {
+         return (i == 0) ? delta : values[i - 1] + delta;
+      });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<double>(dst, src, count, EncodeIdentity<double>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<double>(dst, src, count, DecodeIdentity<double>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<float>(dst, src, count, EncodeIdentity<float>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<float>(dst, src, count, DecodeIdentity<float>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::int64_t>(dst, src, count, EncodeZigzag<std::int64_t>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::int64_t>(dst, src, count, DecodeZigzag<std::int64_t>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::int32_t>(dst, src, count, EncodeZigzag<std::int32_t>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::int32_t>(dst, src, count, DecodeZigzag<std::int32_t>);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   float *floatArray = reinterpret_cast<float *>(src);
+   unsigned char *halfArray = reinterpret_cast<unsigned char *>(dst);
+   for (std::size_t i = 0; i < count; ++i) {
+      const auto half = FloatToHalf(floatArray[i]);
+      memcpy(halfArray + i * sizeof(half), &half, sizeof(half));
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   float *floatArray = reinterpret_cast<float *>(dst);
+   unsigned char *halfArray = reinterpret_cast<unsigned char *>(src);
+   for (std::size_t i = 0; i < count; ++i) {
+      std::uint16_t half;
+      memcpy(&half, halfArray + i * sizeof(half), sizeof(half));
+      floatArray[i] = HalfToFloat(half);
+   }
+}
@@ -246,10 +246,17 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
    : fSink(std::move(sink))
    , fModel(std::move(model))
-   , fClusterSizeEntries(kDefaultClusterSizeEntries)
+   , fClusterSizeEntries(fSink->GetWriteOptions().GetApproxZippedClusterSize() > 0
+                            ? 0
+                            : RNTupleWriteOptions::kDefaultClusterSizeEntries)
    , fLastCommitted(0)
    , fNEntries(0)
 {
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      fSink->SetTaskScheduler(&fZipTasks);
+   }
+#endif
    fSink->Create(*fModel.get());
 }
 
@@ -143,6 +143,21 @@ std::uint32_t DeserializeUInt16(const void *buffer, std::uint16_t *val)
    return DeserializeInt16(buffer, reinterpret_cast<std::int16_t *>(val));
 }
 
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
 std::uint32_t SerializeClusterSize(ROOT::Experimental::ClusterSize_t val, void *buffer)
 {
    return SerializeUInt32(val, buffer);
@@ -446,7 +461,10 @@ std::uint32_t SerializeColumn(const ROOT::Experimental::RColumnDescriptor &val,
    return size;
 }
 
-std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescriptor &val, void *buffer)
+/// The statistics of the given columns are appended to the summary
+std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescriptor &val,
+                                      const std::vector<ROOT::Experimental::DescriptorId_t> &statisticsColumnIds,
+                                      void *buffer)
 {
    auto base = reinterpret_cast<unsigned char *>((buffer != nullptr) ? buffer : 0);
    auto pos = base;
@@ -462,6 +480,16 @@ std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescript
    pos += SerializeUInt64(val.GetNEntries(), *where);
    pos += SerializeLocator(val.GetLocator(), *where);
 
+   // The column statistics have been appended to the cluster summary frame; readers that do not know about them
+   // skip them as part of the frame
+   pos += SerializeUInt32(statisticsColumnIds.size(), *where);
+   for (auto columnId : statisticsColumnIds) {
+      const auto &statistics = val.GetColumnStatistics(columnId);
+      pos += SerializeUInt64(columnId, *where);
+      pos += SerializeDouble(statistics.fMin, *where);
+      pos += SerializeDouble(statistics.fMax, *where);
+   }
+
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
    return size;
@@ -525,7 +553,8 @@ bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor
           fNEntries == other.fNEntries &&
           fLocator == other.fLocator &&
           fColumnRanges == other.fColumnRanges &&
-          fPageRanges == other.fPageRanges;
+          fPageRanges == other.fPageRanges &&
+          fColumnStatistics == other.fColumnStatistics;
 }
 
 
@@ -598,7 +627,12 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
    pos += SerializeUInt64(fClusterDescriptors.size(), *where);
    for (const auto& cluster : fClusterDescriptors) {
       pos += SerializeUuid(fOwnUuid, *where); // in order to verify that header and footer belong together
-      pos += SerializeClusterSummary(cluster.second, *where);
+      std::vector<DescriptorId_t> statisticsColumnIds;
+      for (const auto &column : fColumnDescriptors) {
+         if (cluster.second.HasColumnStatistics(column.first))
+            statisticsColumnIds.emplace_back(column.first);
+      }
+      pos += SerializeClusterSummary(cluster.second, statisticsColumnIds, *where);
 
       pos += SerializeUInt32(fColumnDescriptors.size(), *where);
       for (const auto& column : fColumnDescriptors) {
@@ -900,6 +934,20 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
       RClusterDescriptor::RLocator locator;
       pos += DeserializeLocator(pos, &locator);
       SetClusterLocator(clusterId, locator);
+      // Column statistics are optional; older writers did not store them
+      if (pos < clusterBase + frameSize) {
+         std::uint32_t nStatistics;
+         pos += DeserializeUInt32(pos, &nStatistics);
+         for (std::uint32_t j = 0; j < nStatistics; ++j) {
+            RClusterDescriptor::RColumnStatistics statistics;
+            std::uint64_t columnId;
+            pos += DeserializeUInt64(pos, &columnId);
+            statistics.fColumnId = columnId;
+            pos += DeserializeDouble(pos, &statistics.fMin);
+            pos += DeserializeDouble(pos, &statistics.fMax);
+            AddClusterColumnStatistics(clusterId, statistics);
+         }
+      }
 
       pos = clusterBase + frameSize;
 
@@ -1043,6 +1091,12 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterColumnRange(
    fDescriptor.fClusterDescriptors[clusterId].fColumnRanges[columnRange.fColumnId] = columnRange;
 }
 
+void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterColumnStatistics(
+   DescriptorId_t clusterId, const RClusterDescriptor::RColumnStatistics &statistics)
+{
+   fDescriptor.fClusterDescriptors[clusterId].fColumnStatistics[statistics.fColumnId] = statistics;
+}
+
 void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterPageRange(
    DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange)
 {
@@ -88,6 +88,18 @@ static std::string GetColumnTypeName(ROOT::Experimental::EColumnType type)
       return "Index";
    case ROOT::Experimental::EColumnType::kSwitch:
       return "Switch";
+   case ROOT::Experimental::EColumnType::kReal16:
+      return "Real16";
+   case ROOT::Experimental::EColumnType::kSplitIndex:
+      return "SplitIndex";
+   case ROOT::Experimental::EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case ROOT::Experimental::EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case ROOT::Experimental::EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case ROOT::Experimental::EColumnType::kSplitInt32:
+      return "SplitInt32";
    default:
       return "UNKNOWN";
    }
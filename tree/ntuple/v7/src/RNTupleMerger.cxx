@@ -13,11 +13,28 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <string>
+#include <utility>
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
@@ -37,3 +54,282 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RNTupleDescriptor;
+using ROOT::Experimental::Detail::RCluster;
+using ROOT::Experimental::Detail::RPageSink;
+using ROOT::Experimental::Detail::RPageSource;
+
+/// The schema of a column of the destination, against which the input columns are matched
+struct RColumnSchema {
+   std::string fQualifiedFieldName;
+   std::string fFieldTypeName;
+   std::uint32_t fIndex = 0;
+   ROOT::Experimental::RColumnModel fModel;
+};
+
+/// A cluster of an input whose pages are ready to be written to the destination
+struct RMergeCluster {
+   NTupleSize_t fNEntries = 0;
+   /// Owns the on-disk pages to which the sealed pages refer
+   std::unique_ptr<RCluster> fCluster;
+   /// Owns the recompressed pages
+   std::vector<std::unique_ptr<unsigned char[]>> fBuffers;
+   /// The sealed pages, indexed by the column id of the destination
+   std::vector<std::vector<RPageSink::RSealedPage>> fSealedPages;
+};
+
+/// Returns the column ids of the source in the order of the destination column ids; throws if the schemas differ
+std::vector<DescriptorId_t> MapColumns(const RNTupleDescriptor &desc, const std::vector<RColumnSchema> &schema)
+{
+   if (desc.GetNColumns() != schema.size())
+      throw ROOT::Experimental::RException(R__FAIL("cannot merge ntuple '" + desc.GetName() + "': number of columns " +
+                                                   "does not match"));
+
+   std::vector<DescriptorId_t> columnIds;
+   for (const auto &columnSchema : schema) {
+      auto columnId = ROOT::Experimental::kInvalidDescriptorId;
+      for (std::size_t i = 0; i < desc.GetNColumns(); ++i) {
+         const auto &columnDesc = desc.GetColumnDescriptor(i);
+         if (columnDesc.GetIndex() != columnSchema.fIndex)
+            continue;
+         if (desc.GetQualifiedFieldName(columnDesc.GetFieldId()) != columnSchema.fQualifiedFieldName)
+            continue;
+         if (desc.GetFieldDescriptor(columnDesc.GetFieldId()).GetTypeName() != columnSchema.fFieldTypeName ||
+             !(columnDesc.GetModel() == columnSchema.fModel)) {
+            throw ROOT::Experimental::RException(R__FAIL("cannot merge ntuple '" + desc.GetName() + "': field '" +
+                                                         columnSchema.fQualifiedFieldName + "' has a different " +
+                                                         "type or column encoding"));
+         }
+         columnId = columnDesc.GetId();
+         break;
+      }
+      if (columnId == ROOT::Experimental::kInvalidDescriptorId) {
+         throw ROOT::Experimental::RException(R__FAIL("cannot merge ntuple '" + desc.GetName() + "': missing field '" +
+                                                      columnSchema.fQualifiedFieldName + "'"));
+      }
+      columnIds.emplace_back(columnId);
+   }
+   return columnIds;
+}
+
+/// Reads the clusters of an input one at a time, in entry order.  The pages of column ranges whose compression
+/// differs from the destination compression are recompressed.
+class RInputReader {
+private:
+   RPageSource &fSource;
+   bool fIsAttached;
+   const std::vector<RColumnSchema> &fSchema;
+   int fCompression;
+   std::vector<DescriptorId_t> fColumnIds;
+   RPageSource::ColumnSet_t fColumnSet;
+   std::vector<const ROOT::Experimental::RClusterDescriptor *> fClusterDescs;
+   bool fIsInitialized = false;
+   std::size_t fNextCluster = 0;
+   /// Only allocated if any page needs to be recompressed
+   std::unique_ptr<ROOT::Experimental::Detail::RNTupleDecompressor> fDecompressor;
+
+   /// Attaches the source, unless it is already attached, and sorts its clusters by entry index
+   void Init()
+   {
+      if (!fIsAttached)
+         fSource.Attach();
+      fIsAttached = true;
+      fIsInitialized = true;
+      const auto &desc = fSource.GetDescriptor();
+      fColumnIds = MapColumns(desc, fSchema);
+      fColumnSet = RPageSource::ColumnSet_t(fColumnIds.begin(), fColumnIds.end());
+      for (std::size_t i = 0; i < desc.GetNClusters(); ++i)
+         fClusterDescs.emplace_back(&desc.GetClusterDescriptor(i));
+      std::sort(fClusterDescs.begin(), fClusterDescs.end(), [](const auto *a, const auto *b) {
+         return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+      });
+   }
+
+public:
+   RInputReader(RPageSource &source, bool isAttached, const std::vector<RColumnSchema> &schema, int compression)
+      : fSource(source), fIsAttached(isAttached), fSchema(schema), fCompression(compression)
+   {
+   }
+
+   /// Loads the next cluster; returns nullptr once all the clusters are read.  The first call attaches the source.
+   std::unique_ptr<RMergeCluster> LoadNext()
+   {
+      if (!fIsInitialized)
+         Init();
+      if (fNextCluster == fClusterDescs.size())
+         return nullptr;
+
+      const auto &clusterDesc = *fClusterDescs[fNextCluster++];
+      auto mergeCluster = std::make_unique<RMergeCluster>();
+      mergeCluster->fNEntries = clusterDesc.GetNEntries();
+      mergeCluster->fSealedPages.resize(fColumnIds.size());
+      mergeCluster->fCluster = fSource.LoadCluster(clusterDesc.GetId(), fColumnSet);
+
+      for (std::size_t c = 0; c < fColumnIds.size(); ++c) {
+         const auto columnId = fColumnIds[c];
+         const bool isRecompressed = clusterDesc.GetColumnRange(columnId).fCompressionSettings != fCompression;
+         // The value range of the input cluster carries over to the destination cluster
+         const auto statistics =
+            clusterDesc.HasColumnStatistics(columnId) ? &clusterDesc.GetColumnStatistics(columnId) : nullptr;
+         auto element = ROOT::Experimental::Detail::RColumnElementBase::Generate(fSchema[c].fModel.GetType());
+
+         std::uint64_t pageNo = 0;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+            auto onDiskPage =
+               mergeCluster->fCluster->GetOnDiskPage(ROOT::Experimental::Detail::ROnDiskPage::Key(columnId, pageNo));
+            R__ASSERT(onDiskPage);
+            RPageSink::RSealedPage sealedPage(onDiskPage->GetAddress(), onDiskPage->GetSize(), pageInfo.fNElements);
+            sealedPage.fStatistics = statistics;
+            if (isRecompressed) {
+               if (!fDecompressor)
+                  fDecompressor = std::make_unique<ROOT::Experimental::Detail::RNTupleDecompressor>();
+               const auto packedBytes = (pageInfo.fNElements * element->GetBitsOnStorage() + 7) / 8;
+               auto packedBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+               (*fDecompressor)(onDiskPage->GetAddress(), onDiskPage->GetSize(), packedBytes, packedBuffer.get());
+               auto zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+               sealedPage.fSize = ROOT::Experimental::Detail::RNTupleCompressor::Zip(packedBuffer.get(), packedBytes,
+                                                                                     fCompression, zipBuffer.get());
+               sealedPage.fBuffer = zipBuffer.get();
+               mergeCluster->fBuffers.emplace_back(std::move(zipBuffer));
+            }
+            mergeCluster->fSealedPages[c].emplace_back(sealedPage);
+            ++pageNo;
+         }
+      }
+      return mergeCluster;
+   }
+};
+
+/// An input being read while the previous inputs are written
+struct RInputInFlight {
+   std::size_t fIdx = 0;
+   std::unique_ptr<RInputReader> fReader;
+   /// The cluster loaded by the task, and the exception thrown while loading it, if any
+   std::unique_ptr<RMergeCluster> fNext;
+   std::exception_ptr fError;
+#ifdef R__USE_IMT
+   /// Runs the loading of the next cluster in the IMT pool; declared last such that it is waited for first
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> fTask;
+#endif
+
+   /// Starts loading the next cluster, in the IMT pool if isParallel is set and synchronously otherwise
+   void StartLoadNext(bool isParallel)
+   {
+      auto fnLoadNext = [this]() {
+         try {
+            fNext = fReader->LoadNext();
+         } catch (...) {
+            fError = std::current_exception();
+         }
+      };
+#ifdef R__USE_IMT
+      if (isParallel) {
+         if (!fTask)
+            fTask = std::make_unique<ROOT::Experimental::TTaskGroup>();
+         fTask->Run(fnLoadNext);
+         return;
+      }
+#else
+      (void)isParallel;
+#endif
+      fnLoadNext();
+   }
+
+   /// Waits for the cluster started by StartLoadNext(); returns nullptr once all the clusters are read
+   std::unique_ptr<RMergeCluster> GetNext()
+   {
+#ifdef R__USE_IMT
+      if (fTask)
+         fTask->Wait();
+#endif
+      if (fError)
+         std::rethrow_exception(fError);
+      return std::move(fNext);
+   }
+};
+
+} // anonymous namespace
+
+
+ROOT::Experimental::RNTupleMerger::RNTupleMerger(unsigned int nParallelInputs)
+   : fNParallelInputs(std::max(1U, nParallelInputs))
+{
+}
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::vector<std::unique_ptr<Detail::RPageSource>> sources,
+                                              Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no input ntuples to merge"));
+
+   // The destination is created from the schema of the first input
+   sources[0]->Attach();
+   auto model = sources[0]->GetDescriptor().GenerateModel();
+   destination.Create(*model);
+
+   // Taken as a copy of the destination meta-data because the descriptor of the destination keeps changing
+   // while the input loading tasks use the schema
+   std::vector<RColumnSchema> schema;
+   const auto &destinationDesc = destination.GetDescriptor();
+   for (std::size_t i = 0; i < destinationDesc.GetNColumns(); ++i) {
+      const auto &columnDesc = destinationDesc.GetColumnDescriptor(i);
+      RColumnSchema columnSchema;
+      columnSchema.fQualifiedFieldName = destinationDesc.GetQualifiedFieldName(columnDesc.GetFieldId());
+      columnSchema.fFieldTypeName = destinationDesc.GetFieldDescriptor(columnDesc.GetFieldId()).GetTypeName();
+      columnSchema.fIndex = columnDesc.GetIndex();
+      columnSchema.fModel = columnDesc.GetModel();
+      schema.emplace_back(columnSchema);
+   }
+   const auto compression = destination.GetWriteOptions().GetCompression();
+
+   // With parallel inputs and IMT enabled, every input in flight has its next cluster loaded by a task of the IMT
+   // pool.  Only one cluster per input is kept ahead of the one being written, which bounds the memory usage.
+   bool isParallel = false;
+#ifdef R__USE_IMT
+   isParallel = (fNParallelInputs > 1) && ROOT::IsImplicitMTEnabled();
+#endif
+   const std::size_t nInFlight = isParallel ? fNParallelInputs : 1;
+
+   // Inputs in flight; the front one is written next
+   std::deque<RInputInFlight> inFlight;
+   std::size_t nextInput = 0;
+   NTupleSize_t nEntries = 0;
+   while (nextInput < sources.size() || !inFlight.empty()) {
+      while (nextInput < sources.size() && inFlight.size() < nInFlight) {
+         inFlight.emplace_back();
+         auto &input = inFlight.back();
+         input.fIdx = nextInput;
+         input.fReader = std::make_unique<RInputReader>(*sources[nextInput], nextInput == 0, schema, compression);
+         input.StartLoadNext(isParallel);
+         ++nextInput;
+      }
+
+      // Every cluster is committed as soon as it is loaded, while the next one of the input is loading
+      auto &input = inFlight.front();
+      while (auto mergeCluster = input.GetNext()) {
+         input.StartLoadNext(isParallel);
+         for (std::size_t c = 0; c < mergeCluster->fSealedPages.size(); ++c) {
+            for (const auto &sealedPage : mergeCluster->fSealedPages[c])
+               destination.CommitSealedPage(c, sealedPage);
+         }
+         nEntries += mergeCluster->fNEntries;
+         destination.CommitCluster(nEntries);
+      }
+
+      const auto idx = input.fIdx;
+      inFlight.pop_front();
+      sources[idx].reset();
+   }
+
+   destination.CommitDataset();
+}
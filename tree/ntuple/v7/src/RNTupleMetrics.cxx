@@ -15,10 +15,64 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
 #include <ostream>
 
 #include <iostream>
 
+namespace {
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+std::string CounterValueToJSON(const ROOT::Experimental::Detail::RNTuplePerfCounter &counter)
+{
+   auto calcPerf = dynamic_cast<const ROOT::Experimental::Detail::RNTupleCalcPerf *>(&counter);
+   if (calcPerf == nullptr)
+      return std::to_string(counter.GetValueAsInt());
+   // NaN and infinity are not valid JSON numbers
+   auto value = calcPerf->GetValue();
+   return std::isfinite(value) ? std::to_string(value) : "null";
+}
+
+/// Trace event timestamps are relative to the first use of the epoch
+std::chrono::steady_clock::time_point GetTraceEpoch()
+{
+   static const auto epoch = std::chrono::steady_clock::now();
+   return epoch;
+}
+
+int GetTraceThreadId()
+{
+   static std::atomic<int> gNThreads{0};
+   thread_local int threadId = ++gNThreads;
+   return threadId;
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
 {
 }
@@ -74,6 +128,121 @@ void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, con
    }
 }
 
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSONImpl(std::ostream &output, const std::string &indent) const
+{
+   output << indent << "{" << std::endl;
+   output << indent << "  \"name\": \"" << EscapeJSON(fName) << "\"," << std::endl;
+   output << indent << "  \"enabled\": " << (fIsEnabled ? "true" : "false") << "," << std::endl;
+
+   output << indent << "  \"counters\": [";
+   for (std::size_t i = 0; i < fCounters.size(); ++i) {
+      const auto &c = fCounters[i];
+      output << (i == 0 ? "" : ",") << std::endl << indent << "    {\"name\": \"" << EscapeJSON(c->GetName())
+             << "\", \"unit\": \"" << EscapeJSON(c->GetUnit()) << "\", \"description\": \""
+             << EscapeJSON(c->GetDescription()) << "\", \"value\": " << CounterValueToJSON(*c) << "}";
+   }
+   output << (fCounters.empty() ? "" : "\n" + indent + "  ") << "]," << std::endl;
+
+   const auto events = GetEvents();
+   output << indent << "  \"events\": [";
+   for (std::size_t i = 0; i < events.size(); ++i) {
+      const auto &e = events[i];
+      output << (i == 0 ? "" : ",") << std::endl << indent << "    {\"name\": \"" << EscapeJSON(e.fName)
+             << "\", \"detail\": \"" << EscapeJSON(e.fDetail) << "\", \"tid\": " << e.fThreadId
+             << ", \"ts\": " << e.fStartUs << ", \"dur\": " << e.fDurationUs << "}";
+   }
+   output << (events.empty() ? "" : "\n" + indent + "  ") << "]," << std::endl;
+
+   output << indent << "  \"metrics\": [";
+   for (std::size_t i = 0; i < fObservedMetrics.size(); ++i) {
+      output << (i == 0 ? "" : ",") << std::endl;
+      fObservedMetrics[i]->PrintJSONImpl(output, indent + "    ");
+   }
+   output << (fObservedMetrics.empty() ? "" : "\n" + indent + "  ") << "]" << std::endl;
+   output << indent << "}";
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSON(std::ostream &output) const
+{
+   PrintJSONImpl(output, "");
+   output << std::endl;
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::CollectEvents(
+   const std::string &prefix, std::vector<std::pair<std::string, RNTupleTraceEvent>> &events) const
+{
+   const auto category = prefix + fName;
+   for (const auto &e : GetEvents())
+      events.emplace_back(category, e);
+   for (const auto m : fObservedMetrics)
+      m->CollectEvents(category + kNamespaceSeperator, events);
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintTraceEvents(std::ostream &output) const
+{
+   std::vector<std::pair<std::string, RNTupleTraceEvent>> events;
+   CollectEvents("", events);
+   std::stable_sort(events.begin(), events.end(), [](const auto &a, const auto &b) {
+      return a.second.fStartUs < b.second.fStartUs;
+   });
+
+   output << "{\"traceEvents\": [";
+   for (std::size_t i = 0; i < events.size(); ++i) {
+      const auto &e = events[i].second;
+      output << (i == 0 ? "" : ",") << std::endl << "  {\"name\": \"" << EscapeJSON(e.fName) << "\", \"cat\": \""
+             << EscapeJSON(events[i].first) << "\", \"ph\": \"X\", \"ts\": " << e.fStartUs
+             << ", \"dur\": " << e.fDurationUs << ", \"pid\": 0, \"tid\": " << e.fThreadId
+             << ", \"args\": {\"detail\": \"" << EscapeJSON(e.fDetail) << "\"}}";
+   }
+   output << std::endl << "]}" << std::endl;
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::RecordEvent(const RNTupleTraceEvent &event)
+{
+   if (!fIsEnabled)
+      return;
+   std::lock_guard<std::mutex> guard(*fLockEvents);
+   if (fEvents.size() < fMaxEvents) {
+      fEvents.emplace_back(event);
+      return;
+   }
+   ++fNDroppedEvents;
+   if (fEvents.empty())
+      return;
+   fEvents[fNextEvent] = event;
+   fNextEvent = (fNextEvent + 1) % fEvents.size();
+}
+
+std::vector<ROOT::Experimental::Detail::RNTupleTraceEvent>
+ROOT::Experimental::Detail::RNTupleMetrics::GetEvents() const
+{
+   std::lock_guard<std::mutex> guard(*fLockEvents);
+   std::vector<RNTupleTraceEvent> events(fEvents.begin() + fNextEvent, fEvents.end());
+   events.insert(events.end(), fEvents.begin(), fEvents.begin() + fNextEvent);
+   return events;
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::SetMaxEvents(std::size_t maxEvents)
+{
+   std::lock_guard<std::mutex> guard(*fLockEvents);
+   // Keep the most recent events, in order
+   std::vector<RNTupleTraceEvent> events(fEvents.begin() + fNextEvent, fEvents.end());
+   events.insert(events.end(), fEvents.begin(), fEvents.begin() + fNextEvent);
+   if (events.size() > maxEvents) {
+      fNDroppedEvents += events.size() - maxEvents;
+      events.erase(events.begin(), events.end() - maxEvents);
+   }
+   fEvents = std::move(events);
+   fNextEvent = 0;
+   fMaxEvents = maxEvents;
+}
+
+std::uint64_t ROOT::Experimental::Detail::RNTupleMetrics::GetNDroppedEvents() const
+{
+   std::lock_guard<std::mutex> guard(*fLockEvents);
+   return fNDroppedEvents;
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Enable()
 {
    for (auto &c: fCounters)
@@ -87,3 +256,27 @@ void ROOT::Experimental::Detail::RNTupleMetrics::ObserveMetrics(RNTupleMetrics &
 {
    fObservedMetrics.push_back(&observee);
 }
+
+
+ROOT::Experimental::Detail::RNTupleTraceScope::RNTupleTraceScope(RNTupleMetrics &metrics, const std::string &name)
+   : fMetrics(metrics), fIsActive(metrics.IsEnabled())
+{
+   if (!fIsActive)
+      return;
+   fEvent.fName = name;
+   fEvent.fThreadId = GetTraceThreadId();
+   // Fixes the epoch, if not yet done, before taking the start time
+   GetTraceEpoch();
+   fStartTime = std::chrono::steady_clock::now();
+}
+
+ROOT::Experimental::Detail::RNTupleTraceScope::~RNTupleTraceScope()
+{
+   if (!fIsActive)
+      return;
+   using std::chrono::duration_cast;
+   using std::chrono::microseconds;
+   fEvent.fStartUs = duration_cast<microseconds>(fStartTime - GetTraceEpoch()).count();
+   fEvent.fDurationUs = duration_cast<microseconds>(std::chrono::steady_clock::now() - fStartTime).count();
+   fMetrics.RecordEvent(fEvent);
+}
@@ -59,6 +59,28 @@ void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
    R__ASSERT(false);
 }
 
+void ROOT::Experimental::Detail::RPagePool::Evict(DescriptorId_t clusterId)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+
+   unsigned int N = fPages.size();
+   for (unsigned i = 0; i < N; ) {
+      if ((fReferences[i] != 0) || (fPages[i].GetClusterInfo().GetId() != clusterId)) {
+         ++i;
+         continue;
+      }
+
+      fDeleters[i](fPages[i]);
+      fPages[i] = fPages[N-1];
+      fReferences[i] = fReferences[N-1];
+      fDeleters[i] = fDeleters[N-1];
+      --N;
+   }
+   fPages.resize(N);
+   fReferences.resize(N);
+   fDeleters.resize(N);
+}
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, NTupleSize_t globalIndex)
 {
@@ -15,7 +15,10 @@
 
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
@@ -27,8 +30,72 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+namespace {
+
+/// Merges the value range of the given elements into the statistics.  64bit integers are not necessarily
+/// representable as double; in this case, the range is widened by one ulp on either side.
+template <typename T>
+void UpdateStatistics(const void *buffer, std::size_t count,
+                      ROOT::Experimental::RClusterDescriptor::RColumnStatistics &statistics)
+{
+   if (count == 0)
+      return;
+
+   auto values = reinterpret_cast<const T *>(buffer);
+   double min = std::numeric_limits<double>::infinity();
+   double max = -std::numeric_limits<double>::infinity();
+   for (std::size_t i = 0; i < count; ++i) {
+      // NaN values fail both comparisons
+      const double value = values[i];
+      if (value < min)
+         min = value;
+      if (value > max)
+         max = value;
+   }
+   if (std::is_integral<T>::value && (sizeof(T) == 8)) {
+      constexpr double kMaxExact = 9007199254740992.; // 2^53
+      if (std::abs(min) >= kMaxExact)
+         min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+      if (std::abs(max) >= kMaxExact)
+         max = std::nextafter(max, std::numeric_limits<double>::infinity());
+   }
+
+   statistics.fMin = std::min(statistics.fMin, min);
+   statistics.fMax = std::max(statistics.fMax, max);
+}
+
+/// Whether the sink records the value range of columns of the given on-storage type
+bool HasStatistics(ROOT::Experimental::EColumnType type)
+{
+   using ROOT::Experimental::EColumnType;
+   switch (type) {
+   case EColumnType::kIndex:
+   case EColumnType::kSplitIndex:
+   case EColumnType::kReal64:
+   case EColumnType::kSplitReal64:
+   case EColumnType::kReal32:
+   case EColumnType::kSplitReal32:
+   case EColumnType::kReal16:
+   case EColumnType::kInt64:
+   case EColumnType::kSplitInt64:
+   case EColumnType::kInt32:
+   case EColumnType::kSplitInt32:
+      return true;
+   default:
+      return false;
+   }
+}
+
+} // anonymous namespace
 
 
 ROOT::Experimental::Detail::RPageStorage::RPageStorage(std::string_view name) : fNTupleName(name)
@@ -39,6 +106,14 @@ ROOT::Experimental::Detail::RPageStorage::~RPageStorage()
 {
 }
 
+void ROOT::Experimental::Detail::RPageStorage::AddOnStorageElement(DescriptorId_t columnId, EColumnType type)
+{
+   if (fOnStorageElements.size() <= columnId)
+      fOnStorageElements.resize(columnId + 1);
+   if (!fOnStorageElements[columnId])
+      fOnStorageElements[columnId] = RColumnElementBase::Generate(type);
+}
+
 ROOT::Experimental::Detail::RNTupleMetrics &ROOT::Experimental::Detail::RPageStorage::GetMetrics()
 {
    static RNTupleMetrics metrics("");
@@ -71,6 +146,7 @@ ROOT::Experimental::Detail::RPageSource::AddColumn(DescriptorId_t fieldId, const
    auto columnId = fDescriptor.FindColumnId(fieldId, column.GetIndex());
    R__ASSERT(columnId != kInvalidDescriptorId);
    fActiveColumns.emplace(columnId);
+   AddOnStorageElement(columnId, fDescriptor.GetColumnDescriptor(columnId).GetModel().GetType());
    return ColumnHandle_t{columnId, &column};
 }
 
@@ -95,6 +171,15 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSource::LoadClusters(const std::vector<RClusterKey> &clusterKeys)
+{
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   for (const auto &key : clusterKeys)
+      clusters.emplace_back(LoadCluster(key.fClusterId, key.fColumnSet));
+   return clusters;
+}
+
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
    if (fTaskScheduler)
@@ -108,6 +193,8 @@ void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 ROOT::Experimental::Detail::RPageSink::RPageSink(std::string_view name, const RNTupleWriteOptions &options)
    : RPageStorage(name), fOptions(options)
 {
+   // Without knowledge of the compression factor, assume that the data does not compress
+   fOpenClusterUnzippedLimit = GetUnzippedClusterLimit(1.);
 }
 
 ROOT::Experimental::Detail::RPageSink::~RPageSink()
@@ -120,15 +207,63 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSink> ROOT::Experimental::Detai
    return std::make_unique<RPageSinkFile>(ntupleName, location, options);
 }
 
+ROOT::Experimental::RColumnModel
+ROOT::Experimental::Detail::RPageSink::GetColumnModelOnStorage(const RColumnModel &model) const
+{
+   const auto isSorted = model.GetIsSorted();
+   if (fOptions.GetUseReal16() && (model.GetType() == EColumnType::kReal32))
+      return RColumnModel(EColumnType::kReal16, isSorted);
+   if (!fOptions.GetUseSplitEncoding())
+      return model;
+
+   switch (model.GetType()) {
+   case EColumnType::kIndex:
+      return RColumnModel(EColumnType::kSplitIndex, isSorted);
+   case EColumnType::kReal64:
+      return RColumnModel(EColumnType::kSplitReal64, isSorted);
+   case EColumnType::kReal32:
+      return RColumnModel(EColumnType::kSplitReal32, isSorted);
+   case EColumnType::kInt64:
+      return RColumnModel(EColumnType::kSplitInt64, isSorted);
+   case EColumnType::kInt32:
+      return RColumnModel(EColumnType::kSplitInt32, isSorted);
+   default:
+      return model;
+   }
+}
+
 ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
 ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const RColumn &column)
 {
    auto columnId = fLastColumnId++;
-   fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetVersion(), column.GetModel(), column.GetIndex());
+   const auto modelOnStorage = GetColumnModelOnStorage(column.GetModel());
+   fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetVersion(), modelOnStorage, column.GetIndex());
+   AddOnStorageElement(columnId, modelOnStorage.GetType());
    return ColumnHandle_t{columnId, &column};
 }
 
 
+std::uint64_t ROOT::Experimental::Detail::RPageSink::GetUnzippedClusterLimit(double compressionFactor) const
+{
+   auto limit = std::numeric_limits<std::uint64_t>::max();
+   if (fOptions.GetApproxZippedClusterSize() > 0)
+      limit = static_cast<std::uint64_t>(compressionFactor * fOptions.GetApproxZippedClusterSize());
+   if (fOptions.GetMaxUnzippedClusterSize() > 0)
+      limit = std::min(limit, static_cast<std::uint64_t>(fOptions.GetMaxUnzippedClusterSize()));
+   return limit;
+}
+
+
+std::size_t ROOT::Experimental::Detail::RPageSink::GetDefaultNElementsPerPage(ColumnHandle_t columnHandle) const
+{
+   if (fOptions.GetApproxUnzippedPageSize() == 0)
+      return RNTupleWriteOptions::kDefaultElementsPerPage;
+   const std::size_t nElements =
+      (fOptions.GetApproxUnzippedPageSize() * 8) / GetOnStorageElement(columnHandle.fId)->GetBitsOnStorage();
+   return std::max(nElements, std::size_t(1));
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 {
    fDescriptorBuilder.SetNTuple(fNTupleName, model.GetDescription(), "undefined author",
@@ -166,15 +301,88 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       RClusterDescriptor::RPageRange pageRange;
       pageRange.fColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
+      if (fOptions.GetUseColumnStatistics()) {
+         RClusterDescriptor::RColumnStatistics statistics;
+         statistics.fColumnId = i;
+         fOpenColumnStatistics.emplace_back(statistics);
+         fOpenLastIndexes.emplace_back(0);
+      }
    }
 
    CreateImpl(model);
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::UpdateColumnStatistics(ColumnHandle_t columnHandle, const RPage &page)
+{
+   const auto columnId = columnHandle.fId;
+   auto &statistics = fOpenColumnStatistics[columnId];
+   const auto nElements = page.GetNElements();
+   const void *buffer = page.GetBuffer();
+
+   // Column types with fewer bits on storage than in memory, such as Real16, store quantized values.  The statistics
+   // need to describe the values read back, so that a range filter does not skip clusters with matching entries.
+   const auto type = columnHandle.fColumn->GetModel().GetType();
+   const auto elementOnStorage = GetOnStorageElement(columnId);
+   std::unique_ptr<unsigned char[]> unpackedBuffer;
+   if (((type == EColumnType::kReal32) || (type == EColumnType::kReal64)) &&
+       (elementOnStorage->GetBitsOnStorage() < 8 * elementOnStorage->GetSize())) {
+      auto packedBuffer = std::make_unique<unsigned char[]>((nElements * elementOnStorage->GetBitsOnStorage() + 7) / 8);
+      elementOnStorage->Pack(packedBuffer.get(), page.GetBuffer(), nElements);
+      unpackedBuffer = std::make_unique<unsigned char[]>(page.GetSize());
+      elementOnStorage->Unpack(unpackedBuffer.get(), packedBuffer.get(), nElements);
+      buffer = unpackedBuffer.get();
+   }
+
+   // Integer column types do not encode signedness; the C++ type of the in-memory column element does
+   const auto elementInMemory = columnHandle.fColumn->GetElement();
+   const bool isUnsigned =
+      (dynamic_cast<const RColumnElement<std::uint32_t, EColumnType::kInt32> *>(elementInMemory) != nullptr) ||
+      (dynamic_cast<const RColumnElement<std::uint64_t, EColumnType::kInt64> *>(elementInMemory) != nullptr);
+
+   switch (type) {
+   case EColumnType::kIndex: {
+      auto indexes = reinterpret_cast<const ClusterSize_t *>(buffer);
+      auto &lastIndex = fOpenLastIndexes[columnId];
+      std::vector<ClusterSize_t::ValueType> sizes(nElements);
+      for (std::size_t i = 0; i < nElements; ++i) {
+         sizes[i] = indexes[i] - lastIndex;
+         lastIndex = indexes[i];
+      }
+      UpdateStatistics<ClusterSize_t::ValueType>(sizes.data(), nElements, statistics);
+      break;
+   }
+   case EColumnType::kReal64:
+      UpdateStatistics<double>(buffer, nElements, statistics);
+      break;
+   case EColumnType::kReal32:
+      UpdateStatistics<float>(buffer, nElements, statistics);
+      break;
+   case EColumnType::kInt64:
+      if (isUnsigned)
+         UpdateStatistics<std::uint64_t>(buffer, nElements, statistics);
+      else
+         UpdateStatistics<std::int64_t>(buffer, nElements, statistics);
+      break;
+   case EColumnType::kInt32:
+      if (isUnsigned)
+         UpdateStatistics<std::uint32_t>(buffer, nElements, statistics);
+      else
+         UpdateStatistics<std::int32_t>(buffer, nElements, statistics);
+      break;
+   default:
+      // No statistics for bits, bytes, and switches
+      break;
+   }
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
+   if (fOptions.GetUseColumnStatistics())
+      UpdateColumnStatistics(columnHandle, page);
    auto locator = CommitPageImpl(columnHandle, page);
+   fOpenClusterUnzippedBytes += page.GetSize();
 
    auto columnId = columnHandle.fId;
    fOpenColumnRanges[columnId].fNElements += page.GetNElements();
@@ -185,6 +393,38 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto locator = CommitSealedPageImpl(columnId, sealedPage);
+
+   if (fOptions.GetUseColumnStatistics()) {
+      auto &statistics = fOpenColumnStatistics[columnId];
+      if (sealedPage.fStatistics) {
+         statistics.fMin = std::min(statistics.fMin, sealedPage.fStatistics->fMin);
+         statistics.fMax = std::max(statistics.fMax, sealedPage.fStatistics->fMax);
+      } else if ((sealedPage.fNElements > 0) &&
+                 HasStatistics(fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId).GetModel().GetType())) {
+         statistics.fMin = -std::numeric_limits<double>::infinity();
+         statistics.fMax = std::numeric_limits<double>::infinity();
+      }
+   }
+
+   fOpenColumnRanges[columnId].fNElements += sealedPage.fNElements;
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fLocator = locator;
+   fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSink::CommitSealedPageImpl(DescriptorId_t /* columnId */,
+                                                           const RSealedPage & /* sealedPage */)
+{
+   throw RException(R__FAIL("page sink '" + fNTupleName + "' does not support sealed pages"));
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto locator = CommitClusterImpl(nEntries);
@@ -204,6 +444,20 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       range.fColumnId = fullRange.fColumnId;
       fDescriptorBuilder.AddClusterPageRange(fLastClusterId, std::move(fullRange));
    }
+   for (auto &statistics : fOpenColumnStatistics) {
+      if (!statistics.IsEmpty())
+         fDescriptorBuilder.AddClusterColumnStatistics(fLastClusterId, statistics);
+      const auto columnId = statistics.fColumnId;
+      statistics = RClusterDescriptor::RColumnStatistics();
+      statistics.fColumnId = columnId;
+      fOpenLastIndexes[columnId] = 0;
+   }
    ++fLastClusterId;
    fPrevClusterNEntries = nEntries;
+
+   if ((fOpenClusterUnzippedBytes > 0) && (locator.fBytesOnStorage > 0)) {
+      const double compressionFactor = double(fOpenClusterUnzippedBytes) / double(locator.fBytesOnStorage);
+      fOpenClusterUnzippedLimit = GetUnzippedClusterLimit(compressionFactor);
+   }
+   fOpenClusterUnzippedBytes = 0;
 }
@@ -84,6 +84,9 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
 
 ROOT::Experimental::Detail::RPageSinkFile::~RPageSinkFile()
 {
+   // Pages of an uncommitted cluster are dropped but their compression tasks may still refer to them
+   if (!fPendingPages.empty())
+      fTaskScheduler->Wait();
 }
 
 
@@ -101,13 +104,67 @@ void ROOT::Experimental::Detail::RPageSinkFile::CreateImpl(const RNTupleModel &
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::WriteSealedPage(const unsigned char *buffer, std::size_t zippedBytes,
+                                                           std::size_t packedBytes)
+{
+   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
+   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
+   fClusterMaxOffset = std::max(offsetData + zippedBytes, fClusterMaxOffset);
+
+   RClusterDescriptor::RLocator result;
+   result.fPosition = offsetData;
+   result.fBytesOnStorage = zippedBytes;
+   return result;
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkFile::SchedulePage(ColumnHandle_t columnHandle, const RPage &page)
+{
+   if (fPendingPages.empty())
+      fTaskScheduler->Reset();
+
+   const auto element = GetOnStorageElement(columnHandle.fId);
+   const auto isMappable = element->IsMappable();
+
+   // The page buffer is reused by the column once we return, so we need to take a (packed) copy
+   RPendingPage pendingPage;
+   pendingPage.fColumnId = columnHandle.fId;
+   pendingPage.fPageIdx = fOpenPageRanges[columnHandle.fId].fPageInfos.size();
+   pendingPage.fPackedBytes =
+      isMappable ? page.GetSize() : (page.GetNElements() * element->GetBitsOnStorage() + 7) / 8;
+   pendingPage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[pendingPage.fPackedBytes]);
+   if (isMappable) {
+      memcpy(pendingPage.fBuffer.get(), page.GetBuffer(), pendingPage.fPackedBytes);
+   } else {
+      element->Pack(pendingPage.fBuffer.get(), page.GetBuffer(), page.GetNElements());
+   }
+   fPendingPages.emplace_back(std::move(pendingPage));
+
+   auto taskFunc = [pending = &fPendingPages.back(), compression = fOptions.GetCompression()] () {
+      pending->fZipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[pending->fPackedBytes]);
+      pending->fZippedBytes = RNTupleCompressor::Zip(pending->fBuffer.get(), pending->fPackedBytes, compression,
+                                                     pending->fZipBuffer.get());
+      pending->fBuffer.reset();
+   };
+   fTaskScheduler->AddTask(taskFunc);
+}
+
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
 {
+   if (fTaskScheduler && (fOptions.GetCompression() != 0)) {
+      SchedulePage(columnHandle, page);
+      // The page is written and its locator is set when the cluster is committed
+      return RClusterDescriptor::RLocator();
+   }
+
    unsigned char *buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
    bool isAdoptedBuffer = true;
    auto packedBytes = page.GetSize();
-   auto element = columnHandle.fColumn->GetElement();
+   // The on-storage column type determines the packing, it may differ from the in-memory column type
+   const auto element = GetOnStorageElement(columnHandle.fId);
    const auto isMappable = element->IsMappable();
 
    if (!isMappable) {
@@ -126,23 +183,36 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnH
       isAdoptedBuffer = true;
    }
 
-   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
-   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
-   fClusterMaxOffset = std::max(offsetData + zippedBytes, fClusterMaxOffset);
+   auto result = WriteSealedPage(buffer, zippedBytes, packedBytes);
 
    if (!isAdoptedBuffer)
       delete[] buffer;
 
-   RClusterDescriptor::RLocator result;
-   result.fPosition = offsetData;
-   result.fBytesOnStorage = zippedBytes;
    return result;
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   const auto packedBytes = (sealedPage.fNElements * GetOnStorageElement(columnId)->GetBitsOnStorage() + 7) / 8;
+   return WriteSealedPage(reinterpret_cast<const unsigned char *>(sealedPage.fBuffer), sealedPage.fSize, packedBytes);
+}
+
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
+   if (!fPendingPages.empty()) {
+      fTaskScheduler->Wait();
+      // Write the pages in the order in which they have been committed
+      for (const auto &pendingPage : fPendingPages) {
+         fOpenPageRanges[pendingPage.fColumnId].fPageInfos[pendingPage.fPageIdx].fLocator =
+            WriteSealedPage(pendingPage.fZipBuffer.get(), pendingPage.fZippedBytes, pendingPage.fPackedBytes);
+      }
+      fPendingPages.clear();
+   }
+
    RClusterDescriptor::RLocator result;
    result.fPosition = fClusterMinOffset;
    result.fBytesOnStorage = fClusterMaxOffset - fClusterMinOffset;
@@ -171,7 +241,7 @@ ROOT::Experimental::Detail::RPage
 ROOT::Experimental::Detail::RPageSinkFile::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
 {
    if (nElements == 0)
-      nElements = kDefaultElementsPerPage;
+      nElements = GetDefaultNElementsPerPage(columnHandle);
    auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
    return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
 }
@@ -210,7 +280,7 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    , fMetrics("RPageSourceFile")
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this))
+   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterCacheSize()))
 {
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadV", "", "number of vector read requests"),
@@ -357,7 +427,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    R__ASSERT(firstInPage <= idxInCluster);
    R__ASSERT((firstInPage + pageInfo.fNElements) > idxInCluster);
 
-   const auto element = columnHandle.fColumn->GetElement();
+   const auto element = GetOnStorageElement(columnId);
    const auto elementSize = element->GetSize();
 
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
@@ -458,8 +528,11 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
-ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
+   const RClusterKey &clusterKey, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
 {
+   const auto clusterId = clusterKey.fClusterId;
+   const auto &columns = clusterKey.fColumnSet;
    fCounters->fNClusterLoaded.Inc();
 
    const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
@@ -519,16 +592,9 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       gapCut = g;
    }
 
-   // Prepare the input vector for the RRawFile::ReadV() call
-   struct RReadRequest {
-      RReadRequest() = default;
-      RReadRequest(std::size_t b, std::uint64_t o, std::uint64_t s) : fBufPos(b), fOffset(o), fSize(s) {}
-      std::size_t fBufPos = 0;
-      std::uint64_t fOffset = 0;
-      std::uint64_t fSize = 0;
-   };
-   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
-
+   // Prepare the input vector for the RRawFile::ReadV() call; the buffer pointers are relative to the
+   // beginning of the cluster's page buffer until the buffer is allocated
+   const auto firstRequest = readRequests.size();
    ROOT::Internal::RRawFile::RIOVec req;
    std::size_t szPayload = 0;
    std::size_t szOverhead = 0;
@@ -555,7 +621,8 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       req.fOffset = s.fOffset;
       req.fSize = s.fSize;
    }
-   readRequests.emplace_back(req);
+   if (req.fSize > 0)
+      readRequests.emplace_back(req);
    fCounters->fSzReadPayload.Add(szPayload);
    fCounters->fSzReadOverhead.Add(szOverhead);
 
@@ -567,11 +634,40 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto &r : readRequests) {
-      r.fBuffer = buffer + reinterpret_cast<intptr_t>(r.fBuffer);
+   for (auto i = firstRequest; i < readRequests.size(); ++i) {
+      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
    }
 
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : columns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   std::vector<RClusterKey> clusterKeys{RClusterKey(clusterId, columns)};
+   return std::move(LoadClusters(clusterKeys)[0]);
+}
+
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(const std::vector<RClusterKey> &clusterKeys)
+{
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   for (const auto &key : clusterKeys) {
+      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
+   }
+
+   // A single vector read for all the pages of all the requested clusters allows the raw file to keep
+   // many requests in flight, e.g. with io_uring
    auto nReqs = readRequests.size();
+   if (nReqs == 0)
+      return clusters;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
       fFile->ReadV(&readRequests[0], nReqs);
@@ -579,11 +675,13 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
-   auto cluster = std::make_unique<RCluster>(clusterId);
-   cluster->Adopt(std::move(pageMap));
-   for (auto colId : columns)
-      cluster->SetColumnAvailable(colId);
-   return cluster;
+   return clusters;
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceFile::EvictCluster(DescriptorId_t clusterId)
+{
+   fPagePool->Evict(clusterId);
 }
 
 
@@ -0,0 +1,256 @@
+/// \file RPageStorageMem.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageStorageMem.hxx>
+
+#include <TError.h>
+
+#include <cstring>
+#include <utility>
+
+
+void ROOT::Experimental::Detail::RNTupleArena::Publish(std::string_view ntupleName, std::unique_ptr<RNTupleData> data)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fNTuples[std::string(ntupleName)] = std::move(data);
+}
+
+
+std::shared_ptr<const ROOT::Experimental::Detail::RNTupleArena::RNTupleData>
+ROOT::Experimental::Detail::RNTupleArena::Get(std::string_view ntupleName) const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itr = fNTuples.find(std::string(ntupleName));
+   if (itr == fNTuples.end())
+      return nullptr;
+   return itr->second;
+}
+
+
+bool ROOT::Experimental::Detail::RNTupleArena::Erase(std::string_view ntupleName)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fNTuples.erase(std::string(ntupleName)) > 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+ROOT::Experimental::Detail::RPageSinkMem::RPageSinkMem(std::string_view ntupleName,
+   std::shared_ptr<RNTupleArena> arena, const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options)
+   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+   , fArena(std::move(arena))
+   , fData(std::make_unique<RNTupleArena::RNTupleData>())
+{
+   R__ASSERT(fArena);
+   // Pages are kept in their in-memory layout, the column ranges and types should not claim otherwise
+   fOptions.SetCompression(0);
+   fOptions.SetUseSplitEncoding(false);
+   fOptions.SetUseReal16(false);
+}
+
+
+ROOT::Experimental::Detail::RPageSinkMem::~RPageSinkMem() = default;
+
+
+void ROOT::Experimental::Detail::RPageSinkMem::CreateImpl(const RNTupleModel & /* model */)
+{
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   fData->fSzHeader = descriptor.GetHeaderSize();
+   fData->fHeader = std::make_unique<unsigned char[]>(fData->fSzHeader);
+   descriptor.SerializeHeader(fData->fHeader.get());
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkMem::CommitPageImpl(ColumnHandle_t /* columnHandle */, const RPage &page)
+{
+   // The page buffer is reused by the column, so we need to keep a copy
+   auto pageBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[page.GetSize()]);
+   memcpy(pageBuffer.get(), page.GetBuffer(), page.GetSize());
+
+   RClusterDescriptor::RLocator result;
+   result.fPosition = fData->fPages.size();
+   result.fBytesOnStorage = page.GetSize();
+   fData->fPages.emplace_back(std::move(pageBuffer));
+   fClusterSize += page.GetSize();
+   return result;
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkMem::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
+{
+   RClusterDescriptor::RLocator result;
+   result.fPosition = fClusterFirstPage;
+   result.fBytesOnStorage = fClusterSize;
+   fClusterFirstPage = fData->fPages.size();
+   fClusterSize = 0;
+   return result;
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkMem::CommitDatasetImpl()
+{
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   fData->fSzFooter = descriptor.GetFooterSize();
+   fData->fFooter = std::make_unique<unsigned char[]>(fData->fSzFooter);
+   descriptor.SerializeFooter(fData->fFooter.get());
+
+   fArena->Publish(fNTupleName, std::move(fData));
+   fData = std::make_unique<RNTupleArena::RNTupleData>();
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkMem::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = GetDefaultNElementsPerPage(columnHandle);
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkMem::ReleasePage(RPage &page)
+{
+   fPageAllocator->DeletePage(page);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+ROOT::Experimental::Detail::RPageSourceMem::RPageSourceMem(std::string_view ntupleName,
+   std::shared_ptr<RNTupleArena> arena, const RNTupleReadOptions &options)
+   : RPageSource(ntupleName, options)
+   , fArena(std::move(arena))
+{
+   R__ASSERT(fArena);
+}
+
+
+ROOT::Experimental::Detail::RPageSourceMem::~RPageSourceMem() = default;
+
+
+ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceMem::AttachImpl()
+{
+   fData = fArena->Get(fNTupleName);
+   if (!fData)
+      throw RException(R__FAIL("no ntuple named '" + fNTupleName + "' in memory arena"));
+
+   RNTupleDescriptorBuilder descBuilder;
+   descBuilder.SetFromHeader(fData->fHeader.get());
+   descBuilder.AddClustersFromFooter(fData->fFooter.get());
+   return descBuilder.MoveDescriptor();
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceMem::PopulatePageFromCluster(
+   ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor, ClusterSize_t::ValueType idxInCluster)
+{
+   const auto columnId = columnHandle.fId;
+   const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   decltype(idxInCluster) firstInPage = 0;
+   for (const auto &pi : pageRange.fPageInfos) {
+      if (firstInPage + pi.fNElements > idxInCluster) {
+         pageInfo = pi;
+         break;
+      }
+      firstInPage += pi.fNElements;
+   }
+   R__ASSERT(firstInPage <= idxInCluster);
+   R__ASSERT((firstInPage + pageInfo.fNElements) > idxInCluster);
+
+   const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   R__ASSERT(pageInfo.fLocator.fPosition < fData->fPages.size());
+   R__ASSERT(pageInfo.fLocator.fBytesOnStorage == elementSize * pageInfo.fNElements);
+   auto pageBuffer = fData->fPages[pageInfo.fLocator.fPosition].get();
+
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   RPage page(columnId, pageBuffer, elementSize * pageInfo.fNElements, elementSize);
+   page.TryGrow(pageInfo.fNElements);
+   page.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterDescriptor.GetId(), indexOffset));
+   return page;
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceMem::PopulatePage(
+   ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
+{
+   const auto columnId = columnHandle.fId;
+   const auto clusterId = fDescriptor.FindClusterId(columnId, globalIndex);
+   R__ASSERT(clusterId != kInvalidDescriptorId);
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+   const auto selfOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   R__ASSERT(selfOffset <= globalIndex);
+   return PopulatePageFromCluster(columnHandle, clusterDescriptor, globalIndex - selfOffset);
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceMem::PopulatePage(
+   ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex)
+{
+   const auto clusterId = clusterIndex.GetClusterId();
+   R__ASSERT(clusterId != kInvalidDescriptorId);
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+   return PopulatePageFromCluster(columnHandle, clusterDescriptor, clusterIndex.GetIndex());
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceMem::ReleasePage(RPage & /* page */)
+{
+   // Populated pages are owned by the arena
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceMem::Clone() const
+{
+   return std::make_unique<RPageSourceMem>(fNTupleName, fArena, fOptions);
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceMem::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
+
+   // The page map does not own the memory, the pages stay in the arena
+   auto pageMap = std::make_unique<ROnDiskPageMap>();
+   for (auto columnId : columns) {
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         const auto &pageLocator = pageInfo.fLocator;
+         ROnDiskPage::Key key(columnId, pageNo);
+         pageMap->Register(key, ROnDiskPage(fData->fPages[pageLocator.fPosition].get(), pageLocator.fBytesOnStorage));
+         ++pageNo;
+      }
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : columns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
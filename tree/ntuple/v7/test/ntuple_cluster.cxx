@@ -55,6 +55,8 @@ public:
    /// Records the cluster IDs requests by LoadCluster() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RPageSource::ColumnSet_t> fReqsColumns;
+   /// Records the cluster IDs passed to EvictCluster()
+   std::vector<ROOT::Experimental::DescriptorId_t> fEvictedClusterIds;
 
    RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
@@ -84,6 +86,10 @@ public:
       cluster->Adopt(std::move(pageMap));
       return cluster;
    }
+   void EvictCluster(ROOT::Experimental::DescriptorId_t clusterId) final
+   {
+      fEvictedClusterIds.emplace_back(clusterId);
+   }
 };
 
 } // anonymous namespace
@@ -204,7 +210,10 @@ TEST(ClusterPool, Windows)
 {
    RPageSourceMock ps;
 
-   EXPECT_DEATH(RClusterPool(ps, 0), ".*");
+   // No look-ahead
+   RClusterPool c0(ps, 0);
+   EXPECT_EQ(0U, c0.GetWindowPre());
+   EXPECT_EQ(1U, c0.GetWindowPost());
    RClusterPool c1(ps, 1);
    EXPECT_EQ(0U, c1.GetWindowPre());
    EXPECT_EQ(1U, c1.GetWindowPost());
@@ -285,6 +294,21 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, EvictCluster)
+{
+   RPageSourceMock p1;
+   RClusterPool c1(p1, 2);
+   c1.GetCluster(0, {0});
+   EXPECT_TRUE(p1.fEvictedClusterIds.empty());
+   // Cluster 0 drops out of the window
+   c1.GetCluster(1, {0});
+   ASSERT_EQ(1U, p1.fEvictedClusterIds.size());
+   EXPECT_EQ(0U, p1.fEvictedClusterIds[0]);
+   c1.GetCluster(1, {0});
+   EXPECT_EQ(1U, p1.fEvictedClusterIds.size());
+}
+
+
 TEST(PageStorageFile, LoadCluster)
 {
    FileRaii fileGuard("test_ntuple_clusters.root");
@@ -328,3 +352,66 @@ TEST(PageStorageFile, LoadCluster)
    ROnDiskPage::Key key(colId, 0);
    EXPECT_NE(nullptr, cluster->GetOnDiskPage(key));
 }
+
+
+TEST(PageStorageFile, LoadClusters)
+{
+   FileRaii fileGuard("test_ntuple_load_clusters.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+
+   {
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite), std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(
+            "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleWriteOptions()));
+      for (unsigned i = 0; i < 3; ++i) {
+         *wrPt = i;
+         ntuple.Fill();
+         ntuple.CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::Detail::RPageSourceFile source(
+      "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions());
+   source.Attach();
+   source.GetMetrics().Enable();
+
+   auto ptId = source.GetDescriptor().FindFieldId("pt");
+   auto colId = source.GetDescriptor().FindColumnId(ptId, 0);
+   auto column = std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+      ROOT::Experimental::Detail::RColumn::Create<float, ROOT::Experimental::EColumnType::kReal32>(
+         ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal32, false), 0));
+   column->Connect(ptId, &source);
+
+   std::vector<RPageSource::RClusterKey> clusterKeys;
+   clusterKeys.emplace_back(2, RPageSource::ColumnSet_t{colId});
+   clusterKeys.emplace_back(0, RPageSource::ColumnSet_t{colId});
+   clusterKeys.emplace_back(1, RPageSource::ColumnSet_t{});
+   auto clusters = source.LoadClusters(clusterKeys);
+   ASSERT_EQ(3U, clusters.size());
+   EXPECT_EQ(2U, clusters[0]->GetId());
+   EXPECT_EQ(0U, clusters[1]->GetId());
+   EXPECT_EQ(1U, clusters[2]->GetId());
+   EXPECT_EQ(1U, clusters[0]->GetNOnDiskPages());
+   EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
+   EXPECT_EQ(0U, clusters[2]->GetNOnDiskPages());
+   EXPECT_TRUE(clusters[0]->ContainsColumn(colId));
+   EXPECT_FALSE(clusters[2]->ContainsColumn(colId));
+
+   // All the pages are requested in a single vector read
+   EXPECT_EQ(1, source.GetMetrics().GetCounter("RPageSourceFile.nReadV")->GetValueAsInt());
+   EXPECT_EQ(3, source.GetMetrics().GetCounter("RPageSourceFile.nClusterLoaded")->GetValueAsInt());
+
+   ROnDiskPage::Key key(colId, 0);
+   ROOT::Experimental::Detail::RNTupleDecompressor decompressor;
+   float pt;
+   auto onDiskPage = clusters[0]->GetOnDiskPage(key);
+   ASSERT_NE(nullptr, onDiskPage);
+   decompressor(onDiskPage->GetAddress(), onDiskPage->GetSize(), sizeof(float), &pt);
+   EXPECT_EQ(2.0, pt);
+   onDiskPage = clusters[1]->GetOnDiskPage(key);
+   ASSERT_NE(nullptr, onDiskPage);
+   decompressor(onDiskPage->GetAddress(), onDiskPage->GetSize(), sizeof(float), &pt);
+   EXPECT_EQ(0.0, pt);
+}
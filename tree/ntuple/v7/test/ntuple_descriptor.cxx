@@ -97,6 +97,12 @@ TEST(RNTuple, Descriptor)
    pageRange3.fPageInfos.emplace_back(pageInfo);
    descBuilder.AddClusterPageRange(1, std::move(pageRange3));
 
+   ROOT::Experimental::RClusterDescriptor::RColumnStatistics statistics;
+   statistics.fColumnId = 3;
+   statistics.fMin = 0.0;
+   statistics.fMax = 12.0;
+   descBuilder.AddClusterColumnStatistics(1, statistics);
+
    const auto &reference = descBuilder.GetDescriptor();
    EXPECT_EQ("MyTuple", reference.GetName());
    EXPECT_EQ(1U, reference.GetVersion().GetVersionUse());
@@ -127,6 +133,10 @@ TEST(RNTuple, Descriptor)
    reco.SetFromHeader(headerBuffer);
    reco.AddClustersFromFooter(footerBuffer);
    EXPECT_EQ(reference, reco.GetDescriptor());
+   EXPECT_FALSE(reco.GetDescriptor().GetClusterDescriptor(0).HasColumnStatistics(3));
+   EXPECT_FALSE(reco.GetDescriptor().GetClusterDescriptor(1).HasColumnStatistics(4));
+   ASSERT_TRUE(reco.GetDescriptor().GetClusterDescriptor(1).HasColumnStatistics(3));
+   EXPECT_EQ(12.0, reco.GetDescriptor().GetClusterDescriptor(1).GetColumnStatistics(3).fMax);
 
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNEntries());
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNElements(3));
@@ -71,6 +71,46 @@ TEST(RNTuple, RealWorld1)
 }
 
 
+// Pages are compressed concurrently and written at the end of the cluster, which must not change the data
+TEST(RNTuple, ParallelZip)
+{
+   ROOT::EnableImplicitMT();
+   FileRaii fileGuard("test_ntuple_parallel_zip.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrEnergy = modelWrite->MakeField<double>("energy");
+   auto wrTag = modelWrite->MakeField<std::string>("tag");
+   auto wrHits = modelWrite->MakeField<std::vector<float>>("hits");
+
+   constexpr unsigned int nEvents = 60000;
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrEnergy = i;
+         *wrTag = std::to_string(i % 100);
+         wrHits->assign(i % 7, float(i));
+         ntuple->Fill();
+         if (i % 20000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(nEvents, ntuple->GetNEntries());
+   EXPECT_EQ(4U, ntuple->GetDescriptor().GetNClusters());
+   auto rdEnergy = ntuple->GetView<double>("energy");
+   auto rdTag = ntuple->GetView<std::string>("tag");
+   auto rdHits = ntuple->GetView<std::vector<float>>("hits");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(double(i), rdEnergy(i));
+      EXPECT_EQ(std::to_string(i % 100), rdTag(i));
+      EXPECT_EQ(std::vector<float>(i % 7, float(i)), rdHits(i));
+   }
+}
+
+
 // Stress test the asynchronous cluster pool by a deliberately unfavourable read pattern
 TEST(RNTuple, RandomAccess)
 {
@@ -84,6 +124,8 @@ TEST(RNTuple, RandomAccess)
    {
       RNTupleWriteOptions options;
       options.SetCompression(0);
+      // Many small clusters
+      options.SetApproxZippedClusterSize(100 * 1000);
       auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
       for (unsigned int i = 0; i < nEvents; ++i)
          ntuple->Fill();
@@ -5,3 +5,102 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+
+void WriteMergeInput(const std::string &path, int offset, int compression)
+{
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrTracks = model->MakeField<std::vector<int>>("tracks");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   options.SetUseColumnStatistics(true);
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", path, options);
+   for (int i = 0; i < 10; ++i) {
+      *wrPt = offset + i;
+      wrTracks->assign(i % 3, offset + i);
+      ntuple->Fill();
+      if (i == 4)
+         ntuple->CommitCluster();
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merger_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_in3.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 404);
+   WriteMergeInput(fileGuard2.GetPath(), 10, 101);
+   WriteMergeInput(fileGuard3.GetPath(), 20, 0);
+
+   for (unsigned int nParallelInputs : {1, 3}) {
+      // Parallel inputs are loaded in the IMT pool
+      if (nParallelInputs > 1)
+         ROOT::EnableImplicitMT();
+      FileRaii fileGuardOut("test_ntuple_merger_out.root");
+      {
+         std::vector<std::unique_ptr<RPageSource>> sources;
+         for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath(), fileGuard3.GetPath()})
+            sources.emplace_back(RPageSource::Create("f", path));
+         // The first input is copied verbatim, the others are recompressed
+         RNTupleWriteOptions options;
+         options.SetCompression(404);
+         options.SetUseColumnStatistics(true);
+         auto destination = RPageSink::Create("f", fileGuardOut.GetPath(), options);
+         RNTupleMerger merger(nParallelInputs);
+         merger.Merge(std::move(sources), *destination);
+      }
+
+      auto ntuple = RNTupleReader::Open("f", fileGuardOut.GetPath());
+      EXPECT_EQ(30U, ntuple->GetNEntries());
+      EXPECT_EQ(6U, ntuple->GetDescriptor().GetNClusters());
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTracks = ntuple->GetView<std::vector<int>>("tracks");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(std::vector<int>(i % 10 % 3, static_cast<int>(i)), viewTracks(i));
+      }
+
+      // The column statistics of the input clusters are carried over
+      const auto &desc = ntuple->GetDescriptor();
+      const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+      for (std::size_t i = 0; i < desc.GetNClusters(); ++i) {
+         const auto &clusterDesc = desc.GetClusterDescriptor(i);
+         EXPECT_TRUE(clusterDesc.HasColumnStatistics(ptColumnId));
+         if (!clusterDesc.HasColumnStatistics(ptColumnId))
+            continue;
+         const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+         EXPECT_EQ(double(firstEntry), clusterDesc.GetColumnStatistics(ptColumnId).fMin);
+         EXPECT_EQ(double(firstEntry + 4), clusterDesc.GetColumnStatistics(ptColumnId).fMax);
+      }
+
+      if (nParallelInputs > 1)
+         ROOT::DisableImplicitMT();
+   }
+}
+
+TEST(RNTupleMerger, SchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merger_mismatch_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_mismatch_in2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_mismatch_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 404);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      model->MakeField<std::vector<int>>("tracks");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   std::vector<std::unique_ptr<RPageSource>> sources;
+   sources.emplace_back(RPageSource::Create("f", fileGuard1.GetPath()));
+   sources.emplace_back(RPageSource::Create("f", fileGuard2.GetPath()));
+   auto destination = RPageSink::Create("f", fileGuardOut.GetPath());
+   RNTupleMerger merger;
+   EXPECT_THROW(merger.Merge(std::move(sources), *destination), RException);
+}
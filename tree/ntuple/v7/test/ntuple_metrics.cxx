@@ -89,3 +89,77 @@ TEST(Metrics, Timer)
    }
    EXPECT_GT(ctrWallTime.GetValue(), 0U);
 }
+
+TEST(Metrics, TraceEvents)
+{
+   RNTupleMetrics inner("inner");
+   inner.MakeCounter<RNTuplePlainCounter *>("plain", "s", "with \"quotes\"")->SetValue(42);
+   RNTupleMetrics outer("outer");
+   outer.ObserveMetrics(inner);
+
+   {
+      RNTupleTraceScope scope(inner, "disabled");
+      EXPECT_FALSE(scope.IsActive());
+   }
+   EXPECT_TRUE(inner.GetEvents().empty());
+
+   {
+      // Opened before the metrics are enabled: not recorded
+      RNTupleTraceScope scope(inner, "opened before enabling");
+      outer.Enable();
+      EXPECT_FALSE(scope.IsActive());
+   }
+   EXPECT_TRUE(inner.GetEvents().empty());
+
+   {
+      RNTupleTraceScope scope(inner, "read");
+      EXPECT_TRUE(scope.IsActive());
+      scope.SetDetail("cluster 0");
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+   }
+   std::thread([&inner]() { RNTupleTraceScope scope(inner, "unzip"); }).join();
+
+   auto events = inner.GetEvents();
+   ASSERT_EQ(2U, events.size());
+   EXPECT_EQ("read", events[0].fName);
+   EXPECT_EQ("cluster 0", events[0].fDetail);
+   EXPECT_GE(events[0].fDurationUs, 10000);
+   EXPECT_EQ("unzip", events[1].fName);
+   EXPECT_NE(events[0].fThreadId, events[1].fThreadId);
+   EXPECT_GE(events[1].fStartUs, events[0].fStartUs + events[0].fDurationUs);
+
+   std::ostringstream json;
+   outer.PrintJSON(json);
+   EXPECT_THAT(json.str(), testing::HasSubstr("\"name\": \"outer\""));
+   EXPECT_THAT(json.str(), testing::HasSubstr("\"description\": \"with \\\"quotes\\\"\", \"value\": 42}"));
+   EXPECT_THAT(json.str(), testing::HasSubstr("\"detail\": \"cluster 0\""));
+
+   std::ostringstream trace;
+   outer.PrintTraceEvents(trace);
+   EXPECT_THAT(trace.str(), testing::StartsWith("{\"traceEvents\": ["));
+   EXPECT_THAT(trace.str(), testing::HasSubstr("\"name\": \"read\", \"cat\": \"outer.inner\", \"ph\": \"X\""));
+   EXPECT_THAT(trace.str(), testing::HasSubstr("\"name\": \"unzip\""));
+}
+
+TEST(Metrics, TraceEventsCap)
+{
+   RNTupleMetrics metrics("metrics");
+   metrics.Enable();
+   metrics.SetMaxEvents(3);
+   for (int i = 0; i < 5; ++i) {
+      RNTupleTraceEvent event;
+      event.fName = std::to_string(i);
+      metrics.RecordEvent(event);
+   }
+   auto events = metrics.GetEvents();
+   ASSERT_EQ(3U, events.size());
+   EXPECT_EQ("2", events[0].fName);
+   EXPECT_EQ("4", events[2].fName);
+   EXPECT_EQ(2U, metrics.GetNDroppedEvents());
+
+   metrics.SetMaxEvents(1);
+   events = metrics.GetEvents();
+   ASSERT_EQ(1U, events.size());
+   EXPECT_EQ("4", events[0].fName);
+   EXPECT_EQ(4U, metrics.GetNDroppedEvents());
+}
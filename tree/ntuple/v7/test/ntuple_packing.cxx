@@ -1,5 +1,11 @@
 #include "ntuple_test.hxx"
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -32,3 +38,115 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, EColumnType::kSplitIndex> element(nullptr);
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(32U, element.GetBitsOnStorage());
+
+   ClusterSize_t index[] = {ClusterSize_t(3), ClusterSize_t(3), ClusterSize_t(260), ClusterSize_t(70000)};
+   unsigned char packed[sizeof(index)];
+   element.Pack(packed, index, 4);
+   // Deltas 3, 0, 257, 69740 stored byte by byte: first the lowest bytes of all elements
+   EXPECT_EQ(3, packed[0]);
+   EXPECT_EQ(0, packed[1]);
+   EXPECT_EQ(1, packed[2]);
+   EXPECT_EQ(0, packed[5]);
+   EXPECT_EQ(1, packed[6]);
+
+   ClusterSize_t unpacked[4];
+   element.Unpack(unpacked, packed, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(index[i], unpacked[i]);
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, EColumnType::kSplitInt32> element(nullptr);
+   std::int32_t values[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::min(),
+                            std::numeric_limits<std::int32_t>::max()};
+   unsigned char packed[sizeof(values)];
+   element.Pack(packed, values, 6);
+   // Zigzag encoding of the lowest bytes
+   EXPECT_EQ(0, packed[0]);
+   EXPECT_EQ(1, packed[1]);
+   EXPECT_EQ(2, packed[2]);
+   EXPECT_EQ(3, packed[3]);
+   std::int32_t unpacked[6];
+   element.Unpack(unpacked, packed, 6);
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(values[i], unpacked[i]);
+
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, EColumnType::kSplitInt64> element64(nullptr);
+   std::int64_t values64[] = {-42, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()};
+   unsigned char packed64[sizeof(values64)];
+   element64.Pack(packed64, values64, 3);
+   std::int64_t unpacked64[3];
+   element64.Unpack(unpacked64, packed64, 3);
+   for (unsigned i = 0; i < 3; ++i)
+      EXPECT_EQ(values64[i], unpacked64[i]);
+}
+
+TEST(Packing, SplitReal)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, EColumnType::kSplitReal64> element(nullptr);
+   double values[] = {0.0, -1.5, 3.14159, std::numeric_limits<double>::infinity()};
+   unsigned char packed[sizeof(values)];
+   element.Pack(packed, values, 4);
+   double unpacked[4];
+   element.Unpack(unpacked, packed, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(values[i], unpacked[i]);
+
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kSplitReal32> element32(nullptr);
+   float values32[] = {0.0, -1.5, 3.14159};
+   unsigned char packed32[sizeof(values32)];
+   element32.Pack(packed32, values32, 3);
+   float unpacked32[3];
+   element32.Unpack(unpacked32, packed32, 3);
+   for (unsigned i = 0; i < 3; ++i)
+      EXPECT_EQ(values32[i], unpacked32[i]);
+}
+
+TEST(Packing, Real16)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal16> element(nullptr);
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(16U, element.GetBitsOnStorage());
+
+   float values[] = {0.0, -0.0, 1.0, -2.5, 65504.0, 1e6, 0.00006103515625 /* 2^-14 */,
+                     0.000000059604645 /* 2^-24 */, 1e-10, 3.14159f,
+                     std::numeric_limits<float>::infinity()};
+   const unsigned N = sizeof(values) / sizeof(float);
+   std::uint16_t packed[N];
+   element.Pack(packed, values, N);
+   EXPECT_EQ(0x0000, packed[0]);
+   EXPECT_EQ(0x8000, packed[1]);
+   EXPECT_EQ(0x3c00, packed[2]);
+   EXPECT_EQ(0xc100, packed[3]);
+   EXPECT_EQ(0x7bff, packed[4]);
+   EXPECT_EQ(0x7c00, packed[5]);
+   EXPECT_EQ(0x0400, packed[6]);
+   EXPECT_EQ(0x0001, packed[7]);
+   EXPECT_EQ(0x0000, packed[8]);
+
+   float unpacked[N];
+   element.Unpack(unpacked, packed, N);
+   EXPECT_EQ(0.0, unpacked[0]);
+   EXPECT_TRUE(std::signbit(unpacked[1]));
+   EXPECT_EQ(1.0, unpacked[2]);
+   EXPECT_EQ(-2.5, unpacked[3]);
+   EXPECT_EQ(65504.0, unpacked[4]);
+   EXPECT_TRUE(std::isinf(unpacked[5]));
+   EXPECT_FLOAT_EQ(values[6], unpacked[6]);
+   EXPECT_FLOAT_EQ(values[7], unpacked[7]);
+   EXPECT_EQ(0.0, unpacked[8]);
+   EXPECT_NEAR(3.14159, unpacked[9], 1e-3);
+   EXPECT_TRUE(std::isinf(unpacked[10]));
+
+   float nan = std::numeric_limits<float>::quiet_NaN();
+   element.Pack(packed, &nan, 1);
+   element.Unpack(unpacked, packed, 1);
+   EXPECT_TRUE(std::isnan(unpacked[0]));
+}
@@ -55,3 +55,34 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolEvict)
+{
+   RPagePool pool;
+   unsigned char buffer[20];
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+
+   RPage page1(1, &buffer[0], 10, 1);
+   EXPECT_NE(nullptr, page1.TryGrow(10));
+   page1.SetWindow(0, RPage::RClusterInfo(0, 0));
+   pool.PreloadPage(page1, deleter);
+   RPage page2(1, &buffer[10], 10, 1);
+   EXPECT_NE(nullptr, page2.TryGrow(10));
+   page2.SetWindow(10, RPage::RClusterInfo(1, 10));
+   pool.PreloadPage(page2, deleter);
+   RPage page3(2, &buffer[10], 10, 1);
+   EXPECT_NE(nullptr, page3.TryGrow(10));
+   page3.SetWindow(10, RPage::RClusterInfo(1, 10));
+   pool.PreloadPage(page3, deleter);
+
+   auto page = pool.GetPage(1, 15);
+   EXPECT_FALSE(page.IsNull());
+   // Only the unused page of cluster 1 is freed
+   pool.Evict(1);
+   EXPECT_EQ(1U, nCallDeleter);
+   EXPECT_TRUE(pool.GetPage(2, 15).IsNull());
+   EXPECT_FALSE(pool.GetPage(1, 5).IsNull());
+   pool.ReturnPage(page);
+   EXPECT_EQ(2U, nCallDeleter);
+}
@@ -27,3 +27,91 @@ TEST(RNTuple, RDF)
    auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath());
    EXPECT_EQ(42.0, *rdf.Min("pt"));
 }
+
+TEST(RNTuple, RDFClusterFilter)
+{
+   FileRaii fileGuard("test_ntuple_rdf_cluster_filter.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+   auto wrJets = modelWrite->MakeField<std::vector<float>>("jets");
+   {
+      RNTupleWriteOptions options;
+      options.SetUseColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
+      // Three clusters with pt in [0, 10), [10, 20), [20, 30) and 0, 1, or 2 jets, respectively
+      for (int c = 0; c < 3; ++c) {
+         for (int i = 0; i < 10; ++i) {
+            *wrPt = 10 * c + i;
+            wrJets->assign(c, 1.0);
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto jetsColumnId = desc.FindColumnId(desc.FindFieldId("jets"), 0);
+   ASSERT_TRUE(desc.GetClusterDescriptor(1).HasColumnStatistics(ptColumnId));
+   EXPECT_EQ(10.0, desc.GetClusterDescriptor(1).GetColumnStatistics(ptColumnId).fMin);
+   EXPECT_EQ(19.0, desc.GetClusterDescriptor(1).GetColumnStatistics(ptColumnId).fMax);
+   EXPECT_EQ(2.0, desc.GetClusterDescriptor(2).GetColumnStatistics(jetsColumnId).fMin);
+   EXPECT_EQ(2.0, desc.GetClusterDescriptor(2).GetColumnStatistics(jetsColumnId).fMax);
+
+   auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath(), {{"pt", 15.0, 100.0}});
+   EXPECT_EQ(20U, *rdf.Count());
+   EXPECT_EQ(15U, *rdf.Filter("pt >= 15").Count());
+
+   auto rdfTwoFilters = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath(),
+                                                                {{"pt", 15.0, 100.0}, {"jets", 0.0, 1.0}});
+   EXPECT_EQ(10U, *rdfTwoFilters.Count());
+   EXPECT_EQ(10.0, *rdfTwoFilters.Min("pt"));
+
+   auto rdfEmpty = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath(), {{"pt", 100.0, 200.0}});
+   EXPECT_EQ(0U, *rdfEmpty.Count());
+
+   // A filter selecting all the clusters must not merge them into a single range
+   ROOT::Experimental::RNTupleDS ds(RPageSource::Create("myNTuple", fileGuard.GetPath()));
+   ds.AddClusterFilter({"pt", 0.0, 100.0});
+   ds.SetNSlots(3);
+   ds.Initialise();
+   auto ranges = ds.GetEntryRanges();
+   ASSERT_EQ(3U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(30U, ranges[2].second);
+}
+
+TEST(RNTuple, ColumnStatisticsOnStorage)
+{
+   FileRaii fileGuard("test_ntuple_column_statistics_on_storage.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+   auto wrId = modelWrite->MakeField<std::uint32_t>("id");
+   {
+      RNTupleWriteOptions options;
+      options.SetUseColumnStatistics(true);
+      options.SetUseReal16(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
+      // Not representable in half precision
+      *wrPt = 1000.3;
+      *wrId = 4000000000U;
+      ntuple->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto idColumnId = desc.FindColumnId(desc.FindFieldId("id"), 0);
+   auto viewPt = ntuple->GetView<float>("pt");
+   // The statistics describe the quantized values on storage
+   EXPECT_NE(1000.3f, viewPt(0));
+   EXPECT_EQ(viewPt(0), desc.GetClusterDescriptor(0).GetColumnStatistics(ptColumnId).fMin);
+   EXPECT_EQ(viewPt(0), desc.GetClusterDescriptor(0).GetColumnStatistics(ptColumnId).fMax);
+   EXPECT_EQ(4000000000., desc.GetClusterDescriptor(0).GetColumnStatistics(idColumnId).fMax);
+
+   auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath(), {{"pt", 1000.4, 2000.0}});
+   EXPECT_EQ(*rdf.Filter("pt >= 1000.4").Count(), *rdf.Count());
+}
@@ -70,3 +70,141 @@ TEST(RNTuple, Extended)
    }
    EXPECT_EQ(chksumRead, chksumWrite);
 }
+
+TEST(RNTuple, MemArena)
+{
+   auto arena = std::make_shared<RNTupleArena>();
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrTracks = model->MakeField<std::vector<std::string>>("tracks");
+
+   {
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RPageSinkMem>("f", arena));
+      for (unsigned int i = 0; i < 20000; ++i) {
+         *wrPt = i;
+         wrTracks->assign(i % 3, std::to_string(i));
+         ntuple->Fill();
+         if (i == 9999)
+            ntuple->CommitCluster();
+      }
+      // Not visible before the data set is committed
+      EXPECT_FALSE(arena->Get("f"));
+   }
+   EXPECT_TRUE(arena->Get("f"));
+
+   auto ntuple = std::make_unique<RNTupleReader>(std::make_unique<RPageSourceMem>("f", arena));
+   EXPECT_EQ(20000U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, ntuple->GetDescriptor().GetNClusters());
+   auto rdPt = ntuple->GetView<float>("pt");
+   auto rdTracks = ntuple->GetView<std::vector<std::string>>("tracks");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(float(i), rdPt(i));
+      EXPECT_EQ(std::vector<std::string>(i % 3, std::to_string(i)), rdTracks(i));
+   }
+
+   auto clone = ntuple->Clone();
+   EXPECT_EQ(20000U, clone->GetNEntries());
+
+   // The reader keeps the data alive
+   EXPECT_TRUE(arena->Erase("f"));
+   EXPECT_FALSE(arena->Erase("f"));
+   EXPECT_EQ(19999.0, rdPt(19999));
+   EXPECT_THROW(RNTupleReader(std::make_unique<RPageSourceMem>("f", arena)), RException);
+}
+
+TEST(RNTuple, SplitEncoding)
+{
+   FileRaii fileGuard("test_ntuple_split_encoding.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrE = model->MakeField<double>("E");
+   auto wrCharge = model->MakeField<std::int32_t>("charge");
+   auto wrTracks = model->MakeField<std::vector<double>>("tracks");
+   {
+      RNTupleWriteOptions options;
+      options.SetUseSplitEncoding(true);
+      options.SetUseReal16(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = 0.5 * i;
+         *wrE = 1.5 * i;
+         *wrCharge = (i % 2) ? -i : i;
+         wrTracks->assign(i % 5, double(i));
+         ntuple->Fill();
+         if (i == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto columnType = [&desc](const std::string &fieldName) {
+      auto columnId = desc.FindColumnId(desc.FindFieldId(fieldName), 0);
+      return desc.GetColumnDescriptor(columnId).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kReal16, columnType("pt"));
+   EXPECT_EQ(EColumnType::kSplitReal64, columnType("E"));
+   EXPECT_EQ(EColumnType::kSplitInt32, columnType("charge"));
+   EXPECT_EQ(EColumnType::kSplitIndex, columnType("tracks"));
+
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   auto rdE = ntuple->GetModel()->GetDefaultEntry()->Get<double>("E");
+   auto rdCharge = ntuple->GetModel()->GetDefaultEntry()->Get<std::int32_t>("charge");
+   auto rdTracks = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<double>>("tracks");
+   EXPECT_EQ(100U, ntuple->GetNEntries());
+   for (auto i : *ntuple) {
+      ntuple->LoadEntry(i);
+      // Multiples of 0.5 below 64 are exactly representable in half precision
+      EXPECT_EQ(0.5 * i, *rdPt);
+      EXPECT_EQ(1.5 * i, *rdE);
+      EXPECT_EQ((i % 2) ? -int(i) : int(i), *rdCharge);
+      EXPECT_EQ(std::vector<double>(i % 5, double(i)), *rdTracks);
+   }
+}
+
+TEST(RNTuple, PageAndClusterSizing)
+{
+   FileRaii fileGuard("test_ntuple_page_cluster_sizing.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrEnergy = model->MakeField<double>("energy");
+   auto wrFlag = model->MakeField<bool>("flag");
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetApproxUnzippedPageSize(1000);
+      options.SetApproxZippedClusterSize(50 * 1000);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 100000; ++i) {
+         *wrEnergy = i;
+         *wrFlag = (i % 2) == 0;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(100000U, ntuple->GetNEntries());
+   const auto &desc = ntuple->GetDescriptor();
+   // 800kB of doubles result in clusters of roughly 50kB
+   EXPECT_GT(desc.GetNClusters(), 10U);
+   EXPECT_LT(desc.GetNClusters(), 30U);
+
+   // Pages hold approximately 1000 bytes, independent of the element size: 125 doubles or 8000 bits.  The clusters
+   // are smaller than 8000 entries, so that there is a single page of bits per cluster.
+   const auto &cluster = desc.GetClusterDescriptor(0);
+   const auto energyColumnId = desc.FindColumnId(desc.FindFieldId("energy"), 0);
+   const auto flagColumnId = desc.FindColumnId(desc.FindFieldId("flag"), 0);
+   EXPECT_EQ(125U, cluster.GetPageRange(energyColumnId).fPageInfos[0].fNElements);
+   EXPECT_LT(cluster.GetNEntries(), 8000U);
+   ASSERT_EQ(1U, cluster.GetPageRange(flagColumnId).fPageInfos.size());
+   EXPECT_EQ(cluster.GetNEntries(), cluster.GetPageRange(flagColumnId).fPageInfos[0].fNElements);
+
+   auto rdEnergy = ntuple->GetView<double>("energy");
+   auto rdFlag = ntuple->GetView<bool>("flag");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(double(i), rdEnergy(i));
+      EXPECT_EQ((i % 2) == 0, rdFlag(i));
+   }
+}
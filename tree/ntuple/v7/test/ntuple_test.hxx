@@ -20,6 +20,7 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageStorageMem.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RVec.hxx>
 
@@ -64,6 +65,7 @@ using RFieldMerger = ROOT::Experimental::RFieldMerger;
 using RFieldValue = ROOT::Experimental::Detail::RFieldValue;
 using RMiniFileReader = ROOT::Experimental::Internal::RMiniFileReader;
 using RNTuple = ROOT::Experimental::RNTuple;
+using RNTupleArena = ROOT::Experimental::Detail::RNTupleArena;
 using RNTupleAtomicCounter = ROOT::Experimental::Detail::RNTupleAtomicCounter;
 using RNTupleAtomicTimer = ROOT::Experimental::Detail::RNTupleAtomicTimer;
 using RNTupleCalcPerf = ROOT::Experimental::Detail::RNTupleCalcPerf;
@@ -76,10 +78,13 @@ using RNTupleReader = ROOT::Experimental::RNTupleReader;
 using RNTupleReadOptions = ROOT::Experimental::RNTupleReadOptions;
 using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
 using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
+using RNTupleMerger = ROOT::Experimental::RNTupleMerger;
 using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
 using RNTupleModel = ROOT::Experimental::RNTupleModel;
 using RNTuplePlainCounter = ROOT::Experimental::Detail::RNTuplePlainCounter;
 using RNTuplePlainTimer = ROOT::Experimental::Detail::RNTuplePlainTimer;
+using RNTupleTraceEvent = ROOT::Experimental::Detail::RNTupleTraceEvent;
+using RNTupleTraceScope = ROOT::Experimental::Detail::RNTupleTraceScope;
 using RNTupleVersion = ROOT::Experimental::RNTupleVersion;
 using RPage = ROOT::Experimental::Detail::RPage;
 using RPageAllocatorHeap = ROOT::Experimental::Detail::RPageAllocatorHeap;
@@ -87,8 +92,10 @@ using RPageDeleter = ROOT::Experimental::Detail::RPageDeleter;
 using RPagePool = ROOT::Experimental::Detail::RPagePool;
 using RPageSink = ROOT::Experimental::Detail::RPageSink;
 using RPageSinkFile = ROOT::Experimental::Detail::RPageSinkFile;
+using RPageSinkMem = ROOT::Experimental::Detail::RPageSinkMem;
 using RPageSource = ROOT::Experimental::Detail::RPageSource;
 using RPageSourceFile = ROOT::Experimental::Detail::RPageSourceFile;
+using RPageSourceMem = ROOT::Experimental::Detail::RPageSourceMem;
 using RPrepareVisitor = ROOT::Experimental::RPrepareVisitor;
 using RPrintSchemaVisitor = ROOT::Experimental::RPrintSchemaVisitor;
 using RRawFile = ROOT::Internal::RRawFile;
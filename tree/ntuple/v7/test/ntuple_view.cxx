@@ -121,3 +121,110 @@ TEST(RNTuple, Composable)
    }
    EXPECT_EQ(8, nEv);
 }
+
+TEST(RNTuple, ViewMapV)
+{
+   FileRaii fileGuard("test_ntuple_view_mapv.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldJets = model->MakeField<std::vector<float>>("jets");
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *fieldPt = i;
+         fieldJets->assign(i % 3, i);
+         ntuple->Fill();
+         if (i == 59)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewJets = ntuple->GetViewCollection("jets");
+   auto viewJetItems = viewJets.GetView<float>("float");
+
+   float sumPt = 0.0;
+   float sumJets = 0.0;
+   NTupleSize_t nBatches = 0;
+   for (NTupleSize_t i = 0; i < ntuple->GetNEntries(); ++nBatches) {
+      auto pts = viewPt.MapV(i, 1000);
+      // Pages do not cross cluster boundaries
+      EXPECT_LE(i + pts.size(), (i < 60) ? 60U : 100U);
+      for (auto pt : pts)
+         sumPt += pt;
+
+      auto offsets = viewJets.MapV(i, pts.size());
+      EXPECT_EQ(pts.size(), offsets.size());
+      auto items = viewJets.GetCollectionRange(i, offsets.size());
+      const auto firstItem = *items.begin();
+      const std::uint64_t itemsEnd = offsets.back();
+      EXPECT_EQ(0U, firstItem.GetIndex());
+      for (auto itemIndex = firstItem; itemIndex.GetIndex() < itemsEnd;) {
+         auto jets = viewJetItems.MapV(itemIndex, itemsEnd - itemIndex.GetIndex());
+         for (auto jet : jets)
+            sumJets += jet;
+         itemIndex = itemIndex + jets.size();
+      }
+
+      i += pts.size();
+   }
+   EXPECT_EQ(2U, nBatches);
+
+   float expectedSumPt = 0.0;
+   float expectedSumJets = 0.0;
+   for (int i = 0; i < 100; ++i) {
+      expectedSumPt += i;
+      expectedSumJets += (i % 3) * i;
+   }
+   EXPECT_FLOAT_EQ(expectedSumPt, sumPt);
+   EXPECT_FLOAT_EQ(expectedSumJets, sumJets);
+
+   auto pts = viewPt.MapV(10, 5);
+   EXPECT_EQ(5U, pts.size());
+   EXPECT_FLOAT_EQ(10.0, pts[0]);
+   EXPECT_FLOAT_EQ(14.0, pts[4]);
+}
+
+TEST(RNTuple, MapVCollectionAcrossPages)
+{
+   FileRaii fileGuard("test_ntuple_mapv_collection_pages.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldJets = model->MakeField<std::vector<float>>("jets");
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      // Small pages such that the offsets span several pages
+      options.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         fieldJets->assign(i % 3, i);
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewJets = ntuple->GetViewCollection("jets");
+
+   NTupleSize_t nBatches = 0;
+   std::uint64_t expectedStart = 0;
+   for (NTupleSize_t i = 0; i < ntuple->GetNEntries(); ++nBatches) {
+      auto offsets = viewJets.MapV(i, 1000);
+      auto items = viewJets.GetCollectionRange(i, offsets.size());
+      // The batch of offsets remains valid
+      EXPECT_EQ(expectedStart, (*items.begin()).GetIndex());
+      EXPECT_EQ(expectedStart + (i % 3), offsets[0]);
+      std::uint64_t itemsEnd = expectedStart;
+      for (std::size_t j = 0; j < offsets.size(); ++j) {
+         itemsEnd += (i + j) % 3;
+         EXPECT_EQ(itemsEnd, offsets[j]);
+      }
+      expectedStart = itemsEnd;
+      i += offsets.size();
+   }
+   EXPECT_GT(nBatches, 1U);
+}
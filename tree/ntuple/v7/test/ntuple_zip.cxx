@@ -20,6 +20,23 @@ TEST(RNTupleZip, Basics)
 }
 
 
+TEST(RNTupleZip, Static)
+{
+   std::string data = "xxxxxxxxxxxxxxxxxxxxxxxx";
+   auto zipBuffer = std::unique_ptr<char[]>(new char[data.length()]);
+   auto szZipped = RNTupleCompressor::Zip(data.data(), data.length(), 505, zipBuffer.get());
+   EXPECT_LT(szZipped, data.length());
+   auto unzipBuffer = std::unique_ptr<char[]>(new char[data.length()]);
+   RNTupleDecompressor()(zipBuffer.get(), szZipped, data.length(), unzipBuffer.get());
+   EXPECT_EQ(data, std::string(unzipBuffer.get(), data.length()));
+
+   char X = 'x';
+   char Y = 'y';
+   EXPECT_EQ(1U, RNTupleCompressor::Zip(&X, 1, 101, &Y));
+   EXPECT_EQ('x', Y);
+}
+
+
 TEST(RNTupleZip, Empty)
 {
    RNTupleCompressor compressor;
@@ -11,7 +11,9 @@ TEST(RNTuple, ReadString)
    {
       auto model = RNTupleModel::Create();
       auto st = model->MakeField<std::string>("st");
-      auto ntuple = RNTupleWriter::Recreate(std::move(model), ntupleName, fileGuard.GetPath());
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(10000);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), ntupleName, fileGuard.GetPath(), options);
 
       for (int i = 0; i < numEntries; ++i) {
          *st = contentString;
@@ -27,6 +27,8 @@
 
 #include "TKey.h"
 
+#include <memory>
+
 class TFile;
 class TTree;
 class TBranch;
@@ -58,6 +60,13 @@ private:
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
 
+   // Give back its own buffer to the basket after it was read in place from the file mapping.
+   void   UnmapBuffer() { if (R__unlikely(fBufferMapped)) UnmapBufferImpl(); }
+   void   UnmapBufferImpl();
+
+   // Give back the memory of the buffers to the buffer pool.
+   void   ReleaseBuffers();
+
 protected:
    Int_t       fBufferSize{0};                    ///< fBuffer length in bytes
    Int_t       fNevBufSize{0};                    ///< Length in Int_t of fEntryOffset OR fixed length of each entry if fEntryOffset is null!
@@ -75,6 +84,11 @@ protected:
    Int_t       fLastWriteBufferSize[3] = {0,0,0}; ///<! Size of the buffer last three buffers we wrote it to disk
    Bool_t      fResetAllocation{false};           ///<! True if last reset re-allocated the memory
    UChar_t     fNextBufferSizeRecord{0};          ///<! Index into fLastWriteBufferSize of the last buffer written to disk
+   Int_t       fWriteCycle{-1};                   ///<! Key cycle of the next WriteBuffer; if negative, the write basket number of the branch
+   Bool_t      fBufferAdopted{kFALSE};            ///<! True if fBufferRef was given by the user, see AdoptBuffer
+   Bool_t      fBufferMapped{kFALSE};             ///<! True if fBufferRef views the file mapping; the basket's own buffer is in fMappedBufferRef
+   TBuffer    *fMappedBufferRef{nullptr};         ///<! Buffer viewing the file mapping (see TFile::GetMappedBuffer) or, while fBufferMapped, the basket's own buffer
+   std::shared_ptr<void> fMapping;                ///<! Keeps alive the file mapping viewed by the basket
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t   fResetAllocationTime{0};           ///<! Time spent reallocating baskets in microseconds during last Reset operation.
 #endif
@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -71,9 +73,11 @@ class TBulkBranchRead {
 
 public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   Int_t GetBulkEntriesJagged(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsJaggedBulkRead() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -178,6 +182,7 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntriesJagged(Long64_t, TBuffer&, std::vector<Int_t>&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
@@ -283,6 +288,7 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree;}
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsJaggedBulkRead() const;
    virtual void      UpdateAddress() {;}
    virtual void      UpdateFile();
 
@@ -316,7 +322,9 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntriesJagged(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetBulkEntriesJagged(evt, user_buf, offsets); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsJaggedBulkRead() const { return fParent.SupportsJaggedBulkRead(); }
 
 }  // Internal
 }  // Experimental
@@ -115,6 +115,9 @@ public:
    TBranch         *GetBranch() const { return fBranch; }
    virtual DeserializeType GetDeserializeType() const { return DeserializeType::kDestructive; }
    virtual TString  GetFullName() const;
+   /// If the entries of this leaf are variable-size arrays of a fundamental type that can be read in bulk, return true
+   /// and fill the number of bytes that precede the elements of each entry in the basket and the size of an element.
+   virtual Bool_t   GetJaggedLayout(Int_t & /*headerSize*/, Int_t & /*elementSize*/) const { return kFALSE; }
    ///  If this leaf stores a variable-sized array or a multi-dimensional array whose last dimension has variable size,
    ///  return a pointer to the TLeaf that stores such size. Return a nullptr otherwise.
    virtual TLeaf   *GetLeafCount() const { return fLeafCount; }
@@ -151,6 +154,7 @@ public:
    virtual void     ReadBasket(TBuffer &) {}
    virtual void     ReadBasketExport(TBuffer &, TClonesArray *, Int_t) {}
    virtual bool     ReadBasketFast(TBuffer&, Long64_t) { return false; }  // Read contents of leaf into a user-provided buffer.
+   virtual bool     ReadBasketJagged(TBuffer&, Long64_t) { return false; }  // Deserialize N contiguous elements of a jagged leaf in place.
    virtual bool     ReadBasketSerialized(TBuffer&, Long64_t) { return false; }  // Read contents of leaf into a user-provided buffer
    virtual void     ReadValue(std::istream & /*s*/, Char_t /*delim*/ = ' ') {
       Error("ReadValue", "Not implemented!");
@@ -40,6 +40,7 @@ protected:
 
 private:
    virtual Int_t       GetOffsetHeaderSize() const {return 1;}
+   EDataType           GetVectorValueType() const;
 
 public:
    TLeafElement();
@@ -51,6 +52,7 @@ public:
    virtual DeserializeType GetDeserializeType() const;
 
    virtual TString  GetFullName() const;
+   virtual Bool_t   GetJaggedLayout(Int_t &headerSize, Int_t &elementSize) const;
    virtual Int_t    GetLen() const {return ((TBranchElement*)fBranch)->GetNdata()*fLen;}
    TMethodCall     *GetMethodCall(const char *name);
    virtual Int_t    GetMaximum() const {return ((TBranchElement*)fBranch)->GetMaximum();}
@@ -63,6 +65,7 @@ public:
    template<typename T> T GetTypedValueSubArray(Int_t i=0, Int_t j=0) const {return ((TBranchElement*)fBranch)->GetTypedValue<T>(i, j, kTRUE);}
 
    virtual bool     ReadBasketFast(TBuffer&, Long64_t);
+   virtual bool     ReadBasketJagged(TBuffer&, Long64_t);
    virtual bool     ReadBasketSerialized(TBuffer&, Long64_t) { return GetDeserializeType() != DeserializeType::kDestructive; }
 
    virtual void    *GetValuePointer() const { return ((TBranchElement*)fBranch)->GetValuePointer(); }
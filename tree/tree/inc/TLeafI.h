@@ -41,6 +41,7 @@ public:
    virtual void    FillBasket(TBuffer &b);
    virtual DeserializeType GetDeserializeType() const { return DeserializeType::kInPlace; }
    const char     *GetTypeName() const;
+   virtual Bool_t  GetJaggedLayout(Int_t &headerSize, Int_t &elementSize) const { headerSize = 0; elementSize = fLenType; return fLeafCount != nullptr; }
    virtual Int_t   GetMaximum() const { return fMaximum; }
    virtual Int_t   GetMinimum() const { return fMinimum; }
    Double_t        GetValue(Int_t i=0) const;
@@ -51,6 +52,7 @@ public:
    virtual void    ReadBasket(TBuffer &b);
    virtual void    ReadBasketExport(TBuffer &b, TClonesArray *list, Int_t n);
    virtual bool    ReadBasketFast(TBuffer&, Long64_t);
+   virtual bool    ReadBasketJagged(TBuffer&, Long64_t);
    virtual bool    ReadBasketSerialized(TBuffer&, Long64_t) { return GetDeserializeType() == DeserializeType::kInPlace; }
    virtual void    ReadValue(std::istream& s, Char_t delim = ' ');
    virtual void    SetAddress(void *add=0);
@@ -40,6 +40,7 @@ public:
    virtual void    Export(TClonesArray *list, Int_t n);
    virtual void    FillBasket(TBuffer &b);
    const char     *GetTypeName() const;
+   virtual Bool_t  GetJaggedLayout(Int_t &headerSize, Int_t &elementSize) const { headerSize = 0; elementSize = fLenType; return fLeafCount != nullptr; }
    virtual Int_t   GetMaximum() const { return (Int_t)fMaximum; }
    virtual Int_t   GetMinimum() const { return (Int_t)fMinimum; }
    virtual Double_t     GetValue(Int_t i=0) const;
@@ -52,6 +53,7 @@ public:
    virtual void    ReadBasket(TBuffer &b);
    virtual void    ReadBasketExport(TBuffer &b, TClonesArray *list, Int_t n);
    virtual bool    ReadBasketFast(TBuffer&, Long64_t);
+   virtual bool    ReadBasketJagged(TBuffer&, Long64_t);
    virtual bool    ReadBasketSerialized(TBuffer&, Long64_t) { return GetDeserializeType() == DeserializeType::kInPlace; }
    virtual void    ReadValue(std::istream& s, Char_t delim = ' ');
    virtual void    SetAddress(void *add=0);
@@ -76,6 +76,12 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TTreeAsyncWriter;
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -156,10 +162,12 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   ROOT::Internal::TTreeAsyncWriter *fAsyncWriter{nullptr}; ///<! Writer thread of the baskets, if they are written asynchronously.
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
+   Int_t            WaitAsyncWrites() const;
    void             MarkEventCluster();
 
 protected:
@@ -436,6 +444,8 @@ public:
    virtual Int_t           FlushBaskets(Bool_t create_cluster = true) const;
    virtual const char     *GetAlias(const char* aliasName) const;
    UInt_t                  GetAllocationCount() const { return fAllocationCount; }
+   Long64_t                GetAsyncWrite() const;
+   ROOT::Internal::TTreeAsyncWriter *GetAsyncWriter() const { return fAsyncWriter; } ///< Internal use only, see SetAsyncWrite.
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t               GetAllocationTime() const { return fAllocationTime; }
 #endif
@@ -573,6 +583,7 @@ public:
    virtual void            ResetBranchAddresses();
    virtual Long64_t        Scan(const char* varexp = "", const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
    virtual Bool_t          SetAlias(const char* aliasName, const char* aliasFormula);
+   virtual void            SetAsyncWrite(Long64_t maxBytesInFlight);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
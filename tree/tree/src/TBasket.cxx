@@ -23,10 +23,12 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
+#include "ROOT/RBufferPool.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
 
 #include <bitset>
+#include <utility>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
@@ -105,8 +107,12 @@ TBasket::~TBasket()
 {
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
+   ReleaseBuffers();
    if (fBufferRef) delete fBufferRef;
+   // Either the view of the file mapping or, if fBufferMapped, our own buffer.
+   delete fMappedBufferRef;
    fBufferRef = 0;
+   fMappedBufferRef = nullptr;
    fBuffer = 0;
    fDisplacement= 0;
    // Note we only delete the compressed buffer if we own it
@@ -126,6 +132,7 @@ TBasket::~TBasket()
 
 void TBasket::AdjustSize(Int_t newsize)
 {
+   UnmapBuffer();
    if (fBuffer == fBufferRef->Buffer()) {
       fBufferRef->Expand(newsize);
       fBuffer = fBufferRef->Buffer();
@@ -176,9 +183,14 @@ Int_t TBasket::DropBuffers()
 
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
+   ReleaseBuffers();
    if (fBufferRef)    delete fBufferRef;
+   delete fMappedBufferRef;
    if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
    fBufferRef   = 0;
+   fMappedBufferRef = nullptr;
+   fBufferMapped = kFALSE;
+   fMapping.reset();
    fCompressedBufferRef = 0;
    fBuffer      = 0;
    fDisplacement= 0;
@@ -244,6 +256,7 @@ Int_t TBasket::GetEntryPointer(Int_t entry)
 
 Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree)
 {
+   UnmapBuffer();
    if (fBufferRef) {
       // Reuse the buffer if it exist.
       fBufferRef->Reset();
@@ -379,12 +392,17 @@ Int_t TBasket::ReadBasketBuffersUncompressedCase()
 
 Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree, TFile* file)
 {
+   // The buffers given away by the cache come from the buffer pool (see TTreeCacheUnzip::UnzipBuffer):
+   // use the whole block, so that it goes back to the right size class.
+   const Int_t bufferSize = mustFree ? ROOT::Internal::RBufferPool::GetBlockSize(size) : size;
    if (fBufferRef) {
-      fBufferRef->SetBuffer(buffer, size, mustFree);
+      if (!fBufferAdopted)
+         ROOT::Internal::RBufferPool::ReleaseBuffer(*fBufferRef);
       fBufferRef->SetReadMode();
+      fBufferRef->SetBuffer(buffer, bufferSize, mustFree);
       fBufferRef->Reset();
    } else {
-      fBufferRef = new TBufferFile(TBuffer::kRead, size, buffer, mustFree);
+      fBufferRef = new TBufferFile(TBuffer::kRead, bufferSize, buffer, mustFree);
    }
    fBufferRef->SetParent(file);
 
@@ -415,12 +433,13 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
       Int_t curBufferSize = bufferRef->BufferSize();
       if (curBufferSize < len) {
          // Experience shows that giving 5% "wiggle-room" decreases churn.
-         bufferRef->Expand(Int_t(len*1.05));
+         // The content is not needed, so take a fresh block from the pool instead of expanding.
+         ROOT::Internal::RBufferPool::AcquireBuffer(*bufferRef, Int_t(len*1.05));
       }
       bufferRef->Reset();
       result = bufferRef;
    } else {
-      result = new TBufferFile(TBuffer::kRead, len);
+      result = ROOT::Internal::RBufferPool::NewReadBuffer(len);
    }
    result->SetParent(file);
    return result;
@@ -460,6 +479,10 @@ void TBasket::ResetEntryOffset()
 /// it's not found in the cache.
 /// There is a lot of code duplication but it was necesary to assure
 /// the expected behavior when there is no cache.
+/// If the file is read through a memory mapping (see TFile::SetMapReading),
+/// baskets that are not already unzipped by the cache are read directly from
+/// the mapping: an uncompressed basket is then used in place instead of being
+/// copied into the basket buffer.
 
 Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 {
@@ -467,9 +490,13 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       return -1;
    }
 
+   UnmapBuffer();
+
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
+   char *mapped = nullptr;
+   std::shared_ptr<void> mapping;
 
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
@@ -494,7 +521,25 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    // Determine which buffer to use, so that we can avoid a memcpy in case of
    // the basket was not compressed.
    TBuffer* readBufferRef;
-   if (R__unlikely(fBranch->GetCompressionLevel()==0)) {
+   if (fBufferRef && !fBufferAdopted && !TestBit(TBufferFile::kNotDecompressed)) {
+      TVirtualPerfStats* temp = gPerfStats;
+      if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
+      R__LOCKGUARD_IMT(gROOTMutex);  // Lock for parallel TTree I/O
+      mapped = file->GetMappedBuffer(pos, len, mapping);
+      gPerfStats = temp;
+   }
+   if (mapped) {
+      // Read the basket in place; the mapping is private so byte swapping in place is fine.
+      if (fMappedBufferRef) {
+         fMappedBufferRef->SetReadMode();
+         fMappedBufferRef->SetBuffer(mapped, len, kFALSE);
+         fMappedBufferRef->Reset();
+      } else {
+         fMappedBufferRef = new TBufferFile(TBuffer::kRead, len, mapped, kFALSE);
+      }
+      fMappedBufferRef->SetParent(file);
+      readBufferRef = fMappedBufferRef;
+   } else if (R__unlikely(fBranch->GetCompressionLevel()==0)) {
       // Initialize the buffer to hold the uncompressed data.
       fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file);
       readBufferRef = fBufferRef;
@@ -513,7 +558,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       return 1;
    }
 
-   if (pf) {
+   if (mapped) {
+      // Nothing to read, the mapping is used in place.
+   } else if (pf) {
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       Int_t st = 0;
@@ -557,6 +604,15 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 
    rawCompressedBuffer = readBufferRef->Buffer();
 
+   if (mapped && fObjlen+fKeylen == fNbytes && !(OLD_CASE_EXPRESSION)) {
+      // The basket is not compressed: keep our own buffer aside and use the mapped one.
+      std::swap(fBufferRef, fMappedBufferRef);
+      fMapping = std::move(mapping);
+      fBufferMapped = kTRUE;
+      fBuffer = fBufferRef->Buffer();
+      goto AfterBuffer;
+   }
+
    // Are we done?
    if (R__unlikely(readBufferRef == fBufferRef)) // We expect most basket to be compressed.
    {
@@ -713,6 +769,7 @@ Int_t TBasket::ReadBasketBytes(Long64_t pos, TFile *file)
 void TBasket::DisownBuffer()
 {
    fBufferRef = NULL;
+   fBufferAdopted = kFALSE;
 }
 
 
@@ -720,8 +777,35 @@ void TBasket::DisownBuffer()
 /// Adopt a buffer from an external entity
 void TBasket::AdoptBuffer(TBuffer *user_buffer)
 {
+   UnmapBuffer();
    delete fBufferRef;
    fBufferRef = user_buffer;
+   fBufferAdopted = kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop using the file mapping as buffer and give back to the basket its own
+/// buffer (see ReadBasketBuffers).
+
+void TBasket::UnmapBufferImpl()
+{
+   std::swap(fBufferRef, fMappedBufferRef);
+   fBufferMapped = kFALSE;
+   fMapping.reset();
+   fBuffer = fBufferRef->Buffer();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back the memory of the buffers owned by the basket to the buffer pool
+/// (see ROOT::Internal::RBufferPool), before they are deleted.
+
+void TBasket::ReleaseBuffers()
+{
+   UnmapBuffer();
+   if (fBufferRef && !fBufferAdopted)
+      ROOT::Internal::RBufferPool::ReleaseBuffer(*fBufferRef);
+   if (fCompressedBufferRef && fOwnsCompressedBuffer)
+      ROOT::Internal::RBufferPool::ReleaseBuffer(*fCompressedBufferRef);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -732,6 +816,8 @@ void TBasket::AdoptBuffer(TBuffer *user_buffer)
 
 void TBasket::ReadResetBuffer(Int_t basketnumber)
 {
+   UnmapBuffer();
+
    // By default, we don't reallocate.
    fResetAllocation = false;
 #ifdef R__TRACK_BASKET_ALLOC_TIME
@@ -788,7 +874,7 @@ void TBasket::ReadResetBuffer(Int_t basketnumber)
          std::chrono::time_point<std::chrono::system_clock> start, end;
          start = std::chrono::high_resolution_clock::now();
 #endif
-         fBufferRef->Expand(newSize, kFALSE); // Expand without copying the existing data.
+         ROOT::Internal::RBufferPool::AcquireBuffer(*fBufferRef, newSize); // The existing data is not needed.
 #ifdef R__TRACK_BASKET_ALLOC_TIME
          end = std::chrono::high_resolution_clock::now();
          auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -805,6 +891,8 @@ void TBasket::ReadResetBuffer(Int_t basketnumber)
 
 void TBasket::WriteReset()
 {
+   UnmapBuffer();
+
    // By default, we don't reallocate.
    fResetAllocation = false;
 #ifdef R__TRACK_BASKET_ALLOC_TIME
@@ -869,7 +957,7 @@ void TBasket::WriteReset()
       std::chrono::time_point<std::chrono::system_clock> start, end;
       start = std::chrono::high_resolution_clock::now();
 #endif
-      fBufferRef->Expand(newSize,kFALSE);     // Expand without copying the existing data.
+      ROOT::Internal::RBufferPool::AcquireBuffer(*fBufferRef, newSize); // The existing data is not needed.
 #ifdef R__TRACK_BASKET_ALLOC_TIME
       end = std::chrono::high_resolution_clock::now();
       auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -933,6 +1021,7 @@ void TBasket::SetReadMode()
 
 void TBasket::SetWriteMode()
 {
+   UnmapBuffer();
    fBufferRef->SetWriteMode();
    fBufferRef->SetBufferOffset(fLast);
 }
@@ -1209,7 +1298,9 @@ Int_t TBasket::WriteBuffer()
    fObjlen    = lbuf - fKeylen;
 
    fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
+   // The branch may have moved on to its next basket already if this one is written asynchronously.
+   fCycle = fWriteCycle >= 0 ? fWriteCycle : fBranch->GetWriteBasket();
+   fWriteCycle = -1;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
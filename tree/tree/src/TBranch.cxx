@@ -50,6 +50,7 @@
 #include "snprintf.h"
 
 #include "TBranchIMTHelper.h"
+#include "TTreeAsyncWriter.h"
 
 #include "ROOT/TIOFeatures.hxx"
 
@@ -1480,14 +1481,15 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
       // The basket was already in memory and might (and might not) be backed by persistent
       // storage.
       R__ASSERT(result == fReadBasket);
-      if (fBasketSeek[fReadBasket]) {
-         // It is backed, so we can be destructive
+      if (fBasketSeek[fReadBasket] && !basket->fBufferMapped) {
+         // It is backed, so we can be destructive; unless the buffer is a view of the file
+         // mapping, which the user buffer cannot adopt.
          user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
          buf->ResetBit(TBufferIO::kIsOwner);
          fCurrentBasket = nullptr;
          fBaskets[fReadBasket] = nullptr;
       } else {
-         // This is the only copy, we can't return it as is to the user, just make a copy.
+         // This is the only copy or it is mapped, we can't return it as is to the user, just make a copy.
          if (user_buf.BufferSize() < buf->BufferSize()) {
             user_buf.AutoExpand(buf->BufferSize());
          }
@@ -1560,14 +1562,15 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
       // The basket was already in memory and might (and might not) be backed by persistent
       // storage.
       R__ASSERT(result == fReadBasket);
-      if (fBasketSeek[fReadBasket]) {
-         // It is backed, so we can be destructive
+      if (fBasketSeek[fReadBasket] && !basket->fBufferMapped) {
+         // It is backed, so we can be destructive; unless the buffer is a view of the file
+         // mapping, which the user buffer cannot adopt.
          user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
          buf->ResetBit(TBufferIO::kIsOwner);
          fCurrentBasket = nullptr;
          fBaskets[fReadBasket] = nullptr;
       } else {
-         // This is the only copy, we can't return it as is to the user, just make a copy.
+         // This is the only copy or it is mapped, we can't return it as is to the user, just make a copy.
          if (user_buf.BufferSize() < buf->BufferSize()) {
             user_buf.AutoExpand(buf->BufferSize());
          }
@@ -1613,6 +1616,136 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch stores variable-size arrays of a fundamental type
+/// (a leaf with a count leaf or a top-level std::vector) that can be read with
+/// GetBulkEntriesJagged, false otherwise.
+
+Bool_t TBranch::SupportsJaggedBulkRead() const {
+   Int_t headerSize = 0, elementSize = 0;
+   return (fNleaves == 1) &&
+          static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetJaggedLayout(headerSize, elementSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read as many events as possible of a branch storing variable-size arrays
+/// into the given buffer, deserializing the whole basket at once.
+///
+/// Returns -1 in case of a failure.  On success, returns the (non-zero) number of
+/// events N currently in the buffer and fills `offsets` with N+1 values: the
+/// elements of event `i` can be accessed as
+///
+/// static_cast<T*>(buf.GetCurrent())[j], offsets[i] <= j < offsets[i+1]
+///
+/// where T is the type of the array elements stored on this branch.
+///
+/// The per-event headers (if any) are squeezed out of the basket data, so that the
+/// elements of all events are contiguous and no per-event streaming is needed.
+///
+/// Only branches with exactly one leaf are supported: the baskets of branches with
+/// several leaves interleave the values of all leaves entry by entry, so the elements
+/// of one leaf cannot be exposed as a single contiguous array.
+
+Int_t TBranch::GetBulkEntriesJagged(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   if (R__unlikely(fNleaves != 1)) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   Int_t headerSize = 0, elementSize = 0;
+   if (R__unlikely(!leaf->GetJaggedLayout(headerSize, elementSize) || elementSize <= 0)) {return -1;}
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) return -1;
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) {
+      return -1;
+   }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntriesJagged", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntriesJagged", "Basket has displacement.\n");
+      return -1;
+   }
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset)) {
+      Error("GetBulkEntriesJagged", "Basket has no entry offsets.\n");
+      return -1;
+   }
+
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket] && !basket->fBufferMapped) {
+         // It is backed, so we can be destructive; unless the buffer is a view of the file
+         // mapping, which the user buffer cannot adopt.
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy or it is mapped, we can't return it as is to the user, just make a copy.
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   Int_t bufbegin = basket->GetKeylen();
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+
+   // Move the elements of each event right after the ones of the previous event, dropping the
+   // per-event headers; without headers the data is already contiguous and nothing is moved.
+   char *data = user_buf.Buffer();
+   Int_t dest = bufbegin;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   for (Int_t idx = 0; idx < N; idx++) {
+      Int_t begin = entryOffset[idx] + headerSize;
+      Int_t end = (idx + 1 < N) ? entryOffset[idx + 1] : basket->GetLast();
+      Int_t nbytes = end - begin;
+      if (R__unlikely(nbytes < 0 || nbytes % elementSize)) {
+         Error("GetBulkEntriesJagged", "Entry %lld has an unexpected size of %d bytes.\n", first + idx, nbytes);
+         return -1;
+      }
+      if (dest != begin) {
+         memmove(data + dest, data + begin, nbytes);
+      }
+      dest += nbytes;
+      offsets[idx + 1] = (dest - bufbegin) / elementSize;
+   }
+
+   user_buf.SetBufferOffset(bufbegin);
+   if (R__unlikely(!leaf->ReadBasketJagged(user_buf, offsets[N]))) {
+      Error("GetBulkEntriesJagged", "Leaf failed to read.\n");
+      return -1;
+   }
+   user_buf.SetBufferOffset(bufbegin);
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -3088,6 +3221,9 @@ void TBranch::Streamer(TBuffer& b)
 ////////////////////////////////////////////////////////////////////////////////
 /// Write the current basket to disk and return the number of bytes
 /// written to the file.
+///
+/// If the tree writes its baskets asynchronously (see TTree::SetAsyncWrite), the
+/// current basket is queued for writing instead and 0 is returned.
 
 Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
 {
@@ -3100,6 +3236,61 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+   ROOT::Internal::TTreeAsyncWriter *asyncWriter = fTree->GetAsyncWriter();
+   if (asyncWriter && where == fWriteBasket && !basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed)) {
+      // The basket is handed over to the asynchronous writer of the tree and we move on to
+      // the next basket right away: the next Fill creates it. The basket is detached
+      // from the branch as if it was already written; its seek and size are known
+      // only when the writer is done, see `done` below.
+      fBaskets[where] = 0;
+      --fNBaskets;
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = 0;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      // The transient compression buffer is shared with the baskets filled meanwhile.
+      if (!basket->fOwnsCompressedBuffer) basket->fCompressedBufferRef = nullptr;
+      basket->fWriteCycle = where;
+      ++fWriteBasket;
+      if (fWriteBasket >= fMaxBaskets) {
+         ExpandBasketArrays();
+      }
+      fBasketEntry[fWriteBasket] = fEntryNumber;
+
+      auto write = [basket]() { return basket->WriteBuffer(); };
+      // Runs on this thread, from a later TTreeAsyncWriter::Push or Wait.
+      auto done = [=](Int_t nout) {
+         if (nout < 0) Error("TBranch::WriteBasketImpl", "basket's WriteBuffer failed.\n");
+         fBasketBytes[where]  = basket->GetNbytes();
+         fBasketSeek[where]   = basket->GetSeekKey();
+         if (nout>0) {
+            Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+            fZipBytes += nout;
+            fTotBytes += addbytes;
+            fTree->AddTotBytes(addbytes);
+            fTree->AddZipBytes(nout);
+         }
+         TBasket *nextBasket = fWriteBasket < fBaskets.GetSize() ? (TBasket *)fBaskets.UncheckedAt(fWriteBasket) : 0;
+         if (nout > 0 && !nextBasket) {
+            // As in the synchronous case, the written basket is reset, which adapts its size, and reused
+            // as the next basket of the branch unless the next Fill already created one.
+            basket->WriteReset();
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+            fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+            fTree->AddAllocationCount(basket->GetResetAllocationCount());
+            ++fNBaskets;
+            fBaskets.AddAtAndExpand(basket, fWriteBasket);
+         } else {
+            basket->DropBuffers();
+            delete basket;
+         }
+      };
+      asyncWriter->Push(GetFile(TBuffer::kWrite), write, done, basket->GetBufferRef()->BufferSize());
+      return 0;
+   }
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -135,6 +135,12 @@ bool TLeafD::ReadBasketFast(TBuffer &input_buf, Long64_t N) {
    return input_buf.ByteSwapBuffer(fLen*N, kDouble_t);
 }
 
+// Deserialize in place N elements of a variable-size array gathered from the basket.
+bool TLeafD::ReadBasketJagged(TBuffer &input_buf, Long64_t N) {
+   if (R__unlikely(!fLeafCount)) { return false; }
+   return input_buf.ByteSwapBuffer(N, kDouble_t);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
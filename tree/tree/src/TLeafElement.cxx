@@ -19,6 +19,7 @@ a TStreamerInfo (i.e. using TBranchElement).
 #include "TLeafElement.h"
 
 #include "TVirtualStreamerInfo.h"
+#include "TVirtualCollectionProxy.h"
 #include "Bytes.h"
 #include "TBuffer.h"
 
@@ -147,6 +148,68 @@ Bool_t TLeafElement::ReadBasketFast(TBuffer &input_buf, Long64_t N)
    return input_buf.ByteSwapBuffer(fLen*N, type);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// If this leaf is the leaf of a top-level, unsplit std::vector of a fundamental
+/// type, return the type of the elements of the vector; return kOther_t otherwise.
+
+EDataType TLeafElement::GetVectorValueType() const
+{
+   auto branch = static_cast<TBranchElement *>(fBranch);
+   if (branch->GetType() != 0 || branch->GetID() != -1 || branch->GetStreamerType() != -1)
+      return kOther_t;
+
+   TClass *clptr = nullptr;
+   EDataType type = EDataType::kOther_t;
+   if (fBranch->GetExpectedType(clptr, type) || !clptr)
+      return kOther_t;
+   TVirtualCollectionProxy *proxy = clptr->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->HasPointers() || proxy->GetValueClass())
+      return kOther_t;
+
+   switch (proxy->GetType()) {
+      case kChar_t: // fall-through
+      case kUChar_t: // fall-through
+      case kShort_t: // fall-through
+      case kUShort_t: // fall-through
+      case kInt_t: // fall-through
+      case kUInt_t: // fall-through
+      case kFloat_t: // fall-through
+      case kLong64_t: // fall-through
+      case kULong64_t: // fall-through
+      case kDouble_t:
+         return proxy->GetType();
+      default:
+         return kOther_t;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Top-level std::vectors of fundamental types are read in bulk: each entry is
+/// streamed as a byte count (4 bytes), a class version (2 bytes) and the size of
+/// the vector (4 bytes), followed by the elements.
+
+Bool_t TLeafElement::GetJaggedLayout(Int_t &headerSize, Int_t &elementSize) const
+{
+   const EDataType type = GetVectorValueType();
+   if (type == kOther_t)
+      return kFALSE;
+   headerSize = 10;
+   elementSize = TDataType::GetDataType(type)->Size();
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize in place the N elements of a std::vector leaf that were gathered
+/// at the current position of the input buffer.
+
+bool TLeafElement::ReadBasketJagged(TBuffer &input_buf, Long64_t N)
+{
+   const EDataType type = GetVectorValueType();
+   if (type == kChar_t || type == kUChar_t)
+      return true;
+   return input_buf.ByteSwapBuffer(N, type);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns pointer to method corresponding to name name is a string
 /// with the general form "method(list of params)" If list of params is
@@ -139,6 +139,12 @@ bool TLeafF::ReadBasketFast(TBuffer &input_buf, Long64_t N) {
   return input_buf.ByteSwapBuffer(fLen*N, kFloat_t);
 }
 
+// Deserialize in place N elements of a variable-size array gathered from the basket.
+bool TLeafF::ReadBasketJagged(TBuffer &input_buf, Long64_t N) {
+  if (R__unlikely(!fLeafCount)) {return false;}
+  return input_buf.ByteSwapBuffer(N, kFloat_t);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
@@ -190,6 +190,15 @@ bool TLeafI::ReadBasketFast(TBuffer& input_buf, Long64_t N)
    return input_buf.ByteSwapBuffer(fLen*N, kInt_t);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize in place the N elements of a variable-size array leaf that were
+/// gathered at the current position of the input buffer.
+bool TLeafI::ReadBasketJagged(TBuffer& input_buf, Long64_t N)
+{
+   if (R__unlikely(!fLeafCount)) {return false;}
+   return input_buf.ByteSwapBuffer(N, kInt_t);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
@@ -201,6 +201,15 @@ bool TLeafL::ReadBasketFast(TBuffer& input_buf, Long64_t N)
    return input_buf.ByteSwapBuffer(fLen*N, kLong64_t);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize in place the N elements of a variable-size array leaf that were
+/// gathered at the current position of the input buffer.
+bool TLeafL::ReadBasketJagged(TBuffer& input_buf, Long64_t N)
+{
+   if (R__unlikely(!fLeafCount)) {return false;}
+   return input_buf.ByteSwapBuffer(N, kLong64_t);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
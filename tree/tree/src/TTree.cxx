@@ -420,6 +420,7 @@ End_Macro
 #include "snprintf.h"
 
 #include "TBranchIMTHelper.h"
+#include "TTreeAsyncWriter.h"
 #include "TNotifyLink.h"
 
 #include <chrono>
@@ -910,6 +911,9 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   // The pending baskets update our branches when they are written.
+   delete fAsyncWriter;
+   fAsyncWriter = nullptr;
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1492,6 +1496,7 @@ Long64_t TTree::AutoSave(Option_t* option)
       if (gDebug > 0) Info("AutoSave", "calling FlushBaskets \n");
       FlushBasketsImpl();
    }
+   WaitAsyncWrites();
 
    fSavedBytes = GetZipBytes();
 
@@ -4550,7 +4555,8 @@ Int_t TTree::Fill()
       fBranchRef->Clear();
 
 #ifdef R__USE_IMT
-   const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
+   // With asynchronous writing, the full baskets are compressed in parallel by the writer instead.
+   const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled && !fAsyncWriter;
    ROOT::Internal::TBranchIMTHelper imtHelper;
    if (useIMT) {
       fIMTFlush = true;
@@ -4637,6 +4643,7 @@ Int_t TTree::Fill()
          if (autoFlush || autoSave) {
             // First call FlushBasket to make sure that fTotBytes is up to date.
             FlushBasketsImpl();
+            WaitAsyncWrites();
             autoFlush = false; // avoid auto flushing again later
 
             // When we are in one-basket-per-cluster mode, there is no need to optimize basket:
@@ -5058,6 +5065,7 @@ Int_t TTree::FlushBaskets(Bool_t create_cluster) const
 {
     Int_t retval = FlushBasketsImpl();
     if (retval == -1) return retval;
+    if (WaitAsyncWrites()) return -1;
 
     if (create_cluster) const_cast<TTree *>(this)->MarkEventCluster();
     return retval;
@@ -5080,7 +5088,9 @@ Int_t TTree::FlushBasketsImpl() const
    Int_t nb = lb->GetEntriesFast();
 
 #ifdef R__USE_IMT
-   const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
+   // With asynchronous writing, the branches queue their baskets one after the other: the
+   // writer compresses them in parallel.
+   const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled && !fAsyncWriter;
    if (useIMT) {
       // ROOT-9668: here we need to check if the size of fSortedBranches is different from the
       // size of the list of branches before triggering the initialisation of the fSortedBranches
@@ -5148,6 +5158,16 @@ Int_t TTree::FlushBasketsImpl() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until the baskets queued by the asynchronous writing (see SetAsyncWrite)
+/// are on disk and the branches are updated accordingly.
+/// Return the number of baskets which failed to be written since the previous call.
+
+Int_t TTree::WaitAsyncWrites() const
+{
+   return fAsyncWriter ? fAsyncWriter->Wait() : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the expanded value of the alias.  Search in the friends if any.
 
@@ -5554,6 +5574,8 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
    if (kGetEntry & fFriendLockStatus) return 0;
 
    if (entry < 0 || entry >= fEntries) return 0;
+   // Baskets still queued for writing cannot be read back.
+   WaitAsyncWrites();
    Int_t i;
    Int_t nbytes = 0;
    fReadEntry = entry;
@@ -6392,6 +6414,9 @@ Long64_t TTree::LoadTree(Long64_t entry)
       return -1;
    }
 
+   // Baskets still queued for writing cannot be read back.
+   WaitAsyncWrites();
+
    // create cache if wanted
    if (fCacheDoAutoInit && entry >=0)
       SetCacheSizeAux();
@@ -7883,6 +7908,7 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+   WaitAsyncWrites();
    fNotify        = 0;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -7914,6 +7940,7 @@ void TTree::Reset(Option_t* option)
 
 void TTree::ResetAfterMerge(TFileMergeInfo *info)
 {
+   WaitAsyncWrites();
    fEntries       = 0;
    fNClusterRange = 0;
    fTotBytes      = 0;
@@ -8036,6 +8063,59 @@ Bool_t TTree::SetAlias(const char* aliasName, const char* aliasFormula)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of bytes of baskets queued for asynchronous
+/// writing, or 0 if the baskets are written synchronously (see SetAsyncWrite).
+
+Long64_t TTree::GetAsyncWrite() const
+{
+   return fAsyncWriter ? fAsyncWriter->GetBudget() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable the asynchronous writing of the baskets of this tree.
+///
+/// The baskets filled by TTree::Fill, including those written at the end of an
+/// event cluster, are then compressed and written to the file asynchronously, so
+/// that the thread filling the tree does not wait for the compression and the
+/// disk. If implicit multi-threading is enabled, the baskets are compressed in
+/// parallel by tasks of the IMT pool; otherwise they are compressed and written
+/// by a dedicated thread. At most maxBytesInFlight bytes of (uncompressed) baskets
+/// are queued: beyond this budget, Fill waits for the writes to catch up, and
+/// runs the pending IMT tasks itself meanwhile.
+/// A value of 0 writes out the queued baskets and disables the asynchronous writing.
+///
+/// The sizes and positions of the baskets are updated as they reach the file: the
+/// values returned by GetZipBytes or GetTotBytes lag behind until FlushBaskets,
+/// AutoSave or Write, which wait for all the queued baskets. The failures of
+/// the asynchronous writes are reported by the return value of FlushBaskets.
+///
+/// \note Nothing else must be written to the file of the tree while baskets are
+///       queued: call FlushBaskets or Write before writing other objects to the
+///       file. TFile::Close waits for the queued baskets by itself.
+///
+/// \note This requires ROOT to be built with implicit multi-threading support
+///       (imt=ON), which provides the locking of the file by the writing threads.
+///       Calling this function enables ROOT's thread safety.
+
+void TTree::SetAsyncWrite(Long64_t maxBytesInFlight)
+{
+   if (fAsyncWriter) {
+      if (fAsyncWriter->GetBudget() == maxBytesInFlight)
+         return;
+      delete fAsyncWriter; // writes the queued baskets
+      fAsyncWriter = nullptr;
+   }
+   if (maxBytesInFlight <= 0)
+      return;
+#ifdef R__USE_IMT
+   ROOT::EnableThreadSafety();
+   fAsyncWriter = new ROOT::Internal::TTreeAsyncWriter(maxBytesInFlight);
+#else
+   Warning("SetAsyncWrite", "ROOT was built without implicit multi-threading support, the baskets of %s are written synchronously.", GetName());
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This function may be called at the start of a program to change
 /// the default value for fAutoFlush.
@@ -8581,6 +8661,10 @@ Int_t TTree::SetCacheSizeAux(Bool_t autocache /* = kTRUE */, Long64_t cacheSize
 
    // Check for an existing cache
    TTreeCache* pf = GetReadCache(file);
+   if (!pf && autocache && file->IsReadMapped()) {
+      // The baskets of a mapped file are read from memory, prefetching them would only add a copy.
+      return 0;
+   }
    if (pf) {
       if (autocache) {
          // reset our cache status tracking in case existing cache was added
@@ -8802,6 +8886,7 @@ void TTree::SetDirectory(TDirectory* dir)
    if (fDirectory == dir) {
       return;
    }
+   WaitAsyncWrites();
    if (fDirectory) {
       fDirectory->Remove(this);
 
@@ -9572,6 +9657,7 @@ void TTree::UseCurrentStyle()
 Int_t TTree::Write(const char *name, Int_t option, Int_t bufsize) const
 {
    FlushBasketsImpl();
+   WaitAsyncWrites();
    return TObject::Write(name, option, bufsize);
 }
 
@@ -0,0 +1,177 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TTreeAsyncWriter.h"
+
+#include "TFile.h"
+#include "TROOT.h"
+
+#include <utility>
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the writer. At most `budget` bytes of baskets are queued at once.
+
+TTreeAsyncWriter::TTreeAsyncWriter(Long64_t budget) : fBudget(budget) {}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the pending baskets and stop the writer thread.
+
+TTreeAsyncWriter::~TTreeAsyncWriter()
+{
+   Wait();
+   if (!fThread.joinable())
+      return;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = true;
+   }
+   fQueueCv.notify_one();
+   fThread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queue a basket for writing to `file`: `write` runs asynchronously and its
+/// return value is passed to `done`, which runs on the calling thread during a
+/// later call to Push or Wait. `nbytes` is the memory held by the basket: if it
+/// does not fit in the budget, wait for the pending writes to catch up first.
+
+void TTreeAsyncWriter::Push(TFile *file, WriteFunc_t &&write, DoneFunc_t &&done, Long64_t nbytes)
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   if (file != fFile) {
+      // The baskets of the previous file are all written before moving on to this one.
+      lock.unlock();
+      Wait();
+      if (file)
+         file->AddAsyncWriter(this, [](void *writer) { static_cast<TTreeAsyncWriter *>(writer)->Wait(); });
+      lock.lock();
+      fFile = file;
+   }
+   Complete(lock);
+   // A basket larger than the whole budget is queued once nothing else is in flight.
+   while (fBytesInFlight > 0 && fBytesInFlight + nbytes > fBudget) {
+      WaitWritten(lock);
+      Complete(lock);
+   }
+   TJob job{std::move(write), std::move(done), nbytes, 0};
+   fBytesInFlight += nbytes;
+   ++fNpending;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && ROOT::GetThreadPoolSize() > 1) {
+      ++fNtasks;
+      lock.unlock();
+      if (!fTasks)
+         fTasks.reset(new ROOT::Experimental::TTaskGroup());
+      fTasks->Run([this, job]() mutable {
+         job.fNout = job.fWrite();
+         std::lock_guard<std::mutex> guard(fMutex);
+         --fNtasks;
+         Written(std::move(job));
+      });
+      return;
+   }
+#endif
+   if (!fThread.joinable())
+      fThread = std::thread([this]() { Run(); });
+   fQueue.push_back(std::move(job));
+   lock.unlock();
+   fQueueCv.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until all the queued baskets are written and run their completions.
+/// Return the number of failed writes since the previous call.
+
+Int_t TTreeAsyncWriter::Wait()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (fNpending > 0) {
+      WaitWritten(lock);
+      Complete(lock);
+   }
+   Int_t nerrors = fNerrors;
+   fNerrors = 0;
+   TFile *file = fFile;
+   fFile = nullptr;
+   lock.unlock();
+   if (file)
+      file->RemoveAsyncWriter(this);
+   return nerrors;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hand a written job over to its completion; must be called with fMutex held.
+
+void TTreeAsyncWriter::Written(TJob &&job)
+{
+   if (job.fNout < 0)
+      ++fNerrors;
+   fBytesInFlight -= job.fBytes;
+   fDone.push_back(std::move(job));
+   fDoneCv.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the completions of the written baskets; `lock` is released while they run.
+
+void TTreeAsyncWriter::Complete(std::unique_lock<std::mutex> &lock)
+{
+   while (!fDone.empty()) {
+      TJob job = std::move(fDone.front());
+      fDone.pop_front();
+      --fNpending;
+      lock.unlock();
+      job.fDone(job.fNout);
+      lock.lock();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until at least one more job is written. If IMT tasks are pending, this
+/// thread helps running them instead of blocking, which cannot deadlock even if
+/// the tree is filled from a task of the IMT pool itself.
+
+void TTreeAsyncWriter::WaitWritten(std::unique_lock<std::mutex> &lock)
+{
+#ifdef R__USE_IMT
+   if (fDone.empty() && fNtasks > 0) {
+      lock.unlock();
+      fTasks->Wait();
+      lock.lock();
+      return;
+   }
+#endif
+   fDoneCv.wait(lock, [this]() { return !fDone.empty(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Body of the writer thread.
+
+void TTreeAsyncWriter::Run()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fQueueCv.wait(lock, [this]() { return fStop || !fQueue.empty(); });
+      if (fQueue.empty())
+         return;
+      TJob job = std::move(fQueue.front());
+      fQueue.pop_front();
+      lock.unlock();
+      job.fNout = job.fWrite();
+      lock.lock();
+      Written(std::move(job));
+   }
+}
+
+} // Internal
+} // ROOT
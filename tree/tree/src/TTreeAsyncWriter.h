@@ -0,0 +1,93 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeAsyncWriter
+#define ROOT_TTreeAsyncWriter
+
+#include "RtypesCore.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class TFile;
+
+namespace ROOT {
+namespace Internal {
+
+/// A helper class running the compression and the writing of the baskets of a
+/// TTree asynchronously (see TTree::SetAsyncWrite).
+///
+/// If implicit multi-threading is enabled, each basket is compressed and written
+/// by a task of the IMT pool, so that the baskets are compressed in parallel and
+/// only their writes are serialized by the file. Otherwise the baskets are
+/// compressed and written one after the other by a dedicated thread.
+///
+/// Only the write itself runs asynchronously: the completion of each job, which
+/// updates the bookkeeping of the branch, runs on the thread filling the tree,
+/// from Push or Wait. While baskets are in flight, the writer is registered with
+/// their file, so that TFile::Close waits for them before writing the keys.
+class TTreeAsyncWriter {
+public:
+   using WriteFunc_t = std::function<Int_t()>;
+   using DoneFunc_t = std::function<void(Int_t)>;
+
+   explicit TTreeAsyncWriter(Long64_t budget);
+   TTreeAsyncWriter(const TTreeAsyncWriter &) = delete;
+   TTreeAsyncWriter &operator=(const TTreeAsyncWriter &) = delete;
+   ~TTreeAsyncWriter();
+
+   void Push(TFile *file, WriteFunc_t &&write, DoneFunc_t &&done, Long64_t nbytes);
+   Int_t Wait();
+
+   Long64_t GetBudget() const { return fBudget; }
+
+private:
+   struct TJob {
+      WriteFunc_t fWrite;
+      DoneFunc_t fDone;
+      Long64_t fBytes;
+      Int_t fNout;
+   };
+
+   void Run();
+   void Written(TJob &&job);
+   void Complete(std::unique_lock<std::mutex> &lock);
+   void WaitWritten(std::unique_lock<std::mutex> &lock);
+
+   const Long64_t fBudget;          ///< Maximum number of bytes of baskets queued or being written.
+   Long64_t fBytesInFlight{0};      ///< Number of bytes of baskets queued or being written.
+   Int_t fNpending{0};              ///< Number of jobs pushed and not completed yet.
+   Int_t fNerrors{0};               ///< Number of failed writes since the last Wait.
+   Int_t fNtasks{0};                ///< Number of jobs run by IMT tasks and not written yet.
+   TFile *fFile{nullptr};           ///< File the pending baskets are written to, if registered with it.
+   bool fStop{false};               ///< Tells the writer thread to exit.
+   std::deque<TJob> fQueue;         ///< Jobs waiting to be written.
+   std::deque<TJob> fDone;          ///< Jobs written, waiting for their completion.
+   std::mutex fMutex;               ///< Protects all of the above.
+   std::condition_variable fQueueCv; ///< Signals new jobs to the writer thread.
+   std::condition_variable fDoneCv;  ///< Signals written jobs to the filling thread.
+   std::thread fThread;             ///< The writer thread, started by the first job not run by an IMT task.
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> fTasks; ///< The IMT tasks writing the baskets.
+#endif
+};
+
+} // Internal
+} // ROOT
+
+#endif
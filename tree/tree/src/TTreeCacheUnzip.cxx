@@ -27,6 +27,7 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "ROOT/RBufferPool.hxx"
 #include "ROOT/RMakeUnique.hxx"
 
 #ifdef R__USE_IMT
@@ -549,20 +550,14 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    }
 
    // Prepare a memory buffer of adequate size
-   char* locbuff = 0;
-   if (rdlen > 16384) {
-      locbuff = new char[rdlen];
-   } else if (rdlen * 3 < 16384) {
-      locbuff = new char[rdlen * 2];
-   } else {
-      locbuff = new char[16384];
-   }
+   Int_t locbuffSize = 0;
+   char *locbuff = ROOT::Internal::RBufferPool::Acquire(rdlen, locbuffSize);
 
    readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
 
    if (readbuf <= 0) {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      if (locbuff) delete [] locbuff;
+      ROOT::Internal::RBufferPool::Release(locbuff, locbuffSize);
       return -1;
    }
 
@@ -578,7 +573,7 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
                    Info("UnzipCache", "Block %d is too big, skipping.", index);
 
            fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-           if (locbuff) delete [] locbuff;
+           ROOT::Internal::RBufferPool::Release(locbuff, locbuffSize);
            return 0;
    }
 
@@ -588,7 +583,7 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    if ((loclen > 0) && (loclen == objlen + keylen)) {
       if ((myCycle != fCycle) || !fIsTransferred) {
          fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-         if (locbuff) delete [] locbuff;
+         ROOT::Internal::RBufferPool::Release(locbuff, locbuffSize);
          return 1;
       }
       fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
@@ -597,7 +592,7 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
    }
 
-   if (locbuff) delete [] locbuff;
+   ROOT::Internal::RBufferPool::Release(locbuff, locbuffSize);
    return 0;
 }
 
@@ -707,7 +702,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                   *free = kTRUE;
                } else {
                   memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), fUnzipState.fUnzipLen[seekidx]);
-                  fUnzipState.fUnzipChunks[seekidx].reset();
+                  ROOT::Internal::RBufferPool::Release(fUnzipState.fUnzipChunks[seekidx].release(),
+                                                       fUnzipState.fUnzipLen[seekidx]);
                   *free = kFALSE;
                }
 
@@ -756,7 +752,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                *free = kTRUE;
             } else {
                memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), fUnzipState.fUnzipLen[seekidx]);
-               fUnzipState.fUnzipChunks[seekidx].reset();
+               ROOT::Internal::RBufferPool::Release(fUnzipState.fUnzipChunks[seekidx].release(),
+                                                    fUnzipState.fUnzipLen[seekidx]);
                *free = kFALSE;
             }
 
@@ -843,13 +840,16 @@ void TTreeCacheUnzip::SetUnzipBufferSize(Long64_t bufferSize)
 /// returns the size of the inflated buffer or -1 if error
 /// Note!! : If *dest == 0 we will allocate the buffer and it will be the
 /// responsability of the caller to free it... it is useful for example
-/// to pass it to the creator of TBuffer
+/// to pass it to the creator of TBuffer. The buffer is taken from the
+/// buffer pool (see ROOT::Internal::RBufferPool::Acquire) and can be given
+/// back to it.
 /// src is the original buffer with the record (header+compressed data)
 /// *dest is the inflated buffer (including the header)
 
 Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
 {
    Int_t  uzlen = 0;
+   Int_t  destSize = 0;
    Bool_t alloc = kFALSE;
 
    // Here we read the header of the buffer
@@ -867,7 +867,7 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
          return uzlen;
       }
       Int_t l = keylen + objlen;
-      *dest = new char[l];
+      *dest = ROOT::Internal::RBufferPool::Acquire(l, destSize);
       alloc = kTRUE;
    }
    // Must unzip the buffer
@@ -925,7 +925,7 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
          Error("UnzipBuffer", "nbytes = %d, keylen = %d, objlen = %d, noutot = %d, nout=%d, nin=%d, nbuf=%d",
                nbytes,keylen,objlen, noutot,nout,nin,nbuf);
          uzlen = -1;
-         if(alloc) delete [] *dest;
+         if (alloc) ROOT::Internal::RBufferPool::Release(*dest, destSize);
          *dest = 0;
          return uzlen;
       }
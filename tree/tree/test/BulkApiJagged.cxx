@@ -0,0 +1,137 @@
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "ROOT/TTreeReaderFast.hxx"
+#include "ROOT/TTreeReaderValueFast.hxx"
+#include "ROOT/TTreeReaderArrayFast.hxx"
+#include "ROOT/TIOFeatures.hxx"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+class BulkApiJaggedTest : public ::testing::Test {
+public:
+   static constexpr Long64_t fClusterSize = 1e4;
+   static constexpr Long64_t fEventCount = 1e5;
+   const std::string fFileName = "BulkApiTestJagged.root";
+   // "T" stores the entry offsets of its baskets, "TGen" generates them from the count leaf when reading.
+   const std::vector<std::string> fTreeNames = {"T", "TGen"};
+
+protected:
+   void SetUp() override
+   {
+      TFile hfile(fFileName.c_str(), "RECREATE");
+      hfile.SetCompressionLevel(0); // No compression at all.
+
+      for (const auto &treeName : fTreeNames) {
+         TTree tree(treeName.c_str(), "A ROOT tree of variable-length branches.");
+         tree.SetAutoFlush(fClusterSize);
+         if (treeName == "TGen") {
+            ROOT::TIOFeatures features;
+            features.Set(ROOT::Experimental::EIOFeatures::kGenerateOffsetMap);
+            tree.SetIOFeatures(features);
+         }
+
+         int n = 0;
+         float f[10];
+         int i[10];
+         std::vector<double> v;
+         tree.Branch("n", &n, "n/I");
+         tree.Branch("f", &f, "f[n]/F");
+         tree.Branch("i", &i, "i[n]/I");
+         tree.Branch("v", &v);
+
+         float counter = 0;
+         for (Long64_t ev = 0; ev < fEventCount; ev++) {
+            n = ev % 10;
+            v.clear();
+            for (int idx = 0; idx < n; idx++) {
+               f[idx] = counter;
+               i[idx] = counter;
+               v.push_back(2 * counter);
+               counter++;
+            }
+            tree.Fill();
+         }
+         tree.Write();
+      }
+   }
+
+   void TearDown() override { gSystem->Unlink(fFileName.c_str()); }
+};
+
+constexpr Long64_t BulkApiJaggedTest::fClusterSize;
+constexpr Long64_t BulkApiJaggedTest::fEventCount;
+
+template <typename T>
+void CheckJaggedBranch(TBranch *branch, T factor)
+{
+   ASSERT_TRUE(branch->GetBulkRead().SupportsJaggedBulkRead());
+
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> offsets;
+   Long64_t evt_idx = 0;
+   T expected = 0;
+   while (evt_idx < BulkApiJaggedTest::fEventCount) {
+      auto count = branch->GetBulkRead().GetBulkEntriesJagged(evt_idx, buf, offsets);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(offsets.size(), static_cast<std::size_t>(count + 1));
+      auto values = reinterpret_cast<T *>(buf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         ASSERT_EQ(offsets[idx + 1] - offsets[idx], (evt_idx + idx) % 10);
+         for (Int_t elem = offsets[idx]; elem < offsets[idx + 1]; elem++) {
+            ASSERT_EQ(values[elem], factor * expected);
+            expected++;
+         }
+      }
+      evt_idx += count;
+   }
+   EXPECT_EQ(evt_idx, BulkApiJaggedTest::fEventCount);
+}
+
+TEST_F(BulkApiJaggedTest, BulkEntriesJagged)
+{
+   TFile hfile(fFileName.c_str());
+   for (const auto &treeName : fTreeNames) {
+      auto tree = hfile.Get<TTree>(treeName.c_str());
+      ASSERT_TRUE(tree);
+      EXPECT_FALSE(tree->GetBranch("n")->GetBulkRead().SupportsJaggedBulkRead());
+
+      CheckJaggedBranch<float>(tree->GetBranch("f"), 1.f);
+      CheckJaggedBranch<int>(tree->GetBranch("i"), 1);
+      CheckJaggedBranch<double>(tree->GetBranch("v"), 2.);
+   }
+}
+
+TEST_F(BulkApiJaggedTest, TTreeReaderFast)
+{
+   TFile hfile(fFileName.c_str());
+   for (const auto &treeName : fTreeNames) {
+      ROOT::Experimental::TTreeReaderFast myReader(treeName.c_str(), &hfile);
+      ROOT::Experimental::TTreeReaderValueFast<Int_t> myN(myReader, "n");
+      ROOT::Experimental::TTreeReaderArrayFast<float> myF(myReader, "f");
+      ROOT::Experimental::TTreeReaderArrayFast<double> myV(myReader, "v");
+      myReader.SetEntry(0);
+      ASSERT_EQ(myReader.GetEntryStatus(), TTreeReader::kEntryValid);
+
+      Long64_t ev = 0;
+      float expected = 0;
+      for (auto reader_idx : myReader) {
+         ASSERT_EQ(reader_idx, ev);
+         ASSERT_EQ(*myN, ev % 10);
+         ASSERT_EQ(myF.size(), static_cast<std::size_t>(ev % 10));
+         ASSERT_EQ(myV.size(), static_cast<std::size_t>(ev % 10));
+         for (std::size_t idx = 0; idx < myF.size(); idx++) {
+            ASSERT_EQ(myF[idx], expected);
+            ASSERT_EQ(myV[idx], 2. * expected);
+            expected++;
+         }
+         ev++;
+      }
+      EXPECT_EQ(ev, fEventCount);
+   }
+}
@@ -5,6 +5,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +30,88 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, asyncWrite)
+{
+   const auto ofileName = "asyncWrite.root";
+   const Long64_t nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      // A budget of a few baskets, so that Fill has to wait for the writer thread.
+      t.SetAsyncWrite(100000);
+      EXPECT_EQ(t.GetAsyncWrite(), 100000);
+      t.SetAutoFlush(10000);
+      int i = 0;
+      std::vector<double> v;
+      t.Branch("i", &i);
+      t.Branch("v", &v);
+      for (Long64_t e = 0; e < nEntries; ++e) {
+         i = e;
+         v.assign(e % 10, e);
+         t.Fill();
+      }
+      EXPECT_GE(t.FlushBaskets(), 0);
+      EXPECT_GT(t.GetZipBytes(), 0);
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_TRUE(t != nullptr);
+   ASSERT_EQ(t->GetEntries(), nEntries);
+   int i = -1;
+   std::vector<double> *v = nullptr;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("v", &v);
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      ASSERT_EQ(i, e);
+      ASSERT_EQ(v->size(), std::size_t(e % 10));
+      for (auto x : *v)
+         ASSERT_EQ(x, e);
+   }
+   t->ResetBranchAddresses();
+   delete v;
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, asyncWriteClose)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "asyncWriteClose.root";
+   const Long64_t nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      auto t = new TTree("t", "t");
+      t->SetAsyncWrite(100000);
+      t->SetAutoFlush(1000);
+      int i = 0;
+      t->Branch("i", &i);
+      for (Long64_t e = 0; e < nEntries; ++e) {
+         i = e;
+         t->Fill();
+         if (e == nEntries / 2)
+            t->AutoSave();
+      }
+      // Baskets are still queued: closing the file must write them before the keys.
+      f.Close();
+   }
+   ROOT::DisableImplicitMT();
+
+   TFile f(ofileName);
+   EXPECT_FALSE(f.TestBit(TFile::kRecovered));
+   EXPECT_EQ(f.GetSize(), f.GetEND());
+   auto t = f.Get<TTree>("t");
+   ASSERT_TRUE(t != nullptr);
+   ASSERT_EQ(t->GetEntries(), nEntries / 2 + 1);
+   int i = -1;
+   t->SetBranchAddress("i", &i);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      ASSERT_EQ(i, e);
+   }
+   t->ResetBranchAddresses();
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
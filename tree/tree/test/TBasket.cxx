@@ -2,9 +2,12 @@
 #include "ROOT/TIOFeatures.hxx"
 #include "TBasket.h"
 #include "TBranch.h"
+#include "TBufferFile.h"
 #include "TEnum.h"
 #include "TEnumConstant.h"
+#include "TFile.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
@@ -403,3 +406,118 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+// Restores the default of TFile::SetMapReading even if an assertion fails.
+struct MapReadingRAII {
+   MapReadingRAII() { TFile::SetMapReading(kTRUE); }
+   ~MapReadingRAII() { TFile::SetMapReading(kFALSE); }
+};
+
+TEST(TBasket, MappedRead)
+{
+   const char *fileName = "tbasket_mapped_test.root";
+   for (Int_t compress : {0, 101}) {
+      {
+         TFile f(fileName, "RECREATE", "", compress);
+         ASSERT_FALSE(f.IsZombie());
+         TTree t1("t1", "Simple tree for testing.");
+         Int_t idx;
+         Int_t elem;
+         Double_t sample[10];
+         t1.Branch("idx", &idx, "idx/I", 1000);
+         t1.Branch("elem", &elem, "elem/I", 1000);
+         t1.Branch("sample", &sample, "sample[elem]/D", 1000);
+         for (idx = 0; idx < 100 * gSampleEvents; idx++) {
+            elem = idx % 9;
+            for (Int_t idx2 = 0; idx2 < elem; idx2++)
+               sample[idx2] = idx + idx2;
+            t1.Fill();
+         }
+         t1.Write();
+      }
+
+      // Without a user cache, no TTreeCache is created for a mapped file; with one, the baskets
+      // that it did not unzip are still read from the mapping.
+      for (Bool_t userCache : {kFALSE, kTRUE}) {
+         MapReadingRAII mapReading;
+         TFile f(fileName);
+         EXPECT_TRUE(f.IsReadMapped());
+         TTree *tree = nullptr;
+         f.GetObject("t1", tree);
+         ASSERT_NE(tree, nullptr);
+         if (userCache)
+            tree->SetCacheSize(10000000);
+         Int_t saved_idx;
+         Int_t saved_elem;
+         Double_t saved_sample[10];
+         tree->SetBranchAddress("idx", &saved_idx);
+         tree->SetBranchAddress("elem", &saved_elem);
+         tree->SetBranchAddress("sample", &saved_sample);
+         EXPECT_EQ(tree->GetEntries(), 100 * gSampleEvents);
+         for (Long64_t idx = 0; idx < tree->GetEntries(); idx++) {
+            tree->GetEntry(idx);
+            ASSERT_EQ(saved_idx, idx);
+            ASSERT_EQ(saved_elem, idx % 9);
+            for (Int_t idx2 = 0; idx2 < saved_elem; idx2++)
+               ASSERT_EQ(saved_sample[idx2], idx + idx2);
+         }
+         EXPECT_EQ(tree->GetReadCache(&f) != nullptr, userCache);
+
+         if (compress == 0) {
+            // Uncompressed baskets are used in place
+            TBranch *branch = tree->GetBranch("idx");
+            const Int_t last = branch->GetWriteBasket() - 1;
+            tree->GetEntry(branch->GetBasketEntry()[last]);
+            TBasket *basket = branch->GetBasket(last);
+            ASSERT_NE(basket, nullptr);
+            std::shared_ptr<void> mapping;
+            char *mapped = f.GetMappedBuffer(branch->GetBasketSeek(last), branch->GetBasketBytes()[last], mapping);
+            ASSERT_NE(mapped, nullptr);
+            EXPECT_EQ(basket->GetBufferRef()->Buffer(), mapped);
+         }
+      }
+   }
+   gSystem->Unlink(fileName);
+}
+
+TEST(TBasket, MappedBulkRead)
+{
+   const char *fileName = "tbasket_mapped_bulk_test.root";
+   for (Int_t compress : {0, 101}) {
+      {
+         TFile f(fileName, "RECREATE", "", compress);
+         ASSERT_FALSE(f.IsZombie());
+         TTree t1("t1", "Simple tree for testing.");
+         Int_t idx;
+         t1.Branch("idx", &idx, "idx/I", 1000);
+         for (idx = 0; idx < 100 * gSampleEvents; idx++)
+            t1.Fill();
+         t1.Write();
+      }
+
+      MapReadingRAII mapReading;
+      TFile f(fileName);
+      TTree *tree = nullptr;
+      f.GetObject("t1", tree);
+      ASSERT_NE(tree, nullptr);
+      Int_t saved_idx;
+      tree->SetBranchAddress("idx", &saved_idx);
+      TBranch *branch = tree->GetBranch("idx");
+      TBufferFile buf(TBuffer::kWrite, 10000);
+      Long64_t entry = 0;
+      while (entry < tree->GetEntries()) {
+         // The basket is first read for GetEntry, possibly in place from the mapping, then handed
+         // to the bulk read, which must not adopt the mapped memory.
+         ASSERT_GT(tree->GetEntry(entry), 0);
+         ASSERT_EQ(saved_idx, entry);
+         auto count = branch->GetBulkRead().GetBulkEntries(entry, buf);
+         ASSERT_GT(count, 0);
+         auto values = reinterpret_cast<Int_t *>(buf.GetCurrent());
+         for (Int_t i = 0; i < count; ++i)
+            ASSERT_EQ(values[i], entry + i);
+         entry += count;
+      }
+      tree->ResetBranchAddresses();
+   }
+   gSystem->Unlink(fileName);
+}
@@ -26,6 +26,7 @@
 #include "ROOT/TThreadExecutor.hxx"
 
 #include <functional>
+#include <limits>
 #include <utility> // std::pair
 #include <vector>
 
@@ -88,6 +89,10 @@ private:
    /// User-defined selection of entry numbers to be processed, empty if none was provided
    TEntryList fEntryList;
    const Internal::FriendInfo fFriendInfo;
+   /// Interval [begin, end) of global entry numbers to process, only meaningful if fHasGlobalRange is true
+   const std::pair<Long64_t, Long64_t> fGlobalRange{0ll, std::numeric_limits<Long64_t>::max()};
+   /// If true, clusters are computed with global entry numbers and clipped to fGlobalRange
+   const bool fHasGlobalRange = false;
    ROOT::TThreadExecutor fPool; ///<! Thread pool for processing.
 
    /// Thread-local TreeViews
@@ -104,7 +109,10 @@ public:
    TTreeProcessorMT(const std::vector<std::string_view> &filenames, std::string_view treename = "",
                     UInt_t nThreads = 0u);
    TTreeProcessorMT(TTree &tree, const TEntryList &entries, UInt_t nThreads = 0u);
+   TTreeProcessorMT(TTree &tree, const TEntryList &entries, UInt_t nThreads,
+                    const std::pair<Long64_t, Long64_t> &globalRange);
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u);
+   TTreeProcessorMT(TTree &tree, UInt_t nThreads, const std::pair<Long64_t, Long64_t> &globalRange);
 
    void Process(std::function<void(TTreeReader &)> func);
 
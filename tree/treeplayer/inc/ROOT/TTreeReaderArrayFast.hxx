@@ -0,0 +1,82 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeReaderArrayFast
+#define ROOT_TTreeReaderArrayFast
+
+
+////////////////////////////////////////////////////////////////////////////
+//                                                                        //
+// TTreeReaderArrayFast                                                   //
+//                                                                        //
+// Read variable-size arrays of fundamental types with TTreeReaderFast.   //
+//                                                                        //
+//                                                                        //
+////////////////////////////////////////////////////////////////////////////
+
+#include "ROOT/TTreeReaderValueFast.hxx"
+
+#include "TLeaf.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+/// Reads a branch storing a variable-size array of T per event: a leaf with a
+/// count leaf (e.g. `f[n]/F`) or a top-level `std::vector<T>`.
+///
+/// Whole baskets are deserialized at once through TBulkBranchRead::GetBulkEntriesJagged;
+/// the elements of the current event are accessed in place, without copies.
+template <typename T>
+class TTreeReaderArrayFast final : public ROOT::Experimental::Internal::TTreeReaderValueFastBase {
+
+   public:
+
+      TTreeReaderArrayFast(TTreeReaderFast& tr, const std::string &branchname) :
+            TTreeReaderValueFastBase(&tr, branchname) {}
+
+      // Elements of the current event.
+      T* data() { return reinterpret_cast<T*>(fBuffer.GetCurrent()) + fOffsets[fFirstEvent + fEvtIndex]; }
+      std::size_t size() const { return fOffsets[fFirstEvent + fEvtIndex + 1] - fOffsets[fFirstEvent + fEvtIndex]; }
+      bool empty() const { return size() == 0; }
+      T& operator[](std::size_t idx) { return data()[idx]; }
+      T* begin() { return data(); }
+      T* end() { return data() + size(); }
+
+   protected:
+      virtual const char *GetTypeName() override {return "array";}
+      virtual const char *BranchTypeName() override {return "array";}
+      virtual UInt_t GetSize() override {return sizeof(T);}
+
+      virtual Int_t FillBuffer(Long64_t eventNum) override {
+         Int_t headerSize = 0, elementSize = 0;
+         if (R__unlikely(!fLeaf || !fLeaf->GetJaggedLayout(headerSize, elementSize) || elementSize != sizeof(T))) {
+            return -1;
+         }
+         fFirstEvent = 0;
+         return fBranch->GetBulkRead().GetBulkEntriesJagged(eventNum, fBuffer, fOffsets);
+      }
+
+      // The buffer holds all the events of the basket; skipping events only moves the first one.
+      virtual Int_t Adjust(Int_t eventCount) override {
+         fFirstEvent += eventCount;
+         return 0;
+      }
+
+      std::vector<Int_t> fOffsets; // Offsets of the elements of each event in the buffer.
+      Int_t fFirstEvent{0};        // Index in fOffsets of the event at the start of the current range.
+};
+
+}  // Experimental
+}  // ROOT
+
+#endif // ROOT_TTreeReaderArrayFast
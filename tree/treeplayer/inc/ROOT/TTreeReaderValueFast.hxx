@@ -66,7 +66,7 @@ class TTreeReaderValueFastBase {
              }
              fRemaining -= adjust;
           } else {
-             fRemaining = fBranch->GetBulkRead().GetEntriesSerialized(eventNum, fBuffer);
+             fRemaining = FillBuffer(eventNum);
              if (R__unlikely(fRemaining < 0)) {
                 fReadStatus = ROOT::Internal::TTreeReaderValueBase::kReadError;
                 //printf("Failed to retrieve entries from the branch.\n");
@@ -84,6 +84,11 @@ class TTreeReaderValueFastBase {
 
    protected:
 
+      // Read the events starting at eventNum into the buffer; returns the number of events read or -1 on failure.
+      virtual Int_t FillBuffer(Long64_t eventNum) {
+         return fBranch->GetBulkRead().GetEntriesSerialized(eventNum, fBuffer);
+      }
+
       // Adjust the current buffer offset forward N events.
       virtual Int_t Adjust(Int_t eventCount) {
          Int_t bufOffset = fBuffer.Length();
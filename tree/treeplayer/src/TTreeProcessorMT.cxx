@@ -27,6 +27,8 @@ objects.
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm> // std::max, std::min
+
 using namespace ROOT;
 
 namespace {
@@ -51,6 +53,23 @@ static bool ClustersAreSortedAndContiguous(const std::vector<std::vector<EntryCl
    return true;
 }
 
+/// Restrict clusters with global entry numbers to the interval [range.first, range.second): clusters outside of the
+/// interval are dropped, clusters that straddle its boundaries are trimmed.
+static void ClipClustersToRange(std::vector<std::vector<EntryCluster>> &clusters,
+                                const std::pair<Long64_t, Long64_t> &range)
+{
+   for (auto &fileClusters : clusters) {
+      std::vector<EntryCluster> clipped;
+      for (const auto &c : fileClusters) {
+         const auto start = std::max(c.start, range.first);
+         const auto end = std::min(c.end, range.second);
+         if (start < end)
+            clipped.emplace_back(EntryCluster{start, end});
+      }
+      fileClusters = std::move(clipped);
+   }
+}
+
 /// Take a vector of vectors of EntryClusters (a vector per file), filter the entries according to entryList, and
 /// and return a new vector of vectors of EntryClusters where cluster start/end entry numbers have been converted to
 /// TEntryList-local entry numbers.
@@ -554,6 +573,39 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads) : TTreeProcesso
 {
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Constructor based on a TTree and a TEntryList that only processes a range of entries.
+/// \param[in] tree Tree or chain of files containing the tree to process.
+/// \param[in] entries List of entry numbers to process.
+/// \param[in] nThreads Number of threads to create in the underlying thread-pool. The semantics of this argument are
+///                     the same as for TThreadExecutor.
+/// \param[in] globalRange Interval [begin, end) of global entry numbers to process. If `entries` is not empty, the
+///                        interval refers to positions in the entry list.
+///
+/// With a global range, the entry numbers reported by the TTreeReader passed to the processing function are global,
+/// i.e. they do not depend on how entries are split into tasks. Clusters that do not overlap with the range are
+/// skipped without being read; the first and last clusters of the range are processed partially.
+TTreeProcessorMT::TTreeProcessorMT(TTree &tree, const TEntryList &entries, UInt_t nThreads,
+                                   const std::pair<Long64_t, Long64_t> &globalRange)
+   : fFileNames(GetFilesFromTree(tree)), fTreeNames(GetTreeFullPaths(tree)), fEntryList(entries),
+     fFriendInfo(GetFriendInfo(tree)), fGlobalRange(globalRange), fHasGlobalRange(true), fPool(nThreads)
+{
+   ROOT::EnableThreadSafety();
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Constructor based on a TTree that only processes a range of entries.
+/// \param[in] tree Tree or chain of files containing the tree to process.
+/// \param[in] nThreads Number of threads to create in the underlying thread-pool. The semantics of this argument are
+///                     the same as for TThreadExecutor.
+/// \param[in] globalRange Interval [begin, end) of global entry numbers to process.
+///
+/// See the constructor with a TEntryList for more details.
+TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const std::pair<Long64_t, Long64_t> &globalRange)
+   : TTreeProcessorMT(tree, TEntryList(), nThreads, globalRange)
+{
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// Process the entries of a TTree in parallel. The user-provided function
 /// receives a TTreeReader which can be used to iterate on a subrange of
@@ -587,13 +639,16 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // sub-entrylists.
    const bool hasFriends = !friendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
-   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList;
+   // The same is true if a global entry range was requested.
+   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fHasGlobalRange;
    ClustersAndEntries clusterAndEntries{};
    if (shouldRetrieveAllClusters) {
       clusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile);
       if (hasEntryList)
          clusterAndEntries.first = ConvertToElistClusters(std::move(clusterAndEntries.first), fEntryList, fTreeNames,
                                                           fFileNames, clusterAndEntries.second);
+      if (fHasGlobalRange)
+         ClipClustersToRange(clusterAndEntries.first, fGlobalRange);
    }
 
    const auto &clusters = clusterAndEntries.first;
@@ -505,3 +505,37 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+TEST(TreeProcessorMT, GlobalRange)
+{
+   const std::vector<std::string> filenames = {"treeprocmt_globalrange1.root", "treeprocmt_globalrange2.root",
+                                               "treeprocmt_globalrange3.root"};
+   WriteFiles(std::vector<std::string>(filenames.size(), "t"), filenames);
+   TChain c("t");
+   for (const auto &f : filenames)
+      c.Add(f.c_str());
+
+   // the range starts in the first file and ends in the last one, the second file is processed completely
+   std::atomic_int sum(0);
+   std::atomic_int count(0);
+   std::atomic_int nWrongEntries(0);
+   auto sumValues = [&](TTreeReader &r) {
+      TTreeReaderValue<int> v(r, "v");
+      while (r.Next()) {
+         // entry numbers are global: the value of v is the entry number plus one
+         if (*v != r.GetCurrentEntry() + 1)
+            ++nWrongEntries;
+         sum += *v;
+         ++count;
+      }
+   };
+
+   ROOT::TTreeProcessorMT proc(c, 0u, {5ll, 25ll});
+   proc.Process(sumValues);
+
+   EXPECT_EQ(count.load(), 20);
+   EXPECT_EQ(sum.load(), 310); // sum of [6..25] inclusive
+   EXPECT_EQ(nWrongEntries.load(), 0);
+
+   DeleteFiles(filenames);
+}